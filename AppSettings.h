@@ -4,10 +4,23 @@
 
 #pragma once
 #include <JuceHeader.h>
+#include "RekordboxXmlReader.h"
+#include "TrackMapJournal.h"
+#include "SettingsWriter.h"
+#include "TrackMatchIndex.h"
+#include "TrackBindings.h"
+#include "BinarySnapshot.h"
+#include "ShowPackage.h"
+#include "WaveformCache.h"
 #include <unordered_map>
 #include <unordered_set>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <utility>
 #include <functional>
 #include <string>
+#include <memory>
 
 //==============================================================================
 // TrackMap -- maps tracks (by artist|title) to timecode offsets and triggers
@@ -99,6 +112,37 @@ struct CuePoint
         artnetVal   = juce::jlimit(0, 255, getInt("artnetVal", 255));
     }
 
+    // Binary form for the trackmap.bin load cache (same fields, already validated)
+    void writeBinary(BinarySnapshot::Writer& w) const
+    {
+        w.writeInt((int)positionMs);
+        w.writeString(name);
+        w.writeInt(midiChannel);
+        w.writeInt(midiNoteNum);
+        w.writeInt(midiNoteVel);
+        w.writeInt(midiCCNum);
+        w.writeInt(midiCCVal);
+        w.writeString(oscAddress);
+        w.writeString(oscArgs);
+        w.writeInt(artnetCh);
+        w.writeInt(artnetVal);
+    }
+
+    void readBinary(BinarySnapshot::Reader& r)
+    {
+        positionMs  = (uint32_t)r.readInt();
+        name        = r.readString();
+        midiChannel = r.readInt();
+        midiNoteNum = r.readInt();
+        midiNoteVel = r.readInt();
+        midiCCNum   = r.readInt();
+        midiCCVal   = r.readInt();
+        oscAddress  = r.readString();
+        oscArgs     = r.readString();
+        artnetCh    = r.readInt();
+        artnetVal   = r.readInt();
+    }
+
     /// Format positionMs as "MM:SS.mmm" for display
     static juce::String formatPositionMs(uint32_t ms)
     {
@@ -324,6 +368,61 @@ struct TrackMapEntry
         }
     }
 
+    // Binary form for the trackmap.bin load cache.  Written from loaded
+    // entries, so no legacy migration or validation on the way back in.
+    // Bump TrackMap::kBinarySchema when changing the field list.
+    void writeBinary(BinarySnapshot::Writer& w) const
+    {
+        w.writeString(artist);
+        w.writeString(title);
+        w.writeInt(durationSec);
+        w.writeString(timecodeOffset);
+        w.writeString(notes);
+        w.writeInt(sortOrder);
+        w.writeInt(midiChannel);
+        w.writeInt(midiNoteNum);
+        w.writeInt(midiNoteVel);
+        w.writeInt(midiCCNum);
+        w.writeInt(midiCCVal);
+        w.writeString(oscAddress);
+        w.writeString(oscArgs);
+        w.writeInt(artnetCh);
+        w.writeInt(artnetVal);
+        w.writeInt(bpmMultiplier);
+        w.writeInt((int)cuePoints.size());
+        for (auto& cue : cuePoints)
+            cue.writeBinary(w);
+    }
+
+    void readBinary(BinarySnapshot::Reader& r)
+    {
+        artist         = r.readString();
+        title          = r.readString();
+        durationSec    = r.readInt();
+        timecodeOffset = r.readString();
+        notes          = r.readString();
+        sortOrder      = r.readInt();
+        midiChannel    = r.readInt();
+        midiNoteNum    = r.readInt();
+        midiNoteVel    = r.readInt();
+        midiCCNum      = r.readInt();
+        midiCCVal      = r.readInt();
+        oscAddress     = r.readString();
+        oscArgs        = r.readString();
+        artnetCh       = r.readInt();
+        artnetVal      = r.readInt();
+        bpmMultiplier  = r.readInt();
+
+        const int numCues = r.readInt();
+        cuePoints.clear();
+        if (numCues > 0 && r.isValid())
+        {
+            cuePoints.resize((size_t)juce::jmin(numCues, 100000));
+            for (auto& cue : cuePoints)
+                cue.readBinary(r);
+        }
+    }
+
     //------------------------------------------------------------------
     // Timecode offset parsing/formatting utilities
     //------------------------------------------------------------------
@@ -360,12 +459,91 @@ struct TrackMapEntry
     }
 };
 
+//==============================================================================
+// TrackKey -- normalised artist|title (+ duration) with a precomputed hash.
+// Build once per track change and reuse for every TrackMap lookup: lookups
+// by TrackKey hash and compare the stored text, they never build strings.
+//==============================================================================
+struct TrackKey
+{
+    std::string text;            // "artist|title", lowercased + trimmed (as makeKey)
+    uint64_t    hash = 0;        // FNV-1a 64 of text
+    int         durationSec = 0; // 0 = no duration
+
+    static TrackKey make(const juce::String& artist, const juce::String& title, int dur = 0)
+    {
+        TrackKey k;
+        k.text = TrackMapEntry::makeKey(artist, title, 0);
+        k.hash = hashText(k.text);
+        k.durationSec = juce::jmax(0, dur);
+        return k;
+    }
+
+    static uint64_t hashText(const std::string& t)
+    {
+        uint64_t h = 1469598103934665603ull;
+        for (unsigned char c : t)
+            h = (h ^ c) * 1099511628211ull;
+        return h;
+    }
+
+    /// Same track, another duration (no re-normalisation)
+    TrackKey withDuration(int dur) const
+    {
+        TrackKey k = *this;
+        k.durationSec = juce::jmax(0, dur);
+        return k;
+    }
+
+    bool isEmpty() const { return text.empty(); }
+
+    /// Key of the TrackMap's primary map -- same as TrackMapEntry::makeKey()
+    std::string toMapKey() const
+    {
+        return durationSec > 0 ? text + "|" + std::to_string(durationSec) : text;
+    }
+
+    /// Artist+title identity, duration ignored
+    bool sameTrack(const TrackKey& o) const { return hash == o.hash && text == o.text; }
+
+    struct Hasher    { size_t operator()(const TrackKey& k) const { return (size_t)k.hash; } };
+    struct SameTrack { bool operator()(const TrackKey& a, const TrackKey& b) const { return a.sameTrack(b); } };
+};
+
 //==============================================================================
 // TrackMap -- O(1) lookup by artist|title, persisted as separate JSON file
+// (trackmap.json snapshot + append-only change journal, see TrackMapJournal)
 //==============================================================================
 class TrackMap
 {
 public:
+    TrackMap() = default;
+
+    // The secondary index points into `entries`: copies rebuild it, moves
+    // keep the nodes (and so the pointers) intact.  A copy does not share
+    // the original's journal; saving it records its full contents.
+    TrackMap(const TrackMap& other)
+        : entries(other.entries), generation(other.generation),
+          autoMatchThreshold(other.autoMatchThreshold)
+    {
+        rebuildIndex();
+        markAllChanged();
+    }
+    TrackMap& operator=(const TrackMap& other)
+    {
+        if (this != &other)
+        {
+            entries = other.entries;
+            autoMatchThreshold = other.autoMatchThreshold;
+            rebuildIndex();
+            markAllChanged();
+            ++generation;
+        }
+        return *this;
+    }
+    TrackMap(TrackMap&&) = default;
+    TrackMap& operator=(TrackMap&&) = default;
+
     //------------------------------------------------------------------
     // File location
     //------------------------------------------------------------------
@@ -378,47 +556,129 @@ public:
     }
 
     //------------------------------------------------------------------
-    // Persistence
+    // Persistence -- save() appends only what changed since the last save
+    // (or load) to the journal; cost is independent of the map's size.
+    // Entries handed out by the mutable find*() overloads since the last
+    // save are remembered with a hash of their saved state and re-checked
+    // by the next save(), so an in-place edit made before that save is
+    // found even without markChanged().  Read-only callers use the const
+    // overloads and are not tracked.  A pointer kept across a save() needs
+    // markChanged() for later edits.
     //------------------------------------------------------------------
     void save() const
     {
-        auto* root = new juce::DynamicObject();
-        root->setProperty("version", 2);  // v2 = artist|title keyed
+        auto& j = getJournal();
 
-        juce::Array<juce::var> arr;
-        for (auto& [k, entry] : entries)
-            arr.add(entry.toVar());
+        for (auto& [e, savedHash] : lent)
+            if (changed.count(e) == 0 && recordHash(*e) != savedHash)
+                changed.insert(e);
 
-        root->setProperty("tracks", arr);
+        juce::Array<juce::var> records;
+        if (pendingClear)
+            records.add(makeRecord("clear"));
+        for (auto& key : removedKeys)
+        {
+            auto r = makeRecord("del");
+            r.getDynamicObject()->setProperty("key", juce::String::fromUTF8(key.c_str()));
+            records.add(r);
+        }
+        for (auto* e : changed)
+        {
+            auto r = makeRecord("put");
+            r.getDynamicObject()->setProperty("entry", e->toVar());
+            records.add(r);
+        }
+
+        if (!j.append(records))
+        {
+            // Journal unwritable: fall back to rewriting the snapshot
+            if (!j.replaceSnapshot(toSnapshotVar())) return;
+        }
+        pendingClear = false;
+        removedKeys.clear();
+        changed.clear();
+        lent.clear();   // saved or unchanged: only later lookups need checking
 
-        juce::var jsonVar(root);
-        getTrackMapFile().replaceWithText(juce::JSON::toString(jsonVar));
+        if (j.shouldCompact())
+            compactInBackground();
     }
 
+    /// Loads trackmap.bin when it matches trackmap.json, else parses the
+    /// JSON (and then rewrites both in the background so the next start
+    /// gets the cache), then replays the journal.
     bool load()
     {
-        auto file = getTrackMapFile();
-        if (!file.existsAsFile()) return false;
-
-        auto parsed = juce::JSON::parse(file.loadFileAsString());
-        auto* obj = parsed.getDynamicObject();
-        if (!obj) return false;
+        auto& j = getJournal();
+        const double startMs = juce::Time::getMillisecondCounterHiRes();
 
         entries.clear();
+        byArtistTitle.clear();
+        matchIndex.reset();
+        fuzzyMemo.clear();
 
-        auto* arr = obj->getProperty("tracks").getArray();
-        if (arr)
+        bool found = false;
+        const bool fromCache = loadBinarySnapshot(j);
+        if (fromCache)
         {
-            for (auto& item : *arr)
+            found = true;
+        }
+        else
+        {
+            auto parsed = j.readSnapshot();
+            if (auto* obj = parsed.getDynamicObject())
             {
-                TrackMapEntry e;
-                e.fromVar(item);
-                if (e.hasValidKey())
-                    entries[e.key()] = std::move(e);
+                found = true;
+                if (auto* arr = obj->getProperty("tracks").getArray())
+                {
+                    entries.reserve((size_t)arr->size());
+                    for (auto& item : *arr)
+                    {
+                        TrackMapEntry e;
+                        e.fromVar(item);
+                        if (e.hasValidKey())
+                        {
+                            auto key = e.key();
+                            store(std::move(key), std::move(e));
+                        }
+                    }
+                }
             }
         }
+
+        if (j.replay([this](const juce::var& r) { applyRecord(r); }) > 0)
+            found = true;
+
+        pendingClear = false;
+        removedKeys.clear();
+        changed.clear();
+        lent.clear();
         ++generation;
-        return true;
+
+        DBG("TrackMap: loaded " << (int)entries.size() << " entries from "
+            << (fromCache ? "trackmap.bin" : "trackmap.json") << " in "
+            << juce::String(juce::Time::getMillisecondCounterHiRes() - startMs, 1) << " ms");
+
+        if (found && !fromCache)
+            compactInBackground();
+        return found;
+    }
+
+    /// Replaces trackmap.json with `snapshotVar` and drops the journal
+    /// (configuration restore).  Call load() afterwards.
+    bool replaceSnapshot(const juce::var& snapshotVar)
+    {
+        BinarySnapshot::cacheFileFor(getTrackMapFile()).deleteFile();
+        return getJournal().replaceSnapshot(snapshotVar);
+    }
+
+    /// Full contents in the trackmap.json format
+    juce::var toSnapshotVar() const
+    {
+        std::vector<TrackMapEntry> all;
+        all.reserve(entries.size());
+        for (auto& [k, entry] : entries)
+            all.push_back(entry);
+        return snapshotVarOf(all);
     }
 
     //------------------------------------------------------------------
@@ -429,56 +689,153 @@ public:
     const TrackMapEntry* find(const juce::String& artist, const juce::String& title,
                               int dur = 0) const
     {
-        auto it = entries.find(TrackMapEntry::makeKey(artist, title, dur));
-        return (it != entries.end()) ? &it->second : nullptr;
+        return find(TrackKey::make(artist, title, dur));
     }
 
     /// Mutable find (for editing in-place)
     TrackMapEntry* find(const juce::String& artist, const juce::String& title,
                         int dur = 0)
     {
-        auto it = entries.find(TrackMapEntry::makeKey(artist, title, dur));
-        return (it != entries.end()) ? &it->second : nullptr;
+        return find(TrackKey::make(artist, title, dur));
     }
 
     /// Check if an artist+title[+duration] exists in the map
     bool contains(const juce::String& artist, const juce::String& title,
                   int dur = 0) const
     {
-        return entries.count(TrackMapEntry::makeKey(artist, title, dur)) > 0;
+        return find(TrackKey::make(artist, title, dur)) != nullptr;
     }
 
     /// Find by artist+title, ignoring duration.  Used as a last-resort fallback
     /// when the caller's duration doesn't match the entry's saved duration.
+    /// Prefers the entry saved without duration.
     const TrackMapEntry* findIgnoringDuration(const juce::String& artist,
                                               const juce::String& title) const
     {
-        auto base = TrackMapEntry::makeKey(artist, title, 0);  // key without duration
-        // Exact match (entry saved without duration)
-        auto it = entries.find(base);
-        if (it != entries.end()) return &it->second;
-        // Prefix match (entry saved with some duration: "base|NNN")
-        auto prefix = base + "|";
-        for (auto& [k, v] : entries)
-            if (k.size() > prefix.size() && k.substr(0, prefix.size()) == prefix)
-                return &v;
-        return nullptr;
+        return pickVariant(TrackKey::make(artist, title), -1);
     }
 
     /// Mutable version of findIgnoringDuration
     TrackMapEntry* findIgnoringDuration(const juce::String& artist,
                                         const juce::String& title)
     {
-        auto base = TrackMapEntry::makeKey(artist, title, 0);
-        auto it = entries.find(base);
-        if (it != entries.end()) return &it->second;
-        auto prefix = base + "|";
-        for (auto& [k, v] : entries)
-            if (k.size() > prefix.size() && k.substr(0, prefix.size()) == prefix)
-                return &v;
+        return touched(pickVariant(TrackKey::make(artist, title), -1));
+    }
+
+    /// The usual lookup chain in one step: exact duration, then the entry
+    /// saved without duration, then any duration.  Same result as
+    /// find(dur) -> find(0) -> findIgnoringDuration(), with one key build.
+    const TrackMapEntry* findBestMatch(const juce::String& artist, const juce::String& title,
+                                       int dur) const
+    {
+        return pickVariant(TrackKey::make(artist, title), dur);
+    }
+
+    /// Mutable version of findBestMatch
+    TrackMapEntry* findBestMatch(const juce::String& artist, const juce::String& title, int dur)
+    {
+        return touched(pickVariant(TrackKey::make(artist, title), dur));
+    }
+
+    //------------------------------------------------------------------
+    // Lookup by a prebuilt TrackKey -- no string building
+    //------------------------------------------------------------------
+    const TrackMapEntry* find(const TrackKey& key) const
+    {
+        auto* list = variantsOf(key);
+        if (list == nullptr) return nullptr;
+        for (auto* e : *list)
+            if (e->durationSec == key.durationSec) return e;
         return nullptr;
     }
 
+    TrackMapEntry* find(const TrackKey& key)
+    {
+        return touched(const_cast<TrackMapEntry*>(std::as_const(*this).find(key)));
+    }
+
+    bool contains(const TrackKey& key) const { return find(key) != nullptr; }
+
+    const TrackMapEntry* findIgnoringDuration(const TrackKey& key) const { return pickVariant(key, -1); }
+    TrackMapEntry*       findIgnoringDuration(const TrackKey& key)       { return touched(pickVariant(key, -1)); }
+
+    /// key.durationSec is the preferred duration (see findBestMatch above)
+    const TrackMapEntry* findBestMatch(const TrackKey& key) const { return pickVariant(key, key.durationSec); }
+    TrackMapEntry*       findBestMatch(const TrackKey& key)       { return touched(pickVariant(key, key.durationSec)); }
+
+    //------------------------------------------------------------------
+    // Fuzzy lookup -- for tags that differ between sources ("feat.",
+    // punctuation, accents...), see TrackMatchIndex.  The index is built on
+    // first use and then kept in step with the map.
+    //------------------------------------------------------------------
+    struct SimilarTrack
+    {
+        const TrackMapEntry* entry = nullptr;   // variant picked as findBestMatch would
+        float score = 0.0f;                     // 0..1
+    };
+
+    /// Ranked candidates for a track that has no exact entry (e.g. to
+    /// suggest a mapping).  dur picks among each candidate's variants.
+    std::vector<SimilarTrack> findSimilar(const juce::String& artist, const juce::String& title,
+                                          int dur, size_t maxResults = 5, float minScore = 0.5f) const
+    {
+        std::vector<SimilarTrack> result;
+        for (auto& m : getMatchIndex().query(artist, title, maxResults, minScore))
+            if (auto* e = pickVariant(identityKey(m.identity), dur))
+                result.push_back({ e, m.score });
+        return result;
+    }
+
+    /// findBestMatch(), then -- when automatic matching is enabled -- the
+    /// most similar track scoring at least getAutoMatchThreshold().  Two
+    /// different tracks scoring within kAmbiguousMargin of each other bind
+    /// neither.  Results are memoised until the map changes, so this is
+    /// cheap enough to call every frame.
+    const TrackMapEntry* findBestMatchFuzzy(const TrackKey& key) const
+    {
+        if (auto* exact = pickVariant(key, key.durationSec)) return exact;
+        if (autoMatchThreshold <= 0.0f || key.isEmpty() || entries.empty()) return nullptr;
+
+        auto memo = fuzzyMemo.find(key.text);
+        if (memo == fuzzyMemo.end())
+        {
+            if (fuzzyMemo.size() >= 256) fuzzyMemo.clear();
+
+            // TrackKey::text is "artist|title"; lower case doesn't matter here
+            const auto bar = key.text.find('|');
+            const auto artist = juce::String::fromUTF8(key.text.data(), (int)bar);
+            const auto title  = juce::String::fromUTF8(key.text.data() + bar + 1,
+                                                       (int)(key.text.size() - bar - 1));
+
+            auto matches = getMatchIndex().query(artist, title, 2, autoMatchThreshold);
+            const bool ambiguous = matches.size() > 1
+                && matches[0].score - matches[1].score < kAmbiguousMargin;
+            memo = fuzzyMemo.emplace(key.text, (matches.empty() || ambiguous) ? std::string()
+                                                                              : matches[0].identity).first;
+        }
+        if (memo->second.empty()) return nullptr;
+        return pickVariant(identityKey(memo->second), key.durationSec);
+    }
+
+    TrackMapEntry* findBestMatchFuzzy(const TrackKey& key)
+    {
+        return touched(const_cast<TrackMapEntry*>(std::as_const(*this).findBestMatchFuzzy(key)));
+    }
+
+    /// Minimum similarity (0..1) for findBestMatchFuzzy(); 0 disables it.
+    void setAutoMatchThreshold(float threshold)
+    {
+        threshold = juce::jlimit(0.0f, 1.0f, threshold);
+        if (threshold != autoMatchThreshold)
+        {
+            autoMatchThreshold = threshold;
+            fuzzyMemo.clear();
+        }
+    }
+    float getAutoMatchThreshold() const { return autoMatchThreshold; }
+
+    static constexpr float kAmbiguousMargin = 0.02f;
+
     //------------------------------------------------------------------
     // Mutation
     //------------------------------------------------------------------
@@ -488,7 +845,7 @@ public:
     {
         if (entry.hasValidKey())
         {
-            entries[entry.key()] = entry;
+            store(entry.key(), entry);
             ++generation;
         }
     }
@@ -497,22 +854,48 @@ public:
     bool remove(const juce::String& artist, const juce::String& title,
                 int dur = 0)
     {
-        bool erased = entries.erase(TrackMapEntry::makeKey(artist, title, dur)) > 0;
-        if (erased) ++generation;
-        return erased;
+        return remove(TrackKey::make(artist, title, dur));
     }
 
+    bool remove(const TrackKey& key)
+    {
+        if (find(key) == nullptr) return false;
+        auto it = entries.find(key.toMapKey());
+        if (it == entries.end()) return false;
+        erase(it);
+        ++generation;
+        return true;
+    }
+
+    /// Record an entry edited in place, so the next save() includes it
+    /// without comparing it against its saved state.
+    void markChanged(const TrackMapEntry& e) { changed.insert(&e); }
+
     /// Clear all entries
-    void clear() { entries.clear(); ++generation; }
+    void clear()
+    {
+        entries.clear();
+        byArtistTitle.clear();
+        matchIndex.reset();
+        fuzzyMemo.clear();
+        changed.clear();
+        lent.clear();
+        removedKeys.clear();
+        pendingClear = true;
+        ++generation;
+    }
 
     /// Apply playlist order: reorder existing tracks, add missing ones.
     /// Does NOT touch cues, triggers, offsets, or notes of existing entries.
     /// Tracks not in the playlist have their sortOrder reset to 0 (appear after playlist).
     void applyPlaylistOrder(const std::vector<TrackMapEntry>& playlist)
     {
-        // Reset all existing sortOrders
+        // Reset all existing sortOrders (only those that change are saved)
         for (auto& [k, entry] : entries)
+        {
+            if (entry.sortOrder != 0) changed.insert(&entry);
             entry.sortOrder = 0;
+        }
 
         // Apply playlist positions: update sortOrder on existing, add new
         int pos = 1;
@@ -527,17 +910,19 @@ public:
             if (it != entries.end())
             {
                 it->second.sortOrder = pos;
+                changed.insert(&it->second);
             }
-            else if (auto* existing = findIgnoringDuration(pe.artist, pe.title))
+            else if (auto* existing = findIgnoringDuration(TrackKey::make(pe.artist, pe.title)))
             {
                 existing->sortOrder = pos;
+                changed.insert(existing);
             }
             else
             {
                 // New entry — add with playlist position
                 TrackMapEntry newEntry = pe;
                 newEntry.sortOrder = pos;
-                entries[key] = std::move(newEntry);
+                store(std::move(key), std::move(newEntry));
             }
             ++pos;
         }
@@ -598,17 +983,7 @@ public:
 
     bool exportToFile(const juce::File& file) const
     {
-        auto* root = new juce::DynamicObject();
-        root->setProperty("version", 2);
-
-        juce::Array<juce::var> arr;
-        for (auto& [k, entry] : entries)
-            arr.add(entry.toVar());
-
-        root->setProperty("tracks", arr);
-
-        juce::var jsonVar(root);
-        return file.replaceWithText(juce::JSON::toString(jsonVar));
+        return file.replaceWithText(juce::JSON::toString(toSnapshotVar()));
     }
 
     /// Import from a user-chosen file -- merges with existing entries.
@@ -630,7 +1005,8 @@ public:
             e.fromVar(item);
             if (e.hasValidKey())
             {
-                entries[e.key()] = std::move(e);
+                auto key = e.key();
+                store(std::move(key), std::move(e));
                 ++count;
             }
         }
@@ -650,6 +1026,9 @@ public:
     // Returns entries with artist, title, durationSec populated.
     // Offsets and triggers are left at defaults (user configures later).
     // Artwork and waveform will be fetched from the CDJ on first play.
+    // The file is streamed (RekordboxXmlReader); callers importing large
+    // libraries should read it once off the message thread and use
+    // entriesFromRekordbox() per playlist instead of re-parsing.
     //------------------------------------------------------------------
     static std::vector<TrackMapEntry> parseRekordboxXml(const juce::File& file)
     {
@@ -660,169 +1039,310 @@ public:
     /// tracks from that playlist in playlist order.  Otherwise return all tracks.
     static std::vector<TrackMapEntry> parseRekordboxXml(const juce::File& file,
                                                         const juce::String& playlistName)
+    {
+        auto library = RekordboxXmlReader::read(file);
+        if (playlistName.isEmpty())
+            return entriesFromRekordbox(library, -1);
+
+        const int index = library.findPlaylist(playlistName);
+        if (index < 0) return {};
+        return entriesFromRekordbox(library, index);
+    }
+
+    /// Entries of one playlist (in playlist order) or, with playlistIndex
+    /// -1, of the whole COLLECTION (in file order).  Duplicates by key()
+    /// are dropped, first occurrence wins.
+    static std::vector<TrackMapEntry> entriesFromRekordbox(const RekordboxLibrary& library,
+                                                           int playlistIndex)
     {
         std::vector<TrackMapEntry> result;
-        auto xml = juce::XmlDocument::parse(file);
-        if (!xml || xml->getTagName() != "DJ_PLAYLISTS") return result;
+        std::unordered_set<std::string> seen;
 
-        auto* collection = xml->getChildByName("COLLECTION");
-        if (!collection) return result;
+        auto add = [&](const RekordboxLibrary::Track& t)
+        {
+            TrackMapEntry e;
+            e.title       = t.title;
+            e.artist      = t.artist;
+            e.durationSec = t.durationSec;
+            if (seen.insert(e.key()).second)
+                result.push_back(std::move(e));
+        };
 
-        // Build TrackID → entry map from COLLECTION
-        std::unordered_map<int, TrackMapEntry> trackById;
-        for (auto* track = collection->getChildByName("TRACK");
-             track != nullptr;
-             track = track->getNextElementWithTagName("TRACK"))
+        if (playlistIndex < 0)
         {
-            juce::String title  = track->getStringAttribute("Name").trim();
-            juce::String artist = track->getStringAttribute("Artist").trim();
-            int duration        = track->getIntAttribute("TotalTime", 0);
-            int trackId         = track->getIntAttribute("TrackID", 0);
+            result.reserve(library.tracks.size());
+            for (auto& t : library.tracks) add(t);
+        }
+        else if (playlistIndex < (int)library.playlists.size())
+        {
+            for (int32_t id : library.playlists[(size_t)playlistIndex].trackIds)
+                if (auto* t = library.findTrack(id)) add(*t);
+        }
+        return result;
+    }
 
-            if (title.isEmpty() || trackId <= 0) continue;
+    /// List available playlist names in a rekordbox XML file
+    static juce::StringArray listRekordboxPlaylists(const juce::File& file)
+    {
+        return RekordboxXmlReader::read(file).getPlaylistNames();
+    }
 
-            TrackMapEntry e;
-            e.title       = title;
-            e.artist      = artist;
-            e.durationSec = duration;
-            trackById[trackId] = std::move(e);
+private:
+    //------------------------------------------------------------------
+    // Secondary index -- TrackKey (artist+title, duration ignored) -> every
+    // entry saved under it, with or without a duration.  Kept in step with
+    // `entries` by store() / unindex(); entry pointers into an unordered_map
+    // stay valid until that entry is erased.
+    //------------------------------------------------------------------
+    template <typename Entry>
+    void store(std::string key, Entry&& e)
+    {
+        auto [it, inserted] = entries.insert_or_assign(std::move(key), std::forward<Entry>(e));
+        if (inserted)
+            index(it->second);
+        changed.insert(&it->second);
+    }
+
+    void erase(std::unordered_map<std::string, TrackMapEntry>::iterator it)
+    {
+        unindex(it->second);
+        changed.erase(&it->second);
+        lent.erase(&it->second);
+        removedKeys.insert(it->first);
+        entries.erase(it);
+    }
+
+    void index(TrackMapEntry& e)
+    {
+        auto key = TrackKey::make(e.artist, e.title);
+        if (matchIndex != nullptr)
+            matchIndex->add(key.text, e.artist, e.title);
+        if (!fuzzyMemo.empty()) fuzzyMemo.clear();
+        byArtistTitle[std::move(key)].push_back(&e);
+    }
+
+    void rebuildIndex()
+    {
+        byArtistTitle.clear();
+        matchIndex.reset();
+        fuzzyMemo.clear();
+        for (auto& [k, e] : entries)
+            index(e);
+    }
+
+    void unindex(const TrackMapEntry& e)
+    {
+        auto it = byArtistTitle.find(TrackKey::make(e.artist, e.title));
+        if (it == byArtistTitle.end()) return;
+        auto& list = it->second;
+        list.erase(std::remove(list.begin(), list.end(), &e), list.end());
+        if (!fuzzyMemo.empty()) fuzzyMemo.clear();
+        if (list.empty())
+        {
+            if (matchIndex != nullptr)
+                matchIndex->remove(it->first.text);
+            byArtistTitle.erase(it);
         }
+    }
 
-        // If a playlist is requested, filter and order by playlist
-        if (playlistName.isNotEmpty())
+    /// Fuzzy index over every artist+title in the map, built on first use
+    TrackMatchIndex& getMatchIndex() const
+    {
+        if (matchIndex == nullptr)
         {
-            auto* playlists = xml->getChildByName("PLAYLISTS");
-            if (!playlists) return result;
+            matchIndex = std::make_unique<TrackMatchIndex>();
+            for (auto& [key, list] : byArtistTitle)
+                matchIndex->add(key.text, list.front()->artist, list.front()->title);
+        }
+        return *matchIndex;
+    }
 
-            // Traverse by full path (e.g. "Shows / Saturday") to handle
-            // duplicate playlist names in different folders.
-            // Path segments skip ROOT (same as listRekordboxPlaylists).
-            juce::XmlElement* playlistNode = nullptr;
-            {
-                // Split path into segments on the " / " SUBSTRING.
-                // (Do NOT use addTokens — it treats the second arg as a set
-                //  of break CHARACTERS, which would split on every space.)
-                juce::StringArray segments;
-                juce::String remaining = playlistName;
-                int pos = remaining.indexOf(" / ");
-                while (pos >= 0)
-                {
-                    segments.add(remaining.substring(0, pos));
-                    remaining = remaining.substring(pos + 3);
-                    pos = remaining.indexOf(" / ");
-                }
-                segments.add(remaining);
-                // Drop any empty segments (shouldn't happen but defensive)
-                for (int i = segments.size() - 1; i >= 0; --i)
-                    if (segments[i].isEmpty()) segments.remove(i);
-
-                // Start from ROOT node (first Type=0 child of PLAYLISTS)
-                juce::XmlElement* current = nullptr;
-                for (auto* child = playlists->getFirstChildElement();
-                     child != nullptr; child = child->getNextElement())
-                {
-                    if (child->getTagName() == "NODE"
-                        && child->getIntAttribute("Type", -1) == 0)
-                    { current = child; break; }
-                }
+    static TrackKey identityKey(const std::string& text)
+    {
+        TrackKey k;
+        k.text = text;
+        k.hash = TrackKey::hashText(text);
+        return k;
+    }
 
-                // Walk path segments: folders first, last segment is the playlist
-                for (int si = 0; current != nullptr && si < segments.size(); ++si)
-                {
-                    bool isLast = (si == segments.size() - 1);
-                    int wantType = isLast ? 1 : 0;  // 1=playlist, 0=folder
-                    juce::XmlElement* found = nullptr;
-                    for (auto* child = current->getFirstChildElement();
-                         child != nullptr; child = child->getNextElement())
-                    {
-                        if (child->getTagName() == "NODE"
-                            && child->getStringAttribute("Name") == segments[si]
-                            && child->getIntAttribute("Type", -1) == wantType)
-                        { found = child; break; }
-                    }
-                    current = found;
-                }
-                playlistNode = current;
-            }
-            if (!playlistNode) return result;
+    const std::vector<TrackMapEntry*>* variantsOf(const TrackKey& key) const
+    {
+        auto it = byArtistTitle.find(key);
+        return it != byArtistTitle.end() ? &it->second : nullptr;
+    }
+
+    /// dur > 0: exact duration first.  Then the entry without duration,
+    /// then the first one saved (dur < 0 skips the exact step).
+    TrackMapEntry* pickVariant(const TrackKey& key, int dur) const
+    {
+        auto* list = variantsOf(key);
+        if (list == nullptr) return nullptr;
+
+        TrackMapEntry* noDuration = nullptr;
+        for (auto* e : *list)
+        {
+            if (dur > 0 && e->durationSec == dur) return e;
+            if (e->durationSec == 0 && noDuration == nullptr) noDuration = e;
+        }
+        return noDuration != nullptr ? noDuration : list->front();
+    }
 
-            // Collect tracks in playlist order
-            std::unordered_set<std::string> seen;
-            for (auto* tr = playlistNode->getChildByName("TRACK");
-                 tr != nullptr;
-                 tr = tr->getNextElementWithTagName("TRACK"))
+    //------------------------------------------------------------------
+    // Journal bookkeeping -- what save() has to record.  Replayed in the
+    // order clear, deletes, puts, which reproduces any edit sequence: a key
+    // deleted and re-added is both in removedKeys and changed.
+    //------------------------------------------------------------------
+
+    /// A mutable lookup: remember the entry with the hash of its current
+    /// (saved or already pending) state, so the next save() can tell if it
+    /// was edited.  Cleared by every save, so it holds only the entries
+    /// looked up since then.
+    TrackMapEntry* touched(TrackMapEntry* e)
+    {
+        if (e != nullptr && lent.count(e) == 0)
+            lent.emplace(e, recordHash(*e));
+        return e;
+    }
+
+    static juce::int64 recordHash(const TrackMapEntry& e)
+    {
+        return juce::JSON::toString(e.toVar(), true).hashCode64();
+    }
+
+    void markAllChanged()
+    {
+        pendingClear = true;
+        removedKeys.clear();
+        changed.clear();
+        lent.clear();
+        for (auto& [k, e] : entries)
+            changed.insert(&e);
+    }
+
+    static juce::var makeRecord(const char* op)
+    {
+        auto* obj = new juce::DynamicObject();
+        obj->setProperty("op", op);
+        return juce::var(obj);
+    }
+
+    void applyRecord(const juce::var& r)
+    {
+        const auto op = r.getProperty("op", {}).toString();
+        if (op == "put")
+        {
+            TrackMapEntry e;
+            e.fromVar(r.getProperty("entry", {}));
+            if (e.hasValidKey())
             {
-                int key = tr->getIntAttribute("Key", 0);
-                auto it = trackById.find(key);
-                if (it != trackById.end())
-                {
-                    auto k = it->second.key();
-                    if (!seen.count(k))
-                    {
-                        seen.insert(k);
-                        result.push_back(it->second);
-                    }
-                }
+                auto key = e.key();
+                store(std::move(key), std::move(e));
             }
-            return result;
         }
-
-        // No playlist specified — return all tracks from COLLECTION
-        std::unordered_set<std::string> seen;
-        for (auto& [id, entry] : trackById)
+        else if (op == "del")
         {
-            auto k = entry.key();
-            if (seen.count(k)) continue;
-            seen.insert(k);
-            result.push_back(std::move(entry));
+            auto it = entries.find(r.getProperty("key", {}).toString().toStdString());
+            if (it != entries.end()) erase(it);
+        }
+        else if (op == "clear")
+        {
+            clear();
         }
-        return result;
     }
 
-    /// List available playlist names in a rekordbox XML file
-    static juce::StringArray listRekordboxPlaylists(const juce::File& file)
+    //------------------------------------------------------------------
+    // trackmap.bin load cache (BinarySnapshot)
+    //------------------------------------------------------------------
+    static constexpr uint32_t kBinaryKind   = BinarySnapshot::fourCC("TMAP");
+    static constexpr uint32_t kBinarySchema = 1;   // TrackMapEntry::writeBinary layout
+
+    /// Folds the journal into a new trackmap.json (+ trackmap.bin) on the
+    /// journal's worker thread
+    void compactInBackground() const
+    {
+        auto copy = std::make_shared<std::vector<TrackMapEntry>>();
+        copy->reserve(entries.size());
+        for (auto& [k, entry] : entries)
+            copy->push_back(entry);
+        getJournal().compact([copy] { return snapshotVarOf(*copy); },
+                             [copy](const juce::File& json) { writeBinarySnapshot(json, *copy); });
+    }
+
+    static void writeBinarySnapshot(const juce::File& json, const std::vector<TrackMapEntry>& all)
     {
-        juce::StringArray result;
-        auto xml = juce::XmlDocument::parse(file);
-        if (!xml || xml->getTagName() != "DJ_PLAYLISTS") return result;
+        BinarySnapshot::Writer w;
+        for (auto& entry : all)
+            entry.writeBinary(w);
+        if (!w.writeFor(json, kBinaryKind, kBinarySchema, (uint32_t)all.size()))
+            DBG("TrackMap: failed to write " << BinarySnapshot::cacheFileFor(json).getFullPathName());
+    }
 
-        auto* playlists = xml->getChildByName("PLAYLISTS");
-        if (!playlists) return result;
+    /// Fills `entries` from trackmap.bin; false (and nothing loaded) when
+    /// the cache is missing, stale or damaged.
+    bool loadBinarySnapshot(TrackMapJournal& j)
+    {
+        j.waitForCompaction();   // its snapshot and cache must be complete
+        BinarySnapshot::Reader r(getTrackMapFile(), kBinaryKind, kBinarySchema);
+        if (!r.isValid()) return false;
 
-        // Recursive scan for Type=1 (playlist) nodes with entries.
-        // ROOT is always the top-level folder in rekordbox — skip it in the path.
-        std::function<void(juce::XmlElement*, const juce::String&)> scan =
-            [&](juce::XmlElement* node, const juce::String& path)
+        entries.reserve(r.getCount());
+        for (uint32_t i = 0; i < r.getCount() && r.isValid(); ++i)
         {
-            for (auto* child = node->getFirstChildElement();
-                 child != nullptr; child = child->getNextElement())
+            TrackMapEntry e;
+            e.readBinary(r);
+            if (e.hasValidKey())
             {
-                if (child->getTagName() != "NODE") continue;
-                juce::String name = child->getStringAttribute("Name");
-                int type = child->getIntAttribute("Type", -1);
-
-                if (type == 1)  // playlist
-                {
-                    int entries = child->getIntAttribute("Entries", 0);
-                    if (entries > 0)
-                        result.add(path.isEmpty() ? name : path + " / " + name);
-                }
-                else if (type == 0)  // folder
-                {
-                    // Skip ROOT — it's always the top-level node in rekordbox XML
-                    juce::String childPath = name.equalsIgnoreCase("ROOT") ? path
-                        : (path.isEmpty() ? name : path + " / " + name);
-                    scan(child, childPath);
-                }
+                auto key = e.key();
+                store(std::move(key), std::move(e));
             }
-        };
-        scan(playlists, "");
-        return result;
+        }
+
+        if (r.isComplete()) return true;
+
+        DBG("TrackMap: trackmap.bin is damaged, falling back to trackmap.json");
+        entries.clear();
+        byArtistTitle.clear();
+        matchIndex.reset();
+        return false;
+    }
+
+    static juce::var snapshotVarOf(const std::vector<TrackMapEntry>& all)
+    {
+        auto* root = new juce::DynamicObject();
+        root->setProperty("version", 2);  // v2 = artist|title keyed
+
+        juce::Array<juce::var> arr;
+        arr.ensureStorageAllocated((int)all.size());
+        for (auto& entry : all)
+            arr.add(entry.toVar());
+
+        root->setProperty("tracks", arr);
+        return juce::var(root);
+    }
+
+    TrackMapJournal& getJournal() const
+    {
+        if (journal == nullptr)
+            journal = std::make_unique<TrackMapJournal>(getTrackMapFile());
+        return *journal;
     }
 
-private:
     std::unordered_map<std::string, TrackMapEntry> entries;
+    std::unordered_map<TrackKey, std::vector<TrackMapEntry*>,
+                       TrackKey::Hasher, TrackKey::SameTrack> byArtistTitle;
     uint64_t generation = 0;
+
+    // Fuzzy matching (lazy; kept in step by index() / unindex())
+    mutable std::unique_ptr<TrackMatchIndex> matchIndex;
+    mutable std::unordered_map<std::string, std::string> fuzzyMemo;   // query text -> matched identity ("" = none)
+    float autoMatchThreshold = 0.9f;
+
+    // Persistence state -- mutable so save() stays const for AppSettings::save()
+    mutable std::unique_ptr<TrackMapJournal> journal;
+    mutable std::unordered_set<const TrackMapEntry*> changed;
+    mutable std::unordered_map<const TrackMapEntry*, juce::int64> lent;   // see touched()
+    mutable std::unordered_set<std::string> removedKeys;
+    mutable bool pendingClear = false;
 };
 
 //==============================================================================
@@ -882,8 +1402,7 @@ public:
             arr.add(preset.toVar());
 
         root->setProperty("presets", arr);
-        juce::var jsonVar(root);
-        getPresetFile().replaceWithText(juce::JSON::toString(jsonVar));
+        juce::SharedResourcePointer<SettingsWriter>()->write(getPresetFile(), juce::var(root));
     }
 
     bool load()
@@ -987,6 +1506,9 @@ struct EngineSettings
     int  artnetMixerUniverse = 0;   // 0-32767
     int  artnetTriggerUniverse = 1; // 0-32767 (separate from mixer, default 1)
     int  artnetDmxInterface = -1;  // -1 = All Interfaces (Broadcast), 0+ = specific NIC
+    int  dmxProtocol = 0;          // 0 = Art-Net, 1 = sACN (E1.31), 2 = both
+    int  sacnPriority = 100;       // 0-200
+    int  sacnSyncUniverse = 0;     // 0 = off, 1-63999
     bool linkEnabled = false;
     juce::String audioInputDevice = "";
     juce::String audioInputType = "";
@@ -1001,6 +1523,11 @@ struct EngineSettings
     int  tcnetLayer = 0;               // TCNet layer index 0-3 (Layer 1-4)
     bool hippoOutEnabled = false;      // Hippotizer timecode output
     juce::String hippotizerDestIp = "255.255.255.255";  // Hippotizer destination IP
+    bool oscTcOutEnabled = false;      // OSC timecode stream output
+    juce::String oscTcDestIp = "127.0.0.1";
+    int  oscTcDestPort = 9900;
+    int  oscTcRateHz = 100;            // 1-1000 Hz
+    bool oscTcTimetags = false;        // wrap messages in timetagged bundles
 
     // On-air gate: engine only active when CDJ is flagged on-air by the DJM
     bool onAirGateEnabled = false;
@@ -1082,6 +1609,9 @@ struct EngineSettings
         obj->setProperty("artnetMixerUniverse", artnetMixerUniverse);
         obj->setProperty("artnetTriggerUniverse", artnetTriggerUniverse);
         obj->setProperty("artnetDmxInterface", artnetDmxInterface);
+        obj->setProperty("dmxProtocol", dmxProtocol);
+        obj->setProperty("sacnPriority", sacnPriority);
+        obj->setProperty("sacnSyncUniverse", sacnSyncUniverse);
         obj->setProperty("linkEnabled", linkEnabled);
         obj->setProperty("audioInputDevice", audioInputDevice);
         obj->setProperty("audioInputType", audioInputType);
@@ -1097,6 +1627,11 @@ struct EngineSettings
             obj->setProperty("onAirGateEnabled", onAirGateEnabled);
         obj->setProperty("hippoOutEnabled", hippoOutEnabled);
         obj->setProperty("hippotizerDestIp", hippotizerDestIp);
+        obj->setProperty("oscTcOutEnabled", oscTcOutEnabled);
+        obj->setProperty("oscTcDestIp", oscTcDestIp);
+        obj->setProperty("oscTcDestPort", oscTcDestPort);
+        obj->setProperty("oscTcRateHz", oscTcRateHz);
+        obj->setProperty("oscTcTimetags", oscTcTimetags);
         obj->setProperty("midiOutputDevice", midiOutputDevice);
         obj->setProperty("artnetOutputInterface", artnetOutputInterface);
         obj->setProperty("audioOutputDevice", audioOutputDevice);
@@ -1196,6 +1731,9 @@ struct EngineSettings
         artnetMixerUniverse  = juce::jlimit(0, 32767, getInt("artnetMixerUniverse", 0));
         artnetTriggerUniverse = juce::jlimit(0, 32767, getInt("artnetTriggerUniverse", 1));
         artnetDmxInterface   = getInt("artnetDmxInterface", -1);  // -1 = All Interfaces
+        dmxProtocol          = juce::jlimit(0, 2, getInt("dmxProtocol", 0));
+        sacnPriority         = juce::jlimit(0, 200, getInt("sacnPriority", 100));
+        sacnSyncUniverse     = juce::jlimit(0, 63999, getInt("sacnSyncUniverse", 0));
         linkEnabled          = getBool("linkEnabled", getBool("tcnetLinkEnabled", false));
         audioInputDevice     = getString("audioInputDevice");
         audioInputType       = getString("audioInputType");
@@ -1210,6 +1748,11 @@ struct EngineSettings
         onAirGateEnabled     = getBool("onAirGateEnabled", false);
         hippoOutEnabled      = getBool("hippoOutEnabled", false);
         hippotizerDestIp     = getString("hippotizerDestIp", "255.255.255.255");
+        oscTcOutEnabled      = getBool("oscTcOutEnabled", false);
+        oscTcDestIp          = getString("oscTcDestIp", "127.0.0.1");
+        oscTcDestPort        = juce::jlimit(1, 65535, getInt("oscTcDestPort", 9900));
+        oscTcRateHz          = juce::jlimit(1, 1000, getInt("oscTcRateHz", 100));
+        oscTcTimetags        = getBool("oscTcTimetags", false);
         midiOutputDevice     = getString("midiOutputDevice");
         artnetOutputInterface = getInt("artnetOutputInterface", 0);
         audioOutputDevice    = getString("audioOutputDevice");
@@ -1277,6 +1820,9 @@ struct AppSettings
     // TCNet output (global network interface, enable is per-engine in EngineSettings)
     int  tcnetInterface = -1;    // -1 = all interfaces (broadcast 255.255.255.255)
 
+    // Art-Net DMX: unicast to nodes discovered via ArtPoll (global, shared discovery)
+    bool artnetUnicast = true;
+
     // OSC Input (global listener for generator remote control)
     bool oscInputEnabled = false;
     int  oscInputPort = 9800;
@@ -1298,6 +1844,13 @@ struct AppSettings
     // SLQ View layout state
     bool slqViewHorizontal  = false;
 
+    // Optional OpenGL compositing (GpuCompositor); STC_GPU_COMPOSITING overrides
+    bool gpuCompositing = false;
+
+    // Similarity (0-1) needed to bind a track to a differently-tagged
+    // TrackMap entry automatically (TrackMap::findBestMatchFuzzy); 0 = off
+    float trackAutoMatchThreshold = 0.9f;
+
     // Per-engine settings
     std::vector<EngineSettings> engines;
 
@@ -1310,6 +1863,18 @@ struct AppSettings
     // Track map (Track ID -> timecode offset mapping)
     TrackMap trackMap;
 
+    // Player track references -> resolved metadata (trackbindings.json),
+    // saved by the engines as they learn
+    TrackBindings trackBindings;
+
+    /// Blocks until queued settings / preset writes are on disk (shutdown).
+    void flushPendingWrites() const { settingsWriter->flush(); }
+
+    /// Settings, preset and TrackBindings saves are dropped between these
+    /// two calls (show package restore writing the files underneath)
+    void suspendWrites() const { settingsWriter->suspend(); }
+    void resumeWrites() const  { settingsWriter->resume(); }
+
     // Generator presets (named timecode ranges for the internal generator)
     GeneratorPresetMap generatorPresets;
 
@@ -1337,6 +1902,7 @@ struct AppSettings
         obj->setProperty("proDJLinkInterface", proDJLinkInterface);
         obj->setProperty("stageLinQInterface", stageLinQInterface);
         obj->setProperty("tcnetInterface", tcnetInterface);
+        obj->setProperty("artnetUnicast", artnetUnicast);
         obj->setProperty("oscInputEnabled", oscInputEnabled);
         obj->setProperty("oscInputPort", oscInputPort);
         obj->setProperty("oscInputInterface", oscInputInterface);
@@ -1351,14 +1917,16 @@ struct AppSettings
         obj->setProperty("pdlViewHorizontal", pdlViewHorizontal);
         obj->setProperty("pdlViewShowMixer",  pdlViewShowMixer);
         obj->setProperty("slqViewHorizontal", slqViewHorizontal);
+        obj->setProperty("gpuCompositing", gpuCompositing);
+        obj->setProperty("trackAutoMatchThreshold", trackAutoMatchThreshold);
 
         juce::Array<juce::var> engineArray;
         for (auto& eng : engines)
             engineArray.add(eng.toVar());
         obj->setProperty("engines", engineArray);
 
-        juce::var jsonVar(obj.release());
-        getSettingsFile().replaceWithText(juce::JSON::toString(jsonVar));
+        // Serialised and written on the SettingsWriter thread
+        settingsWriter->write(getSettingsFile(), juce::var(obj.release()));
 
         // TrackMap is saved to its own file (trackmap.json)
         trackMap.save();
@@ -1405,6 +1973,7 @@ struct AppSettings
             proDJLinkInterface    = getInt("proDJLinkInterface", 0);
             stageLinQInterface    = getInt("stageLinQInterface", 0);
             tcnetInterface        = getInt("tcnetInterface", -1);
+            artnetUnicast         = getInt("artnetUnicast", 1) != 0;
             oscInputEnabled       = getInt("oscInputEnabled", 0) != 0;
             oscInputPort          = juce::jlimit(1, 65535, getInt("oscInputPort", 9800));
             oscInputInterface     = getInt("oscInputInterface", 0);
@@ -1419,6 +1988,10 @@ struct AppSettings
             pdlViewHorizontal  = getInt("pdlViewHorizontal", 0) != 0;
             pdlViewShowMixer   = getInt("pdlViewShowMixer", 1) != 0;
             slqViewHorizontal  = getInt("slqViewHorizontal", 0) != 0;
+            gpuCompositing     = getInt("gpuCompositing", 0) != 0;
+            trackAutoMatchThreshold = juce::jlimit(0.0f, 1.0f,
+                                                   (float)getDouble("trackAutoMatchThreshold", 0.9));
+            trackMap.setAutoMatchThreshold(trackAutoMatchThreshold);
 
             engines.clear();
             auto* engArray = obj->getProperty("engines").getArray();
@@ -1439,6 +2012,7 @@ struct AppSettings
 
             // TrackMap is loaded from its own file (trackmap.json)
             trackMap.load();
+            trackBindings.load();
             generatorPresets.load();
             return true;
         }
@@ -1446,6 +2020,7 @@ struct AppSettings
         {
             bool ok = migrateFromV1(obj);
             trackMap.load();  // load track map even from v1 migration
+            trackBindings.load();
             generatorPresets.load();
             return ok;
         }
@@ -1533,34 +2108,17 @@ private:
 
 public:
     //------------------------------------------------------------------
-    // Full configuration export/import (backup/restore)
-    //
-    // Bundles settings.json + trackmap.json + mixermap.json into a
-    // single JSON file.  Import overwrites all three and reloads.
+    // Single-file JSON backup (stc_backup_version 1) -- settings.json +
+    // trackmap.json + mixermap.json + generator presets in one JSON file.
+    // Superseded by show packages for export; still accepted on import.
     //------------------------------------------------------------------
-    static juce::var readJsonFile(const juce::File& f)
-    {
-        if (!f.existsAsFile()) return {};
-        return juce::JSON::parse(f.loadFileAsString());
-    }
-
-    juce::var buildExportBundle() const
-    {
-        auto dir = getSettingsFile().getParentDirectory();
-        auto* root = new juce::DynamicObject();
-        root->setProperty("stc_backup_version", 1);
-        root->setProperty("settings", readJsonFile(getSettingsFile()));
-        root->setProperty("trackmap", readJsonFile(dir.getChildFile("trackmap.json")));
-        root->setProperty("mixermap", readJsonFile(dir.getChildFile("mixermap.json")));
-        root->setProperty("generator_presets", readJsonFile(dir.getChildFile("generator_presets.json")));
-        return juce::var(root);
-    }
-
     bool applyImportBundle(const juce::var& bundle)
     {
         auto* obj = bundle.getDynamicObject();
         if (!obj) return false;
 
+        flushPendingWrites();   // a queued save must not overwrite the restore
+
         auto dir = getSettingsFile().getParentDirectory();
         auto settingsVar = obj->getProperty("settings");
         auto trackmapVar = obj->getProperty("trackmap");
@@ -1571,7 +2129,7 @@ public:
         if (!settingsVar.isVoid())
             getSettingsFile().replaceWithText(juce::JSON::toString(settingsVar));
         if (!trackmapVar.isVoid())
-            dir.getChildFile("trackmap.json").replaceWithText(juce::JSON::toString(trackmapVar));
+            trackMap.replaceSnapshot(trackmapVar);   // also drops the journal
         if (!mixermapVar.isVoid())
             dir.getChildFile("mixermap.json").replaceWithText(juce::JSON::toString(mixermapVar));
         if (!presetsVar.isVoid())
@@ -1579,4 +2137,139 @@ public:
 
         return true;
     }
+
+    //------------------------------------------------------------------
+    // Show package (.stcshow) -- everything a spare machine needs to run
+    // the show without the players: the configuration files above plus
+    // the waveform / artwork / ANLZ cache of every mapped track.
+    //
+    // collectShowPackage() snapshots the in-memory state (message thread);
+    // writeShowPackage() and restoreShowPackage() do the file work on a
+    // ShowPackageJob thread.  Suspend writes (suspendWrites()) for the
+    // whole restore; afterwards call applyShowPackageRestore() and load()
+    // on the message thread, then resumeWrites().
+    //------------------------------------------------------------------
+    static constexpr int kShowPackageVersion = 1;
+
+    struct ShowPackageContents
+    {
+        juce::var trackmap;                    // TrackMap::toSnapshotVar()
+        std::vector<std::string> trackKeys;    // WaveformCache keys of the mapped tracks, every known duration
+    };
+
+    /// Settings-directory files carried verbatim by a show package
+    static juce::StringArray getShowPackageConfigFiles()
+    {
+        return { "settings.json", "mixermap.json", "slq_mixermap.json",
+                 "generator_presets.json", "trackbindings.json" };
+    }
+
+    ShowPackageContents collectShowPackage() const
+    {
+        flushPendingWrites();   // config files are packed from disk
+
+        ShowPackageContents c;
+        c.trackmap = trackMap.toSnapshotVar();   // trackmap.json lacks the journal
+
+        // The cache is keyed with the duration the player reported
+        // (artist|title|duration), which an entry saved without one -- or
+        // with another one -- does not name.  Pack every duration known for
+        // the track: its TrackMap entries, its learned bindings, and none.
+        std::unordered_map<std::string, std::set<int>> durations;   // artist|title -> durations
+        for (auto& [k, entry] : trackMap.getEntries())
+        {
+            auto& d = durations[TrackMapEntry::makeKey(entry.artist, entry.title)];
+            d.insert(0);
+            d.insert(entry.durationSec);
+        }
+        trackBindings.forEach([&durations](const TrackBindings::Binding& b)
+        {
+            auto it = durations.find(TrackMapEntry::makeKey(b.artist, b.title));
+            if (it != durations.end() && b.durationSec > 0)
+                it->second.insert(b.durationSec);
+        });
+
+        c.trackKeys.reserve(durations.size());
+        for (auto& [base, set] : durations)
+            for (int d : set)
+                c.trackKeys.push_back(d > 0 ? base + "|" + std::to_string(d) : base);
+        return c;
+    }
+
+    static bool writeShowPackage(const ShowPackageContents& c, const juce::File& target,
+                                 const ShowPackageProgressFn& progress)
+    {
+        ShowPackageWriter w(target);
+        if (!w.isOk()) return false;
+
+        auto* manifest = new juce::DynamicObject();
+        manifest->setProperty("stc_show_version", kShowPackageVersion);
+        manifest->setProperty("created", juce::Time::getCurrentTime().toISO8601(true));
+        if (auto* tracks = c.trackmap.getProperty("tracks", {}).getArray())
+            manifest->setProperty("tracks", tracks->size());
+        w.addJson("stc_show.json", juce::var(manifest));
+
+        const auto dir = getSettingsFile().getParentDirectory();
+        for (auto& name : getShowPackageConfigFiles())
+        {
+            auto f = dir.getChildFile(name);
+            if (f.existsAsFile()) w.addFile(name, f);
+        }
+        w.addJson("trackmap.json", c.trackmap);
+        if (progress && !progress(0.05f)) return false;
+
+        for (size_t i = 0; i < c.trackKeys.size(); ++i)
+        {
+            for (auto& f : WaveformCache::getFilesForTrack(c.trackKeys[i]))
+                w.addFile("waveform_cache/" + f.getFileName(), f);
+
+            if ((i & 63) == 0 && progress
+                && !progress(0.05f + 0.9f * (float)i / (float)c.trackKeys.size()))
+                return false;
+        }
+        return w.finish();
+    }
+
+    /// What restoreShowPackage() leaves for the message thread
+    struct ShowPackageRestore
+    {
+        juce::var trackmap;
+        bool configRestored = false;   // config files replaced (apply even if cancelled later)
+        int cacheFiles = 0;
+    };
+
+    /// Writes the package's configuration files and waveform cache into
+    /// place (the cache in parallel).  False if `package` is not a show
+    /// package or was cancelled.
+    static bool restoreShowPackage(const juce::File& package, ShowPackageRestore& result,
+                                   const ShowPackageProgressFn& progress)
+    {
+        ShowPackageReader r(package);
+        const auto manifest = r.readJson("stc_show.json");
+        if ((int)manifest.getProperty("stc_show_version", 0) < 1) return false;
+
+        result.trackmap = r.readJson("trackmap.json");
+        if (progress && !progress(0.1f)) return false;
+
+        const auto dir = getSettingsFile().getParentDirectory();
+        for (auto& name : getShowPackageConfigFiles())
+            if (r.hasEntry(name))
+                r.extract(name, dir.getChildFile(name));
+        result.configRestored = true;
+
+        result.cacheFiles = r.extractAll("waveform_cache/", WaveformCache::getCacheDir(),
+            [&progress](float p) { return !progress || progress(0.2f + 0.8f * p); });
+        return result.cacheFiles >= 0;
+    }
+
+    /// Message-thread half of a restore: replaces the TrackMap snapshot.
+    /// Call load() afterwards.
+    void applyShowPackageRestore(const ShowPackageRestore& restored)
+    {
+        if (!restored.trackmap.isVoid())
+            trackMap.replaceSnapshot(restored.trackmap);   // also drops the journal
+    }
+
+private:
+    juce::SharedResourcePointer<SettingsWriter> settingsWriter;
 };
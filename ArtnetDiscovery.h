@@ -0,0 +1,343 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+
+#pragma once
+#include <JuceHeader.h>
+#include "NetworkUtils.h"
+#include <atomic>
+#include <map>
+#include <vector>
+#include <cstring>
+
+//==============================================================================
+// ArtnetDiscovery -- ArtPoll / ArtPollReply node discovery (Art-Net 4).
+//
+// Polls every 2.5s on the directed broadcast of every interface and keeps a
+// table of responding nodes with the output universes (port-addresses) each
+// one subscribes to.  ArtnetOutput asks getTargets() per DMX frame and
+// unicasts to the subscribed nodes, falling back to broadcast when none are
+// known -- or when so many are subscribed that broadcast is cheaper.
+// ArtTimeCode stays broadcast: nodes do not subscribe to timecode.
+//
+// Replies go to UDP 6454 on the poller.  The discovery thread listens there
+// itself while the port is free; while an ArtnetInput holds 6454 (Art-Net
+// timecode input) the listener is released and ArtnetInput forwards
+// OpPollReply packets to handlePacket().  Replies sent back to the poll's
+// source port arrive on the poll socket either way.
+//
+// Shared across all engines (owned by MainComponent, like ProDJLinkInput).
+// Node table is guarded by a CriticalSection; getTargets() is called from
+// the engine tick, the table is written by the discovery thread.  The 6454
+// listener belongs to the discovery thread: other threads only shutdown()
+// it (which frees the port and wakes the thread), never wait on its lock.
+//==============================================================================
+class ArtnetDiscovery : private juce::Thread
+{
+public:
+    static constexpr int    kPort              = 6454;
+    static constexpr double kPollIntervalMs    = 2500.0;
+    static constexpr double kNodeTimeoutMs     = 8000.0;   // ~3 missed polls
+    static constexpr int    kMaxUnicastTargets = 16;       // above this, broadcast
+
+    struct Node
+    {
+        juce::String ip;
+        int          bindIndex = 0;
+        juce::String shortName;
+        juce::String longName;
+        juce::Array<int> outputUniverses;   // 15-bit port-addresses
+        double       lastSeenMs = 0.0;
+    };
+
+    ArtnetDiscovery() : Thread("ArtNet Discovery") {}
+    ~ArtnetDiscovery() override { stop(); }
+
+    //==============================================================================
+    bool start()
+    {
+        stop();
+
+        interfaces = ::getNetworkInterfaces();
+
+        pollSocket = std::make_unique<juce::DatagramSocket>(true);   // broadcast enabled
+        if (!pollSocket->bindToPort(0))
+        {
+            pollSocket = nullptr;
+            return false;
+        }
+
+        {
+            const juce::ScopedLock sl(nodeLock);
+            nodes.clear();
+            rebuildTargetsLocked();
+        }
+
+        isRunningFlag.store(true, std::memory_order_relaxed);
+        startThread();
+        return true;
+    }
+
+    void stop()
+    {
+        isRunningFlag.store(false, std::memory_order_relaxed);
+
+        if (pollSocket != nullptr)
+            pollSocket->shutdown();
+        shutdownListenSocket();
+
+        if (isThreadRunning())
+            stopThread(1000);
+
+        pollSocket = nullptr;
+        listenSocket = nullptr;   // thread has exited: no other owner
+
+        // Forget the nodes so outputs fall back to broadcast
+        const juce::ScopedLock sl(nodeLock);
+        nodes.clear();
+        rebuildTargetsLocked();
+    }
+
+    bool getIsRunning() const { return isRunningFlag.load(std::memory_order_relaxed); }
+
+    //==============================================================================
+    /// ArtnetInput calls these around binding / releasing UDP 6454 so the
+    /// discovery listener never competes with timecode input for the port.
+    /// shutdown() closes the handle, so 6454 is free on return; the
+    /// discovery thread deletes the socket on its next pass.
+    void acquireListenPort()
+    {
+        inputsOnPort.fetch_add(1, std::memory_order_relaxed);
+        shutdownListenSocket();
+    }
+
+    void releaseListenPort()
+    {
+        inputsOnPort.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// Parse a packet received on 6454 (discovery thread or ArtnetInput).
+    /// Ignores everything but OpPollReply.
+    void handlePacket(const uint8_t* data, int size)
+    {
+        if (size < kMinPollReplySize || std::memcmp(data, "Art-Net", 8) != 0)
+            return;
+        if (data[8] != 0x00 || data[9] != 0x21)   // OpPollReply 0x2100, little-endian
+            return;
+
+        Node node;
+        node.ip = juce::String((int)data[10]) + "." + juce::String((int)data[11]) + "."
+                + juce::String((int)data[12]) + "." + juce::String((int)data[13]);
+        if (node.ip == "0.0.0.0")
+            return;
+
+        node.shortName = readName(data + 26, 18);
+        node.longName  = readName(data + 44, 64);
+        node.bindIndex = size > 211 ? data[211] : 0;
+
+        const int net = data[18] & 0x7F;
+        const int sub = data[19] & 0x0F;
+        const int numPorts = juce::jmin(4, (int)data[173]);
+        for (int i = 0; i < numPorts; ++i)
+        {
+            if ((data[174 + i] & 0x80) == 0)     // port can't output from Art-Net
+                continue;
+            node.outputUniverses.addIfNotAlreadyThere((net << 8) | (sub << 4) | (data[190 + i] & 0x0F));
+        }
+        node.lastSeenMs = juce::Time::getMillisecondCounterHiRes();
+
+        const auto key = node.ip + "#" + juce::String(node.bindIndex);
+        const juce::ScopedLock sl(nodeLock);
+        auto it = nodes.find(key);
+        const bool changed = it == nodes.end() || it->second.outputUniverses != node.outputUniverses;
+        nodes[key] = std::move(node);
+        if (changed)
+            rebuildTargetsLocked();
+    }
+
+    //==============================================================================
+    /// Unicast destinations for a universe.  Returns false (caller should
+    /// broadcast) when no node subscribes or too many do.  `out` is reused
+    /// by the caller so steady-state lookups don't allocate.
+    bool getTargets(int universe, juce::Array<juce::String>& out) const
+    {
+        out.clearQuick();
+        const juce::ScopedLock sl(nodeLock);
+        auto it = targets.find(universe);
+        if (it == targets.end() || it->second.size() > kMaxUnicastTargets)
+            return false;
+        out.addArray(it->second);
+        return !out.isEmpty();
+    }
+
+    std::vector<Node> getNodes() const
+    {
+        const juce::ScopedLock sl(nodeLock);
+        std::vector<Node> result;
+        result.reserve(nodes.size());
+        for (auto& [key, n] : nodes)
+            result.push_back(n);
+        return result;
+    }
+
+    int getNumNodes() const
+    {
+        const juce::ScopedLock sl(nodeLock);
+        return (int)nodes.size();
+    }
+
+private:
+    static constexpr int kMinPollReplySize = 207;   // through MAC; later fields optional
+    static constexpr int kSocketWaitMs      = 5;     // per socket, per loop pass
+    static constexpr int kMaxReadsPerWait   = 64;
+
+    //==============================================================================
+    void run() override
+    {
+        double nextPoll = 0.0;
+        uint8_t buffer[600];
+
+        while (!threadShouldExit() && isRunningFlag.load(std::memory_order_relaxed))
+        {
+            const double now = juce::Time::getMillisecondCounterHiRes();
+            if (now >= nextPoll)
+            {
+                openListenSocketIfFree();
+                sendPoll();
+                expireNodes(now);
+                nextPoll = now + kPollIntervalMs;
+            }
+
+            auto* sock = pollSocket.get();
+            if (sock == nullptr)
+                break;
+            drainSocket(*sock, buffer, (int)sizeof(buffer));
+
+            // Only this thread assigns or deletes listenSocket, so it is read
+            // here without the lock; a concurrent shutdown() just makes the
+            // wait return early and the read fail.
+            if (listenSocket != nullptr)
+            {
+                if (inputsOnPort.load(std::memory_order_relaxed) > 0)
+                    closeListenSocket();
+                else
+                    drainSocket(*listenSocket, buffer, (int)sizeof(buffer));
+            }
+        }
+
+        closeListenSocket();
+    }
+
+    /// Short wait so a quiet socket doesn't delay the other one, then read
+    /// what is already queued (bounded, so a reply storm can't starve polls).
+    void drainSocket(juce::DatagramSocket& sock, uint8_t* buffer, int bufferSize)
+    {
+        if (!sock.waitUntilReady(true, kSocketWaitMs))
+            return;
+        for (int i = 0; i < kMaxReadsPerWait; ++i)
+        {
+            const int n = sock.read(buffer, bufferSize, false);
+            if (n <= 0) break;
+            handlePacket(buffer, n);
+        }
+    }
+
+    void shutdownListenSocket()
+    {
+        const juce::ScopedLock sl(listenLock);   // only guards the pointer; never held across a wait
+        if (listenSocket != nullptr)
+            listenSocket->shutdown();
+    }
+
+    void closeListenSocket()
+    {
+        std::unique_ptr<juce::DatagramSocket> old;   // destroyed after the lock is dropped
+        {
+            const juce::ScopedLock sl(listenLock);
+            old = std::move(listenSocket);
+        }
+    }
+
+    void openListenSocketIfFree()
+    {
+        // Bind under the lock so acquireListenPort() can't slip in between
+        // the inputsOnPort check and the pointer being published.
+        const juce::ScopedLock sl(listenLock);
+        if (listenSocket != nullptr || inputsOnPort.load(std::memory_order_relaxed) > 0)
+            return;
+
+        auto s = std::make_unique<juce::DatagramSocket>(false);
+        if (s->bindToPort(kPort))
+            listenSocket = std::move(s);
+    }
+
+    void sendPoll()
+    {
+        // ArtPoll, Art-Net 4 layout (22 bytes).  Flags bit 1: send
+        // ArtPollReply whenever node conditions change, not only when polled.
+        uint8_t packet[22] = {};
+        std::memcpy(packet, "Art-Net", 8);
+        packet[8]  = 0x00;  packet[9]  = 0x20;   // OpPoll 0x2000, little-endian
+        packet[10] = 0x00;  packet[11] = 0x0E;   // ProtVer 14
+        packet[12] = 0x02;                       // Flags
+        packet[13] = 0x00;                       // DiagPriority (diagnostics off)
+
+        if (interfaces.isEmpty())
+        {
+            pollSocket->write("255.255.255.255", kPort, packet, sizeof(packet));
+            return;
+        }
+        for (auto& ni : interfaces)
+            pollSocket->write(ni.broadcast, kPort, packet, sizeof(packet));
+    }
+
+    void expireNodes(double now)
+    {
+        const juce::ScopedLock sl(nodeLock);
+        bool changed = false;
+        for (auto it = nodes.begin(); it != nodes.end();)
+        {
+            if (now - it->second.lastSeenMs > kNodeTimeoutMs)
+            {
+                it = nodes.erase(it);
+                changed = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        if (changed)
+            rebuildTargetsLocked();
+    }
+
+    /// universe -> node IPs (one entry per IP even for multi-bind nodes).
+    void rebuildTargetsLocked()
+    {
+        targets.clear();
+        for (auto& [key, n] : nodes)
+            for (int u : n.outputUniverses)
+                targets[u].addIfNotAlreadyThere(n.ip);
+    }
+
+    static juce::String readName(const uint8_t* p, size_t maxLen)
+    {
+        size_t len = 0;
+        while (len < maxLen && p[len] != 0) ++len;
+        return juce::String::fromUTF8((const char*)p, (int)len);
+    }
+
+    //==============================================================================
+    std::unique_ptr<juce::DatagramSocket> pollSocket;     // ephemeral port
+    std::unique_ptr<juce::DatagramSocket> listenSocket;   // UDP 6454 when free; discovery thread owns, listenLock guards the pointer
+    juce::CriticalSection listenLock;
+    std::atomic<int>  inputsOnPort { 0 };
+    std::atomic<bool> isRunningFlag { false };
+    juce::Array<NetworkInterface> interfaces;
+
+    juce::CriticalSection nodeLock;
+    std::map<juce::String, Node> nodes;                       // key "ip#bindIndex"
+    std::map<int, juce::Array<juce::String>> targets;         // universe -> IPs
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ArtnetDiscovery)
+};
@@ -6,6 +6,7 @@
 #include <JuceHeader.h>
 #include "TimecodeCore.h"
 #include "NetworkUtils.h"
+#include "ArtnetDiscovery.h"
 #include <atomic>
 
 class ArtnetInput : public juce::Thread
@@ -42,6 +43,10 @@ public:
     bool didFallBackToAllInterfaces() const { return bindFellBack.load(std::memory_order_relaxed); }
     int getSelectedInterface() const { return selectedInterface; }
 
+    /// Shared ArtPoll discovery: while bound to 6454 this input owns the port
+    /// and forwards ArtPollReply packets to it.  Set before start().
+    void setDiscovery(ArtnetDiscovery* d) { discovery = d; }
+
     //==============================================================================
     bool start(int interfaceIndex = 0, int port = 6454)
     {
@@ -49,6 +54,12 @@ public:
 
         listenPort = port;
 
+        if (discovery != nullptr && listenPort == ArtnetDiscovery::kPort)
+        {
+            discovery->acquireListenPort();
+            portHeldFor = discovery;
+        }
+
         if (interfaceIndex > 0 && (interfaceIndex - 1) < availableInterfaces.size())
         {
             selectedInterface = interfaceIndex;
@@ -79,12 +90,14 @@ public:
 
         if (bound)
         {
+            forwardTo.store(portHeldFor, std::memory_order_relaxed);
             isRunningFlag.store(true, std::memory_order_relaxed);
             startThread();
             return true;
         }
 
         socket = nullptr;
+        releaseDiscoveryPort();
         return false;
     }
 
@@ -100,6 +113,7 @@ public:
             stopThread(1000);
 
         socket = nullptr;
+        releaseDiscoveryPort();
     }
 
     bool getIsRunning() const { return isRunningFlag.load(std::memory_order_relaxed); }
@@ -164,6 +178,13 @@ private:
             return;
 
         uint16_t opcode = (uint16_t)((uint16_t)data[8] | ((uint16_t)data[9] << 8));
+        if (opcode == 0x2100)
+        {
+            // OpPollReply addressed to us -- discovery can't bind 6454 while we do
+            if (auto* d = forwardTo.load(std::memory_order_relaxed))
+                d->handlePacket(data, size);
+            return;
+        }
         if (opcode != 0x9700)
             return;
 
@@ -216,9 +237,22 @@ private:
                              std::memory_order_relaxed);
     }
 
+    void releaseDiscoveryPort()
+    {
+        forwardTo.store(nullptr, std::memory_order_relaxed);
+        if (portHeldFor != nullptr)
+        {
+            portHeldFor->releaseListenPort();
+            portHeldFor = nullptr;
+        }
+    }
+
     std::unique_ptr<juce::DatagramSocket> socket;
     juce::String bindIp = "0.0.0.0";
     int listenPort = 6454;
+    ArtnetDiscovery* discovery = nullptr;         // message thread
+    ArtnetDiscovery* portHeldFor = nullptr;       // discovery we took 6454 from
+    std::atomic<ArtnetDiscovery*> forwardTo { nullptr };  // read by receive thread
     int selectedInterface = 0;
     std::atomic<bool> isRunningFlag { false };
     std::atomic<bool> bindFellBack { false };
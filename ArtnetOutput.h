@@ -6,6 +6,7 @@
 #include <JuceHeader.h>
 #include "TimecodeCore.h"
 #include "NetworkUtils.h"
+#include "ArtnetDiscovery.h"
 #include <atomic>
 
 #ifdef _WIN32
@@ -122,6 +123,12 @@ public:
     int getSelectedInterface() const { return selectedInterface; }
     uint32_t getSendErrors() const { return sendErrors.load(std::memory_order_relaxed); }
 
+    /// Shared ArtPoll discovery (nullptr = always broadcast DMX).
+    void setDiscovery(ArtnetDiscovery* d) { discovery = d; }
+
+    /// True if the last DMX frame went out unicast to discovered nodes.
+    bool isDmxUnicast() const { return lastDmxUnicast; }
+
     //==============================================================================
     void setTimecode(const Timecode& tc)
     {
@@ -185,6 +192,9 @@ public:
     // Can be called independently of timecode pause state -- mixer data flows
     // regardless of whether timecode is active.
     //
+    // Unicast to the nodes that subscribe to `universe` when discovery knows
+    // any (Art-Net 4 recommendation); otherwise subnet broadcast.
+    //
     // dmxData: up to 512 bytes of DMX channel values (channel 1 at index 0)
     // numChannels: how many channels to send (1-512, will be rounded up to even)
     // universe: Art-Net universe (0-32767, default 0)
@@ -229,6 +239,15 @@ public:
         // DMX data
         std::memcpy(packet + 18, dmxData, (size_t)numChannels);
 
+        lastDmxUnicast = discovery != nullptr && discovery->getTargets(universe, dmxTargets);
+        if (lastDmxUnicast)
+        {
+            for (auto& ip : dmxTargets)
+                if (socket->write(ip, destPort, packet, 18 + numChannels) < 0)
+                    sendErrors.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
         int written = socket->write(broadcastIp, destPort, packet, 18 + numChannels);
         if (written < 0)
             sendErrors.fetch_add(1, std::memory_order_relaxed);
@@ -374,6 +393,9 @@ private:
     std::atomic<double> lastFrameSendTime { 0.0 };
     std::atomic<uint32_t> sendErrors { 0 };
     uint8_t dmxSequence = 0;  // incrementing 1-255 for OpDmx sequencing (message-thread-only currently, but atomic-safe for future use)
+    ArtnetDiscovery* discovery = nullptr;     // message thread (shared, owned by MainComponent)
+    juce::Array<juce::String> dmxTargets;     // reused per DMX frame
+    bool lastDmxUnicast = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ArtnetOutput)
 };
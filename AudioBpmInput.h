@@ -14,6 +14,7 @@
 
 // BTT is pure C with extern "C" wrappers
 #include "BTT.h"
+#include "AudioDeviceHub.h"
 
 class AudioBpmInput : private juce::AudioIODeviceCallback
 {
@@ -38,26 +39,8 @@ public:
         currentDeviceName = devName;
         currentTypeName   = typeName;
 
-        deviceManager.closeAudioDevice();
-        deviceManager.initialise(128, 0, nullptr, false);
-
-        if (typeName.isNotEmpty())
-            deviceManager.setCurrentAudioDeviceType(typeName, false);
-
-        if (auto* type = deviceManager.getCurrentDeviceTypeObject())
-            type->scanForDevices();
-
-        auto setup = deviceManager.getAudioDeviceSetup();
-        setup.inputDeviceName   = devName;
-        setup.outputDeviceName  = "";
-        setup.useDefaultInputChannels  = true;
-        setup.useDefaultOutputChannels = false;
-        if (sampleRate > 0)  setup.sampleRate = sampleRate;
-        if (bufferSize > 0)  setup.bufferSize = bufferSize;
-        auto err = deviceManager.setAudioDeviceSetup(setup, true);
-        if (err.isNotEmpty()) return false;
-
-        auto* device = deviceManager.getCurrentAudioDevice();
+        auto* device = audioHub->attach(this, typeName, devName, AudioDeviceHub::input,
+                                        sampleRate, bufferSize);
         if (!device) return false;
 
         numChannelsAvailable = device->getActiveInputChannels().countNumberOfSetBits();
@@ -83,7 +66,11 @@ public:
             BTT_DEFAULT_ANALYSIS_LATENCY_ONSET_ADJUSTMENT,
             BTT_DEFAULT_ANALYSIS_LATENCY_BEAT_ADJUSTMENT
         );
-        if (!bttInstance) return false;
+        if (!bttInstance)
+        {
+            audioHub->detach(this);
+            return false;
+        }
 
         // Optimise for DJ/electronic music: favour 120 BPM centre, 50-200 range
         btt_set_log_gaussian_tempo_weight_mean(bttInstance, 128.0);
@@ -103,7 +90,7 @@ public:
         // Apply current smoothing settings to BTT
         setSmoothing(smoothing.load(std::memory_order_relaxed));
 
-        deviceManager.addAudioCallback(this);
+        audioHub->start(this);
         isRunningFlag.store(true, std::memory_order_relaxed);
         return true;
     }
@@ -112,8 +99,7 @@ public:
     {
         if (isRunningFlag.load(std::memory_order_relaxed))
         {
-            deviceManager.removeAudioCallback(this);
-            deviceManager.closeAudioDevice();
+            audioHub->detach(this);
             isRunningFlag.store(false, std::memory_order_relaxed);
         }
         if (bttInstance)
@@ -202,7 +188,7 @@ public:
     static constexpr double kMinConfidence = 0.15;
 
 private:
-    juce::AudioDeviceManager deviceManager;
+    juce::SharedResourcePointer<AudioDeviceHub> audioHub;
     juce::String currentDeviceName;
     juce::String currentTypeName;
     std::atomic<bool> isRunningFlag { false };
@@ -0,0 +1,519 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// AudioDeviceHub -- Opens each physical audio device once, for every engine.
+//
+// LtcInput, LtcOutput, AudioThru and AudioBpmInput used to own one
+// juce::AudioDeviceManager each.  With several engines on one interface
+// that meant the same device opened many times -- one callback thread,
+// buffer size and clock per client -- and a hard failure on drivers that
+// accept a single client (ASIO).  Now they attach to this hub instead:
+//
+//   auto* device = audioHub->attach(this, typeName, devName,
+//                                   AudioDeviceHub::input, sampleRate, bufferSize);
+//   ...configure from device...
+//   audioHub->start(this);    // was deviceManager.addAudioCallback(this)
+//   audioHub->detach(this);   // was removeAudioCallback + closeAudioDevice
+//
+// One SharedDevice per type + device name, with one AudioDeviceManager and
+// one IO callback.  It is opened by the first client (whose sample rate and
+// buffer size win -- later clients read the actual values from the device
+// in audioDeviceAboutToStart, as before) and closed when the last client
+// leaves.  Attaching the first output client to a device opened for input
+// only (or vice versa) reopens it full duplex.
+//
+// In the IO callback every client is called in turn:
+//   input  : gets the device's input channels as-is (no copy, read-only)
+//   output : renders into its own scratch buffer, which is then summed
+//            into the device outputs
+// Clients live in a fixed array of atomic pointers: the callback never
+// locks or allocates.  detach() unpublishes the client and waits for an
+// IO callback that may still be using it to finish before returning.
+//
+// The "Null" device type (kNullTypeName) is a clock-driven device with two
+// silent inputs and two discarded outputs, for running engines without
+// audio hardware.
+//
+// attach() / start() / detach(): message thread.
+
+#pragma once
+#include <JuceHeader.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//==============================================================================
+// NullAudioDevice -- paces callbacks on its own thread, like a real device
+//==============================================================================
+class NullAudioDevice : public juce::AudioIODevice,
+                        private juce::Thread
+{
+public:
+    static constexpr int kNumChannels = 2;
+
+    NullAudioDevice(const juce::String& deviceName, const juce::String& typeName)
+        : juce::AudioIODevice(deviceName, typeName),
+          juce::Thread("Null audio device")
+    {}
+
+    ~NullAudioDevice() override { close(); }
+
+    juce::StringArray getOutputChannelNames() override { return { "Out 1", "Out 2" }; }
+    juce::StringArray getInputChannelNames() override  { return { "In 1", "In 2" }; }
+    juce::Array<double> getAvailableSampleRates() override { return { 44100.0, 48000.0, 96000.0 }; }
+    juce::Array<int> getAvailableBufferSizes() override    { return { 64, 128, 256, 512, 1024, 2048 }; }
+    int getDefaultBufferSize() override { return 512; }
+
+    juce::String open(const juce::BigInteger& inputChannels, const juce::BigInteger& outputChannels,
+                      double sampleRate, int bufferSizeSamples) override
+    {
+        close();
+        juce::BigInteger available;
+        available.setRange(0, kNumChannels, true);
+        activeInputs  = inputChannels & available;
+        activeOutputs = outputChannels & available;
+        currentRate = sampleRate > 0 ? sampleRate : 48000.0;
+        currentSize = bufferSizeSamples > 0 ? bufferSizeSamples : getDefaultBufferSize();
+        inputs.setSize(kNumChannels, currentSize);
+        inputs.clear();
+        outputs.setSize(kNumChannels, currentSize);
+        opened = true;
+        return {};
+    }
+
+    void close() override
+    {
+        stop();
+        opened = false;
+    }
+
+    bool isOpen() override { return opened; }
+
+    void start(juce::AudioIODeviceCallback* cb) override
+    {
+        if (!opened || cb == nullptr || callback != nullptr) return;
+        cb->audioDeviceAboutToStart(this);
+        callback = cb;
+        startThread(juce::Thread::Priority::highest);
+    }
+
+    void stop() override
+    {
+        if (callback == nullptr) return;
+        stopThread(1000);
+        auto* cb = callback;
+        callback = nullptr;
+        cb->audioDeviceStopped();
+    }
+
+    bool isPlaying() override { return callback != nullptr; }
+    juce::String getLastError() override { return {}; }
+    int getCurrentBufferSizeSamples() override { return currentSize; }
+    double getCurrentSampleRate() override { return currentRate; }
+    int getCurrentBitDepth() override { return 32; }
+    juce::BigInteger getActiveOutputChannels() const override { return activeOutputs; }
+    juce::BigInteger getActiveInputChannels() const override  { return activeInputs; }
+    int getOutputLatencyInSamples() override { return 0; }
+    int getInputLatencyInSamples() override  { return 0; }
+
+private:
+    void run() override
+    {
+        const int numIns  = activeInputs.countNumberOfSetBits();
+        const int numOuts = activeOutputs.countNumberOfSetBits();
+        const double blockMs = 1000.0 * currentSize / currentRate;
+        double due = juce::Time::getMillisecondCounterHiRes();
+
+        while (!threadShouldExit())
+        {
+            due += blockMs;
+            const double wait = due - juce::Time::getMillisecondCounterHiRes();
+            if (wait > 1.0)
+                juce::Thread::sleep((int)wait);
+            else if (wait < -100.0)
+                due = juce::Time::getMillisecondCounterHiRes();   // fell behind: don't burst
+
+            callback->audioDeviceIOCallbackWithContext(inputs.getArrayOfReadPointers(), numIns,
+                                                       outputs.getArrayOfWritePointers(), numOuts,
+                                                       currentSize, {});
+        }
+    }
+
+    juce::AudioIODeviceCallback* callback = nullptr;
+    juce::BigInteger activeInputs, activeOutputs;
+    juce::AudioBuffer<float> inputs, outputs;
+    double currentRate = 48000.0;
+    int currentSize = 512;
+    bool opened = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NullAudioDevice)
+};
+
+class NullAudioDeviceType : public juce::AudioIODeviceType
+{
+public:
+    static constexpr const char* kDeviceName = "Null Device";
+
+    explicit NullAudioDeviceType(const juce::String& typeName) : juce::AudioIODeviceType(typeName) {}
+
+    void scanForDevices() override {}
+    juce::StringArray getDeviceNames(bool) const override { return { kDeviceName }; }
+    int getDefaultDeviceIndex(bool) const override { return 0; }
+    int getIndexOfDevice(juce::AudioIODevice* device, bool) const override { return device != nullptr ? 0 : -1; }
+    bool hasSeparateInputsAndOutputs() const override { return false; }
+
+    juce::AudioIODevice* createDevice(const juce::String& outputDeviceName,
+                                      const juce::String& inputDeviceName) override
+    {
+        const auto name = outputDeviceName.isNotEmpty() ? outputDeviceName : inputDeviceName;
+        return name == kDeviceName ? new NullAudioDevice(name, getTypeName()) : nullptr;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NullAudioDeviceType)
+};
+
+//==============================================================================
+// AudioDeviceHub
+//==============================================================================
+class AudioDeviceHub
+{
+public:
+    enum Direction { input = 1, output = 2 };
+
+    static constexpr const char* kNullTypeName = "Null";
+    static constexpr int kMaxClientsPerDevice = 32;
+
+    AudioDeviceHub() = default;
+    ~AudioDeviceHub() { jassert(devices.empty()); }   // clients detach before the last holder goes
+
+    /// Attaches `client` to device `deviceName` of `typeName`, opening it if
+    /// no other client has.  `directions` is a combination of Direction.
+    /// sampleRate / bufferSize (0 = device default) only apply when this
+    /// call opens the device.  Returns the running device, or nullptr if
+    /// it could not be opened.  The client is not called until start().
+    /// A client is attached to one device at most; attaching again
+    /// detaches it from the previous one first.
+    juce::AudioIODevice* attach(juce::AudioIODeviceCallback* client,
+                                const juce::String& typeName, const juce::String& deviceName,
+                                int directions, double sampleRate = 0, int bufferSize = 0)
+    {
+        if (client == nullptr || directions == 0) return nullptr;
+        detach(client);
+
+        SharedDevice* shared = nullptr;
+        for (auto& d : devices)
+            if (d->typeName == typeName && d->deviceName == deviceName)
+                shared = d.get();
+
+        if (shared == nullptr)
+        {
+            devices.push_back(std::make_unique<SharedDevice>(typeName, deviceName));
+            shared = devices.back().get();
+        }
+
+        if (!shared->open(directions, sampleRate, bufferSize) || !shared->add(client, directions))
+        {
+            removeIfUnused(shared);
+            return nullptr;
+        }
+        return shared->manager.getCurrentAudioDevice();
+    }
+
+    /// Starts IO callbacks for an attached client (audioDeviceAboutToStart
+    /// first, as addAudioCallback does).
+    void start(juce::AudioIODeviceCallback* client)
+    {
+        for (auto& d : devices)
+            if (d->start(client))
+                return;
+    }
+
+    /// Detaches `client`; when it was the device's last client the device
+    /// is closed.  On return no IO callback is using `client` any more.
+    void detach(juce::AudioIODeviceCallback* client)
+    {
+        for (auto& d : devices)
+        {
+            if (d->remove(client))
+            {
+                removeIfUnused(d.get());
+                return;
+            }
+        }
+    }
+
+    /// Physical devices currently open
+    int getNumOpenDevices() const { return (int)devices.size(); }
+
+private:
+    //==========================================================================
+    class SharedDevice : private juce::AudioIODeviceCallback
+    {
+    public:
+        SharedDevice(const juce::String& type, const juce::String& name)
+            : typeName(type), deviceName(name) {}
+
+        ~SharedDevice() override
+        {
+            if (openDirections != 0)
+            {
+                manager.removeAudioCallback(this);
+                manager.closeAudioDevice();
+            }
+        }
+
+        /// Opens the device for `directions`, or reopens it full duplex
+        /// when a direction is added.
+        bool open(int directions, double sampleRate, int bufferSize)
+        {
+            const int wanted = openDirections | directions;
+            if (wanted == openDirections)
+                return manager.getCurrentAudioDevice() != nullptr;
+
+            if (openDirections == 0)
+            {
+                // Register all device types without opening anything
+                manager.initialise(128, 128, nullptr, false);
+                if (typeName == kNullTypeName)
+                    manager.addAudioDeviceType(std::make_unique<NullAudioDeviceType>(typeName));
+
+                // Switch to requested type WITHOUT auto-opening a device (false)
+                if (typeName.isNotEmpty())
+                    manager.setCurrentAudioDeviceType(typeName, false);
+
+                // Scan so the device name is recognised
+                if (auto* type = manager.getCurrentDeviceTypeObject())
+                    type->scanForDevices();
+            }
+
+            const auto previous = manager.getAudioDeviceSetup();
+            auto setup = previous;
+            setup.inputDeviceName  = (wanted & input)  != 0 ? deviceName : juce::String();
+            setup.outputDeviceName = (wanted & output) != 0 ? deviceName : juce::String();
+            setup.useDefaultInputChannels  = (wanted & input)  != 0;
+            setup.useDefaultOutputChannels = (wanted & output) != 0;
+            if (openDirections == 0)
+            {
+                if (sampleRate > 0)  setup.sampleRate = sampleRate;
+                if (bufferSize > 0)  setup.bufferSize = bufferSize;
+            }
+
+            auto err = manager.setAudioDeviceSetup(setup, true);
+            if (err.isNotEmpty() || manager.getCurrentAudioDevice() == nullptr)
+            {
+                if (openDirections != 0)
+                    manager.setAudioDeviceSetup(previous, true);   // keep serving existing clients
+                return false;
+            }
+
+            if (openDirections == 0)
+                manager.addAudioCallback(this);
+            openDirections = wanted;
+            return true;
+        }
+
+        bool add(juce::AudioIODeviceCallback* callback, int directions)
+        {
+            for (int i = 0; i < kMaxClientsPerDevice; ++i)
+            {
+                const bool taken = std::any_of(owned.begin(), owned.end(),
+                                               [i](const std::unique_ptr<Client>& o) { return o->slot == i; });
+                if (taken) continue;
+
+                auto c = std::make_unique<Client>();
+                c->callback = callback;
+                c->directions = directions;
+                c->slot = i;
+                owned.push_back(std::move(c));
+                return true;
+            }
+            jassertfalse;   // kMaxClientsPerDevice
+            return false;
+        }
+
+        bool start(juce::AudioIODeviceCallback* callback)
+        {
+            auto* c = find(callback);
+            if (c == nullptr) return false;
+            if (c->started) return true;
+
+            auto* device = manager.getCurrentAudioDevice();
+            if (device != nullptr && device->isPlaying())
+            {
+                prepare(*c, *device);
+                callback->audioDeviceAboutToStart(device);
+            }
+            c->started = true;
+            clients[(size_t)c->slot].store(c);
+            return true;
+        }
+
+        bool remove(juce::AudioIODeviceCallback* callback)
+        {
+            auto* c = find(callback);
+            if (c == nullptr) return false;
+
+            if (c->started)
+            {
+                clients[(size_t)c->slot].store(nullptr);
+                waitForCallback();
+
+                if (auto* device = manager.getCurrentAudioDevice(); device != nullptr && device->isPlaying())
+                    callback->audioDeviceStopped();
+            }
+
+            owned.erase(std::remove_if(owned.begin(), owned.end(),
+                                       [c](const std::unique_ptr<Client>& o) { return o.get() == c; }),
+                        owned.end());
+            return true;
+        }
+
+        bool isUnused() const { return owned.empty(); }
+
+        const juce::String typeName, deviceName;
+        juce::AudioDeviceManager manager;
+
+    private:
+        struct Client
+        {
+            juce::AudioIODeviceCallback* callback = nullptr;
+            int directions = 0;
+            int slot = -1;                             // index into clients
+            bool started = false;                      // published to the IO callback
+            juce::AudioBuffer<float> scratch;          // output: rendered here, then mixed
+            std::vector<const float*> inputs;          // input: chunk-offset channel pointers
+        };
+
+        Client* find(juce::AudioIODeviceCallback* callback) const
+        {
+            for (auto& o : owned)
+                if (o->callback == callback)
+                    return o.get();
+            return nullptr;
+        }
+
+        /// Sizes the client's buffers for `device`.  Called before the client
+        /// is published or while the device is stopped.
+        static void prepare(Client& c, juce::AudioIODevice& device)
+        {
+            const int numOut = device.getActiveOutputChannels().countNumberOfSetBits();
+            const int numIn  = device.getActiveInputChannels().countNumberOfSetBits();
+            if ((c.directions & output) != 0 && numOut > 0)
+                c.scratch.setSize(numOut, juce::jmax(1024, device.getCurrentBufferSizeSamples()));
+            else
+                c.scratch.setSize(0, 0);
+            c.inputs.assign((size_t)numIn, nullptr);
+        }
+
+        /// Returns once no IO callback that may have seen an unpublished
+        /// client is still running.
+        void waitForCallback() const
+        {
+            const auto seen = callbackCount.load();
+            if ((seen & 1u) == 0) return;          // not inside a callback
+            while (callbackCount.load() == seen)
+                std::this_thread::yield();
+        }
+
+        //======================================================================
+        void audioDeviceIOCallbackWithContext(const float* const* inputChannelData, int numInputChannels,
+                                              float* const* outputChannelData, int numOutputChannels,
+                                              int numSamples,
+                                              const juce::AudioIODeviceCallbackContext& context) override
+        {
+            callbackCount.fetch_add(1);            // odd: inside the callback
+
+            for (int ch = 0; ch < numOutputChannels; ++ch)
+                if (outputChannelData[ch] != nullptr)
+                    juce::FloatVectorOperations::clear(outputChannelData[ch], numSamples);
+
+            for (auto& slot : clients)
+            {
+                auto* c = slot.load();
+                if (c == nullptr) continue;
+
+                const int numIn = (c->directions & input) != 0 ? numInputChannels : 0;
+                const int numOut = juce::jmin(numOutputChannels, c->scratch.getNumChannels());
+                if (numOut == 0)
+                {
+                    c->callback->audioDeviceIOCallbackWithContext(inputChannelData, numIn,
+                                                                  nullptr, 0, numSamples, context);
+                    continue;
+                }
+
+                // Producers render into their own buffer, in chunks if the
+                // device delivers more than it announced
+                const int capacity = c->scratch.getNumSamples();
+                const int numInPtrs = juce::jmin(numIn, (int)c->inputs.size());
+                for (int pos = 0; pos < numSamples; pos += capacity)
+                {
+                    const int n = juce::jmin(capacity, numSamples - pos);
+                    for (int ch = 0; ch < numInPtrs; ++ch)
+                        c->inputs[(size_t)ch] = inputChannelData[ch] != nullptr ? inputChannelData[ch] + pos : nullptr;
+
+                    c->scratch.clear(0, n);
+                    c->callback->audioDeviceIOCallbackWithContext(c->inputs.data(), numInPtrs,
+                                                                  c->scratch.getArrayOfWritePointers(), numOut,
+                                                                  n, context);
+
+                    for (int ch = 0; ch < numOut; ++ch)
+                        if (outputChannelData[ch] != nullptr)
+                            juce::FloatVectorOperations::add(outputChannelData[ch] + pos,
+                                                             c->scratch.getReadPointer(ch), n);
+                }
+            }
+
+            callbackCount.fetch_add(1);
+        }
+
+        void audioDeviceAboutToStart(juce::AudioIODevice* device) override
+        {
+            for (auto& slot : clients)
+            {
+                if (auto* c = slot.load())
+                {
+                    if (device != nullptr)
+                        prepare(*c, *device);
+                    c->callback->audioDeviceAboutToStart(device);
+                }
+            }
+        }
+
+        void audioDeviceStopped() override
+        {
+            for (auto& slot : clients)
+                if (auto* c = slot.load())
+                    c->callback->audioDeviceStopped();
+        }
+
+        void audioDeviceError(const juce::String& errorMessage) override
+        {
+            for (auto& slot : clients)
+                if (auto* c = slot.load())
+                    c->callback->audioDeviceError(errorMessage);
+        }
+
+        int openDirections = 0;
+        std::array<std::atomic<Client*>, kMaxClientsPerDevice> clients {};
+        std::vector<std::unique_ptr<Client>> owned;   // attached clients, message thread
+        std::atomic<uint32_t> callbackCount { 0 };
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedDevice)
+    };
+
+    void removeIfUnused(SharedDevice* shared)
+    {
+        if (!shared->isUnused()) return;
+        devices.erase(std::remove_if(devices.begin(), devices.end(),
+                                     [shared](const std::unique_ptr<SharedDevice>& d) { return d.get() == shared; }),
+                      devices.end());
+    }
+
+    std::vector<std::unique_ptr<SharedDevice>> devices;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioDeviceHub)
+};
@@ -5,6 +5,7 @@
 #pragma once
 #include <JuceHeader.h>
 #include "LtcInput.h"
+#include "AudioDeviceHub.h"
 #include <atomic>
 #include <cstring>
 
@@ -31,31 +32,8 @@ public:
         currentTypeName = typeName;
         sourceInput.store(source, std::memory_order_relaxed);
 
-        deviceManager.closeAudioDevice();
-
-        // Register all device types without opening anything
-        deviceManager.initialise(0, 128, nullptr, false);
-
-        // Switch to requested type WITHOUT auto-opening (false)
-        if (typeName.isNotEmpty())
-            deviceManager.setCurrentAudioDeviceType(typeName, false);
-
-        // Scan so the device name is recognised
-        if (auto* type = deviceManager.getCurrentDeviceTypeObject())
-            type->scanForDevices();
-
-        // Open the specific device -- single open call
-        auto setup = deviceManager.getAudioDeviceSetup();
-        setup.outputDeviceName  = devName;
-        setup.inputDeviceName   = "";
-        setup.useDefaultInputChannels  = false;
-        setup.useDefaultOutputChannels = true;
-        if (sampleRate > 0)  setup.sampleRate = sampleRate;
-        if (bufferSize > 0)  setup.bufferSize = bufferSize;
-        auto err = deviceManager.setAudioDeviceSetup(setup, true);
-        if (err.isNotEmpty()) return false;
-
-        auto* device = deviceManager.getCurrentAudioDevice();
+        auto* device = audioHub->attach(this, typeName, devName, AudioDeviceHub::output,
+                                        sampleRate, bufferSize);
         if (!device) return false;
 
         numChannelsAvailable = device->getActiveOutputChannels().countNumberOfSetBits();
@@ -72,7 +50,7 @@ public:
         currentBufferSize = device->getCurrentBufferSizeSamples();
 
         peakLevel.store(0.0f, std::memory_order_relaxed);
-        deviceManager.addAudioCallback(this);
+        audioHub->start(this);
         isRunningFlag.store(true, std::memory_order_relaxed);
         return true;
     }
@@ -85,8 +63,7 @@ public:
             // any in-flight callback will see nullptr and exit early.  The
             // release ordering pairs with the acquire load in the callback.
             sourceInput.store(nullptr, std::memory_order_release);
-            deviceManager.removeAudioCallback(this);
-            deviceManager.closeAudioDevice();
+            audioHub->detach(this);
             isRunningFlag.store(false, std::memory_order_relaxed);
         }
     }
@@ -106,7 +83,7 @@ public:
     float getPeakLevel() const { return peakLevel.load(std::memory_order_relaxed); }
 
 private:
-    juce::AudioDeviceManager deviceManager;
+    juce::SharedResourcePointer<AudioDeviceHub> audioHub;
     juce::String currentDeviceName;
     juce::String currentTypeName;
     std::atomic<bool> isRunningFlag { false };
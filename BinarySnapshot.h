@@ -0,0 +1,196 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// BinarySnapshot -- Binary load cache written next to a JSON file.
+//
+// Loading a large JSON file means reading it into a String, tokenising it
+// into a juce::var tree and walking that tree -- most of the cold-start
+// time with a 100k-track TrackMap.  A binary snapshot holds the same data
+// as a flat, length-prefixed record stream that is read straight out of a
+// memory-mapped file: no tokenising, no var tree, no key lookups.
+//
+//   <name>.bin  header (kHeaderSize bytes, little-endian):
+//                 "STCB", format version, kind (fourcc), schema, count,
+//                 source JSON size + modification time, payload size,
+//                 payload hash
+//               payload: written by the owner through Writer
+//
+// The JSON file stays the source of truth.  The cache is only used when
+// it matches the JSON file's size and modification time exactly, its
+// kind / schema match, and its payload hash checks out -- anything else
+// (missing, stale, corrupt, older build) means "parse the JSON".  Write
+// the cache after the JSON file is in place; a crash in between leaves a
+// stale cache, which is ignored.
+//
+// Reader checks every read against the payload size; a failed read marks
+// the reader bad, and the owner discards what it decoded.
+
+#pragma once
+#include <JuceHeader.h>
+#include <cstring>
+
+class BinarySnapshot
+{
+public:
+    static constexpr uint32_t kFormatVersion = 1;
+    static constexpr size_t   kHeaderSize = 56;
+
+    static constexpr uint32_t fourCC(const char (&s)[5])
+    {
+        return (uint32_t)(unsigned char)s[0] | ((uint32_t)(unsigned char)s[1] << 8)
+             | ((uint32_t)(unsigned char)s[2] << 16) | ((uint32_t)(unsigned char)s[3] << 24);
+    }
+
+    /// The cache file belonging to a JSON file
+    static juce::File cacheFileFor(const juce::File& json)
+    {
+        return json.withFileExtension("bin");
+    }
+
+    //==========================================================================
+    // Writing
+    //==========================================================================
+    class Writer
+    {
+    public:
+        void writeInt(int v)               { out.writeInt(v); }
+        void writeBool(bool v)             { out.writeByte(v ? 1 : 0); }
+        void writeString(const juce::String& s)
+        {
+            const auto bytes = s.getNumBytesAsUTF8();
+            out.writeInt((int)bytes);
+            out.write(s.toRawUTF8(), bytes);
+        }
+
+        /// Writes the cache for `json` (which must already be on disk):
+        /// temporary file, flushed, renamed into place.
+        bool writeFor(const juce::File& json, uint32_t kind, uint32_t schema, uint32_t count) const
+        {
+            if (!json.existsAsFile()) return false;
+
+            juce::MemoryOutputStream header(kHeaderSize);
+            header.write("STCB", 4);
+            header.writeInt((int)kFormatVersion);
+            header.writeInt((int)kind);
+            header.writeInt((int)schema);
+            header.writeInt((int)count);
+            header.writeInt(0);   // reserved
+            header.writeInt64(json.getSize());
+            header.writeInt64(json.getLastModificationTime().toMilliseconds());
+            header.writeInt64((juce::int64)out.getDataSize());
+            header.writeInt64((juce::int64)hash(out.getData(), out.getDataSize()));
+            jassert(header.getDataSize() == kHeaderSize);
+
+            juce::TemporaryFile temp(cacheFileFor(json));
+            {
+                juce::FileOutputStream file(temp.getFile());
+                if (!file.openedOk()) return false;
+                file.write(header.getData(), header.getDataSize());
+                file.write(out.getData(), out.getDataSize());
+                file.flush();
+                if (!file.getStatus().wasOk()) return false;
+            }
+            return temp.overwriteTargetFileWithTemporary();
+        }
+
+    private:
+        juce::MemoryOutputStream out;
+    };
+
+    //==========================================================================
+    // Reading
+    //==========================================================================
+    class Reader
+    {
+    public:
+        /// Maps the cache for `json`; isValid() is false unless it matches
+        /// (see header comment).
+        Reader(const juce::File& json, uint32_t kind, uint32_t schema)
+        {
+            const auto cache = cacheFileFor(json);
+            if (!cache.existsAsFile() || !json.existsAsFile()) return;
+
+            map = std::make_unique<juce::MemoryMappedFile>(cache, juce::MemoryMappedFile::readOnly);
+            const auto* base = static_cast<const char*>(map->getData());
+            const size_t size = map->getSize();
+            if (base == nullptr || size < kHeaderSize || std::memcmp(base, "STCB", 4) != 0) return;
+
+            auto u32 = [base](size_t at) { return juce::ByteOrder::littleEndianInt(base + at); };
+            auto i64 = [base](size_t at) { return (juce::int64)juce::ByteOrder::littleEndianInt64(base + at); };
+
+            if (u32(4) != kFormatVersion || u32(8) != kind || u32(12) != schema) return;
+            if (i64(24) != json.getSize()
+                || i64(32) != json.getLastModificationTime().toMilliseconds()) return;   // stale
+            const auto payloadSize = (size_t)i64(40);
+            if (payloadSize != size - kHeaderSize) return;
+            if ((uint64_t)i64(48) != hash(base + kHeaderSize, payloadSize)) return;
+
+            itemCount = u32(16);
+            pos = base + kHeaderSize;
+            end = pos + payloadSize;
+            ok = true;
+        }
+
+        bool isValid() const       { return ok; }
+        uint32_t getCount() const  { return itemCount; }
+
+        /// True once every byte has been consumed without a failed read
+        bool isComplete() const    { return ok && pos == end; }
+
+        int readInt()
+        {
+            if (!need(4)) return 0;
+            const int v = (int)juce::ByteOrder::littleEndianInt(pos);
+            pos += 4;
+            return v;
+        }
+
+        bool readBool()
+        {
+            if (!need(1)) return false;
+            return *pos++ != 0;
+        }
+
+        juce::String readString()
+        {
+            const int len = readInt();
+            if (len < 0 || !need((size_t)len)) { ok = false; return {}; }
+            auto s = juce::String::fromUTF8(pos, len);
+            pos += len;
+            return s;
+        }
+
+    private:
+        bool need(size_t n)
+        {
+            if (ok && (size_t)(end - pos) >= n) return true;
+            ok = false;
+            return false;
+        }
+
+        std::unique_ptr<juce::MemoryMappedFile> map;
+        const char* pos = nullptr;
+        const char* end = nullptr;
+        uint32_t itemCount = 0;
+        bool ok = false;
+    };
+
+private:
+    /// FNV-1a over 64-bit words (bytes for the tail) -- integrity, not security
+    static uint64_t hash(const void* data, size_t len)
+    {
+        const auto* p = static_cast<const unsigned char*>(data);
+        uint64_t h = 1469598103934665603ull;
+        size_t i = 0;
+        for (; i + 8 <= len; i += 8)
+        {
+            uint64_t w;
+            std::memcpy(&w, p + i, 8);
+            h = (h ^ w) * 1099511628211ull;
+        }
+        for (; i < len; ++i)
+            h = (h ^ p[i]) * 1099511628211ull;
+        return h;
+    }
+};
@@ -0,0 +1,88 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// ChromeCache -- Rasterised backgrounds, borders and other static chrome.
+//
+// Meters, deck panels and buttons repaint far more often than their chrome
+// changes: a level meter repaints on every level change but only the bar
+// moves.  Drawing the gradients, rounded rectangles and tick marks again
+// each time is pure overhead.  A ChromeCache renders such a layer once into
+// an ARGB image and blits it afterwards:
+//
+//   chrome.draw(g, area, key, [&](juce::Graphics& cg, juce::Rectangle<float> r)
+//   {
+//       ...draw exactly as before, into r (origin 0,0, same size as area)...
+//   });
+//
+// `key` identifies everything the layer depends on besides its size
+// (colours, toggle state, text hash...); use mixKey() to fold values into
+// it.  Images are rendered at the physical pixel scale of the target
+// context and drawn 1:1 at device-pixel-snapped positions, so the result
+// matches direct drawing.  Rebuilt only when key, size or scale change.
+//
+// Message thread only (paint()).
+
+#pragma once
+#include <JuceHeader.h>
+#include <map>
+#include <tuple>
+#include <cmath>
+
+class ChromeCache
+{
+public:
+    /// capacity: layers kept before the cache starts over.  One per
+    /// distinct (key, size) the owner draws -- small for a single meter,
+    /// larger for a LookAndFeel shared by every button.
+    explicit ChromeCache(size_t capacity = 8) : maxEntries(capacity) {}
+
+    /// FNV-1a step for building a layer key from several values.
+    static uint64_t mixKey(uint64_t key, uint64_t value)
+    {
+        return (key ^ value) * 1099511628211ull;
+    }
+    static constexpr uint64_t kKeySeed = 1469598103934665603ull;
+
+    template <typename RenderFn>
+    void draw(juce::Graphics& g, juce::Rectangle<float> area, uint64_t key, RenderFn&& render)
+    {
+        if (area.isEmpty()) return;
+
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        const LayerKey lk { key, area.getWidth(), area.getHeight(), scale };
+
+        auto it = layers.find(lk);
+        if (it == layers.end())
+        {
+            if (layers.size() >= maxEntries)
+                layers.clear();   // sizes/states change rarely; just start over
+
+            const int pxW = juce::jmax(1, (int)std::ceil(area.getWidth()  * scale));
+            const int pxH = juce::jmax(1, (int)std::ceil(area.getHeight() * scale));
+            juce::Image img(juce::Image::ARGB, pxW, pxH, true);
+            {
+                juce::Graphics cg(img);
+                cg.addTransform(juce::AffineTransform::scale(scale));
+                render(cg, juce::Rectangle<float>(0.0f, 0.0f, area.getWidth(), area.getHeight()));
+            }
+            it = layers.emplace(lk, img).first;
+        }
+
+        const auto& img = it->second;
+        auto snap = [scale](float v) { return std::round(v * scale) / scale; };
+        g.drawImage(img, { snap(area.getX()), snap(area.getY()),
+                           (float)img.getWidth() / scale, (float)img.getHeight() / scale },
+                    juce::RectanglePlacement::stretchToFit);
+    }
+
+    void clear() { layers.clear(); }
+
+private:
+    using LayerKey = std::tuple<uint64_t, float, float, float>;
+
+    size_t maxEntries;
+    std::map<LayerKey, juce::Image> layers;
+
+    JUCE_LEAK_DETECTOR(ChromeCache)
+};
@@ -28,6 +28,7 @@
 #include <JuceHeader.h>
 #include "AppSettings.h"
 #include "CustomLookAndFeel.h"
+#include "WaveformPyramid.h"
 
 //==============================================================================
 // CueWaveformStrip -- Horizontal waveform display with playback + edit cursors
@@ -39,10 +40,23 @@ public:
 
     void setWaveformData(const std::vector<uint8_t>& data, int entryCount, int bytesPerEntry)
     {
-        wfData = data;
         wfEntries = entryCount;
         wfBytesPerEntry = bytesPerEntry;
         hasData = (entryCount > 0 && (int)data.size() >= entryCount * bytesPerEntry);
+
+        pyramid = nullptr;
+        const uint32_t gen = ++pyramidGeneration;
+        if (hasData)
+        {
+            juce::Component::SafePointer<CueWaveformStrip> safe(this);
+            WaveformPyramidBuilder::buildAsync(*renderWorker, data, entryCount, bytesPerEntry,
+                [safe, gen](std::shared_ptr<const WaveformPyramid> p)
+                {
+                    if (safe == nullptr || safe->pyramidGeneration != gen) return;
+                    safe->pyramid = std::move(p);
+                    safe->repaint();
+                });
+        }
         repaint();
     }
 
@@ -76,45 +90,38 @@ public:
         float drawH = b.getHeight() - inset * 2;
         float midY = inset + drawH * 0.5f;
 
-        // Draw waveform bars
-        if (hasData && wfEntries > 0 && drawW > 0)
+        // Draw waveform bars -- one column per pixel from the pyramid
+        if (hasData && pyramid != nullptr && wfEntries > 0 && drawW > 0)
         {
-            float barW = std::max(1.0f, drawW / (float)wfEntries);
-            const uint8_t* raw = wfData.data();
-
-            // Find peak for normalization
-            uint8_t peak = 1;
-            for (int i = 0; i < wfEntries; ++i)
-            {
-                int off = i * wfBytesPerEntry;
-                for (int j = 0; j < std::min(wfBytesPerEntry, 3); ++j)
-                    if (raw[off + j] > peak) peak = raw[off + j];
-            }
+            // Peak for normalization
+            uint8_t peak = juce::jmax((uint8_t)1, pyramid->getPeakOfFirst(3));
             float norm = drawH * 0.45f / (float)peak;
+            float entriesPerPx = (float)wfEntries / drawW;
 
-            for (int i = 0; i < wfEntries; ++i)
+            WaveformPyramid::Column c;
+            for (int px = 0; px < (int)drawW; ++px)
             {
-                int off = i * wfBytesPerEntry;
-                float x = inset + (float)i / (float)wfEntries * drawW;
+                int eStart = (int)((float)px * entriesPerPx);
+                int eEnd   = juce::jmax(eStart + 1, (int)((float)(px + 1) * entriesPerPx));
+                if (!pyramid->sample(eStart, eEnd, c)) continue;
+                float x = inset + (float)px;
 
                 juce::Colour col;
                 float h;
                 if (wfBytesPerEntry == 3)
                 {
                     // ThreeBand: mid=blue, high=cyan, low=purple
-                    uint8_t mid = raw[off], hi = raw[off+1], lo = raw[off+2];
-                    h = std::max({(float)mid, (float)hi, (float)lo}) * norm;
-                    float r = (float)lo * 0.6f / 255.0f;
-                    float gr = (float)hi * 0.8f / 255.0f;
-                    float bl = (float)mid / 255.0f;
+                    h = (float)std::max({ c.peak[0], c.peak[1], c.peak[2] }) * norm;
+                    float r = c.avg[2] * 0.6f / 255.0f;
+                    float gr = c.avg[1] * 0.8f / 255.0f;
+                    float bl = c.avg[0] / 255.0f;
                     col = juce::Colour::fromFloatRGBA(0.2f + r * 0.5f, 0.3f + gr * 0.5f, 0.5f + bl * 0.5f, 0.85f);
                 }
                 else if (wfBytesPerEntry >= 6)
                 {
                     // ColorNxs2: d3=R, d4=G, d5=B, height from d0-d2
-                    uint8_t d0 = raw[off], d1 = raw[off+1], d2 = raw[off+2];
-                    h = std::max({(float)d0, (float)d1, (float)d2}) * norm;
-                    col = juce::Colour(raw[off+3], raw[off+4], raw[off+5]).withAlpha(0.85f);
+                    h = (float)std::max({ c.peak[0], c.peak[1], c.peak[2] }) * norm;
+                    col = juce::Colour((uint8_t)c.avg[3], (uint8_t)c.avg[4], (uint8_t)c.avg[5]).withAlpha(0.85f);
                 }
                 else
                 {
@@ -123,9 +130,13 @@ public:
 
                 h = std::max(h, 1.0f);
                 g.setColour(col);
-                g.fillRect(x, midY - h, barW, h * 2);
+                g.fillRect(x, midY - h, 1.0f, h * 2);
             }
         }
+        else if (hasData)
+        {
+            // Pyramid still building (a few ms) -- leave the strip blank
+        }
         else
         {
             g.setColour(juce::Colour(0xFF444444));
@@ -203,7 +214,9 @@ public:
     std::function<void(uint32_t)> onEditCursorChanged;
 
 private:
-    std::vector<uint8_t> wfData;
+    std::shared_ptr<const WaveformPyramid> pyramid;   // null until built
+    uint32_t pyramidGeneration = 0;
+    juce::SharedResourcePointer<RenderWorker> renderWorker;
     int wfEntries = 0, wfBytesPerEntry = 0;
     bool hasData = false;
     uint32_t durationMs = 0;
@@ -4,6 +4,7 @@
 
 #pragma once
 #include <JuceHeader.h>
+#include "ChromeCache.h"
 
 //==============================================================================
 // Cross-platform monospace font name
@@ -76,25 +77,33 @@ public:
                               const juce::Colour& backgroundColour,
                               bool isHighlighted, bool isDown) override
     {
-        auto bounds = button.getLocalBounds().toFloat().reduced(0.5f);
-        float cornerSize = 5.0f;
-
         auto baseCol = backgroundColour;
         if (isDown)
             baseCol = baseCol.brighter(0.1f);
         else if (isHighlighted)
             baseCol = baseCol.brighter(0.05f);
 
-        // Subtle gradient
-        g.setGradientFill(juce::ColourGradient(
-            baseCol.brighter(0.03f), 0, bounds.getY(),
-            baseCol.darker(0.03f), 0, bounds.getBottom(), false));
-        g.fillRoundedRectangle(bounds, cornerSize);
+        uint64_t key = ChromeCache::mixKey(ChromeCache::kKeySeed, kChromeButton);
+        key = ChromeCache::mixKey(key, baseCol.getARGB());
+        key = ChromeCache::mixKey(key, isHighlighted ? 1 : 0);
 
-        // Border
-        auto borderAlpha = isHighlighted ? 0.3f : 0.15f;
-        g.setColour(juce::Colours::white.withAlpha(borderAlpha));
-        g.drawRoundedRectangle(bounds, cornerSize, 1.0f);
+        buttonChrome.draw(g, button.getLocalBounds().toFloat(), key,
+                          [baseCol, isHighlighted](juce::Graphics& cg, juce::Rectangle<float> r)
+        {
+            auto bounds = r.reduced(0.5f);
+            float cornerSize = 5.0f;
+
+            // Subtle gradient
+            cg.setGradientFill(juce::ColourGradient(
+                baseCol.brighter(0.03f), 0, bounds.getY(),
+                baseCol.darker(0.03f), 0, bounds.getBottom(), false));
+            cg.fillRoundedRectangle(bounds, cornerSize);
+
+            // Border
+            auto borderAlpha = isHighlighted ? 0.3f : 0.15f;
+            cg.setColour(juce::Colours::white.withAlpha(borderAlpha));
+            cg.drawRoundedRectangle(bounds, cornerSize, 1.0f);
+        });
     }
 
     void drawButtonText(juce::Graphics& g, juce::TextButton& button,
@@ -121,67 +130,76 @@ public:
                           bool isHighlighted, bool /*isDown*/) override
     {
         auto bounds = button.getLocalBounds().toFloat();
-        float cornerSize = 5.0f;
         bool isOn = button.getToggleState();
 
         auto tickColour = button.findColour(juce::ToggleButton::tickColourId);
 
-        // Background -- strong accent tint when ON
-        auto bgCol = isOn ? tickColour.withAlpha(0.18f) : bg;
-        if (isHighlighted) bgCol = bgCol.brighter(0.04f);
-        g.setColour(bgCol);
-        g.fillRoundedRectangle(bounds.reduced(0.5f), cornerSize);
-
-        // Border -- accent colour when ON
-        g.setColour(isOn ? tickColour.withAlpha(0.5f) : border);
-        g.drawRoundedRectangle(bounds.reduced(0.5f), cornerSize, isOn ? 1.5f : 1.0f);
+        uint64_t key = ChromeCache::mixKey(ChromeCache::kKeySeed, kChromeToggle);
+        key = ChromeCache::mixKey(key, tickColour.getARGB());
+        key = ChromeCache::mixKey(key, (isOn ? 2u : 0u) | (isHighlighted ? 1u : 0u));
 
-        // Left accent bar when ON
-        if (isOn)
+        // Everything but the label is cached per size and state
+        buttonChrome.draw(g, bounds, key,
+                          [this, isOn, isHighlighted, tickColour](juce::Graphics& cg, juce::Rectangle<float> r)
         {
-            g.setColour(tickColour);
-            g.fillRoundedRectangle(bounds.getX() + 1.5f, bounds.getY() + 4.0f,
-                                   3.0f, bounds.getHeight() - 8.0f, 1.5f);
-        }
-
-        // Toggle indicator (circle style)
-        float indicatorSize = 14.0f;
-        float indicatorX = bounds.getX() + 12.0f;
-        float indicatorY = bounds.getCentreY() - indicatorSize / 2.0f;
-        auto indicatorBounds = juce::Rectangle<float>(indicatorX, indicatorY, indicatorSize, indicatorSize);
-
-        // Outer ring
-        g.setColour(isOn ? tickColour : juce::Colour(0xFF2A2D35));
-        g.fillEllipse(indicatorBounds);
-        g.setColour(isOn ? tickColour.brighter(0.2f) : border);
-        g.drawEllipse(indicatorBounds, 1.0f);
-
-        // Inner filled circle when ON
-        if (isOn)
-        {
-            g.setColour(tickColour.brighter(0.15f));
-            g.fillEllipse(indicatorBounds.reduced(3.5f));
-        }
+            float cornerSize = 5.0f;
+
+            // Background -- strong accent tint when ON
+            auto bgCol = isOn ? tickColour.withAlpha(0.18f) : bg;
+            if (isHighlighted) bgCol = bgCol.brighter(0.04f);
+            cg.setColour(bgCol);
+            cg.fillRoundedRectangle(r.reduced(0.5f), cornerSize);
+
+            // Border -- accent colour when ON
+            cg.setColour(isOn ? tickColour.withAlpha(0.5f) : border);
+            cg.drawRoundedRectangle(r.reduced(0.5f), cornerSize, isOn ? 1.5f : 1.0f);
+
+            // Left accent bar when ON
+            if (isOn)
+            {
+                cg.setColour(tickColour);
+                cg.fillRoundedRectangle(r.getX() + 1.5f, r.getY() + 4.0f,
+                                        3.0f, r.getHeight() - 8.0f, 1.5f);
+            }
+
+            // Toggle indicator (circle style)
+            auto indicatorBounds = juce::Rectangle<float>(r.getX() + kToggleIndicatorX,
+                                                          r.getCentreY() - kToggleIndicatorSize / 2.0f,
+                                                          kToggleIndicatorSize, kToggleIndicatorSize);
+
+            // Outer ring
+            cg.setColour(isOn ? tickColour : juce::Colour(0xFF2A2D35));
+            cg.fillEllipse(indicatorBounds);
+            cg.setColour(isOn ? tickColour.brighter(0.2f) : border);
+            cg.drawEllipse(indicatorBounds, 1.0f);
+
+            // Inner filled circle when ON
+            if (isOn)
+            {
+                cg.setColour(tickColour.brighter(0.15f));
+                cg.fillEllipse(indicatorBounds.reduced(3.5f));
+            }
+
+            // Status dot -- pulsing accent
+            if (isOn)
+            {
+                float dotSize = 6.0f;
+                float dotX = r.getRight() - dotSize - 10.0f;
+                float dotY = r.getCentreY() - dotSize / 2.0f;
+                cg.setColour(tickColour);
+                cg.fillEllipse(dotX, dotY, dotSize, dotSize);
+                // Glow
+                cg.setColour(tickColour.withAlpha(0.15f));
+                cg.fillEllipse(dotX - 2.0f, dotY - 2.0f, dotSize + 4.0f, dotSize + 4.0f);
+            }
+        });
 
         // Text -- brighter when ON, with accent tint
-        auto textBounds = bounds.withTrimmedLeft(indicatorX + indicatorSize + 8.0f);
+        auto textBounds = bounds.withTrimmedLeft(bounds.getX() + kToggleIndicatorX + kToggleIndicatorSize + 8.0f);
         g.setFont(juce::Font(juce::FontOptions(getMonoFontName(), 11.0f, juce::Font::bold)));
         g.setColour(isOn ? textBright : textMid);
         g.drawText(button.getButtonText(), textBounds.toNearestInt(),
                    juce::Justification::centredLeft, false);
-
-        // Status dot -- pulsing accent
-        if (isOn)
-        {
-            float dotSize = 6.0f;
-            float dotX = bounds.getRight() - dotSize - 10.0f;
-            float dotY = bounds.getCentreY() - dotSize / 2.0f;
-            g.setColour(tickColour);
-            g.fillEllipse(dotX, dotY, dotSize, dotSize);
-            // Glow
-            g.setColour(tickColour.withAlpha(0.15f));
-            g.fillEllipse(dotX - 2.0f, dotY - 2.0f, dotSize + 4.0f, dotSize + 4.0f);
-        }
     }
 
     //==============================================================================
@@ -452,6 +470,13 @@ public:
     int getDefaultScrollbarWidth() override { return 8; }
 
 private:
+    static constexpr uint64_t kChromeButton = 1, kChromeToggle = 2;
+    static constexpr float kToggleIndicatorX = 12.0f, kToggleIndicatorSize = 14.0f;
+
+    // Rasterised button/toggle chrome, shared by every button using this
+    // LookAndFeel (a few sizes x a few states each)
+    ChromeCache buttonChrome { 64 };
+
     juce::Colour bg        { 0xFF1A1D23 };
     juce::Colour bgHover   { 0xFF252830 };
     juce::Colour border    { 0xFF2A2D35 };
@@ -0,0 +1,75 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// SnapshotTripleBuffer -- Versioned display snapshots from a producer thread.
+//
+// Views used to pull dozens of values per frame through individual atomic
+// getters (and the odd SpinLock), so one frame could mix fields from two
+// different packets.  An input that wants to be displayed instead fills one
+// plain struct with everything the UI shows and publishes it here:
+//
+//   producer : auto& s = buffer.beginWrite();  ...fill every field...;
+//              buffer.publish();
+//   consumer : const auto& s = buffer.read();
+//              if (s.version != lastVersion) { ...update... }
+//
+// Three slots: the producer always has a free one to write, the consumer
+// keeps the one it is reading, and the third holds the latest publish.
+// Neither side blocks or allocates.  The slot returned by read() stays
+// unchanged until the consumer's next read(), so a whole paint sees one
+// consistent state.
+//
+// One producer thread and one consumer thread (the message thread).
+// Several readers on the consumer thread may share a buffer as long as
+// none keeps the reference past its own call: any read() may move on to a
+// newer slot, and the older one goes back to the producer.  T
+// must be trivially copyable in spirit -- plain values and fixed char
+// arrays, no heap members -- and have a `uint32_t version` field, set by
+// publish().  beginWrite() returns a slot holding an older snapshot:
+// overwrite every field.
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+template <typename T>
+class SnapshotTripleBuffer
+{
+public:
+    SnapshotTripleBuffer() = default;
+
+    /// Producer: the slot to fill for the next publish().
+    T& beginWrite() { return slots[back]; }
+
+    /// Producer: makes the slot from beginWrite() the latest snapshot.
+    void publish()
+    {
+        slots[back].version = ++publishCount;
+        const uint8_t prev = middle.exchange((uint8_t)(back | kFresh), std::memory_order_acq_rel);
+        back = prev & kIndexMask;
+    }
+
+    /// Consumer: the latest published snapshot (version 0 = nothing yet).
+    const T& read()
+    {
+        if ((middle.load(std::memory_order_relaxed) & kFresh) != 0)
+        {
+            const uint8_t prev = middle.exchange(front, std::memory_order_acq_rel);
+            front = prev & kIndexMask;
+        }
+        return slots[front];
+    }
+
+private:
+    static constexpr uint8_t kFresh = 4, kIndexMask = 3;
+
+    T slots[3] {};
+    std::atomic<uint8_t> middle { 1 };   // index of the spare slot | kFresh when unread
+    uint8_t  back = 0;                   // producer only
+    uint8_t  front = 2;                  // consumer only
+    uint32_t publishCount = 0;           // producer only
+
+    SnapshotTripleBuffer(const SnapshotTripleBuffer&) = delete;
+    SnapshotTripleBuffer& operator=(const SnapshotTripleBuffer&) = delete;
+};
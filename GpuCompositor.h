@@ -0,0 +1,353 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// GpuCompositor -- Optional OpenGL compositing without GL-thread painting.
+//
+// Attaching a juce::OpenGLContext the usual way makes JUCE call paint() for
+// the whole component tree on the GL thread, racing the message thread on
+// every juce::String the views read in paint() (see the MainComponent
+// constructor).  This compositor keeps all painting on the message thread:
+//
+//   message thread : a CachedComponentImage installed on the target sees
+//                    every repaint() of the target and its children, with
+//                    the invalidated area.  Only that area is painted,
+//                    into a canvas image kept between frames; the kTileSize
+//                    tiles it touches are copied out as new immutable
+//                    images and published with the unchanged tiles.
+//   GL thread      : draws the published tiles.  JUCE's GL image cache
+//                    keeps one texture per image, so only the tiles that
+//                    changed are uploaded again.
+//
+// Painting happens in the same message-loop pass as the invalidation and
+// the GL repaint is triggered right after publishing, so a change reaches
+// the screen in one GL pass.  The GL context renders into a child surface
+// covering the target, which ignores the mouse; while it is compositing,
+// repaints of the target no longer reach the window's software path.
+//
+// The GL thread touches nothing but the published tile images, whose pixel
+// data is never written after publishing -- changed tiles are replaced,
+// not modified -- so there is no shared mutable state between the threads.
+//
+// Fallback: when no context comes up within kStartupTimeoutMs, or the
+// driver reports no renderer, the context is detached and the target goes
+// back to normal software painting.  Works with Mesa's llvmpipe, so the
+// path can be exercised on headless Linux (Xvfb + LIBGL_ALWAYS_SOFTWARE=1).
+//
+// Create and destroy on the message thread.  Destroy before the target.
+
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <cmath>
+#include <memory>
+
+class GpuCompositor : private juce::OpenGLRenderer,
+                      private juce::AsyncUpdater,
+                      private juce::Timer,
+                      private juce::ComponentListener
+{
+public:
+    /// Whether GPU compositing should be used: the STC_GPU_COMPOSITING
+    /// environment variable ("1" / "0") overrides the saved setting.
+    static bool isRequested(bool settingEnabled)
+    {
+        auto env = juce::SystemStats::getEnvironmentVariable("STC_GPU_COMPOSITING", {});
+        if (env.isNotEmpty())
+            return env.getIntValue() != 0;
+        return settingEnabled;
+    }
+
+    explicit GpuCompositor(juce::Component& targetComponent)
+        : target(targetComponent)
+    {
+        // The target's own CachedComponentImage slot carries the dirty
+        // tracking, so the context goes on a child surface instead.
+        jassert(target.getCachedComponentImage() == nullptr);
+        tracker = new DirtyTracker(*this);
+        target.setCachedComponentImage(tracker);   // owned by the target
+        target.addComponentListener(this);
+
+        surface.setInterceptsMouseClicks(false, false);
+        surface.setBounds(target.getLocalBounds());
+        target.addAndMakeVisible(surface);
+
+        context.setRenderer(this);
+        context.setComponentPaintingEnabled(false);   // paint() never runs on the GL thread
+        context.setContinuousRepainting(false);
+        context.setImageCacheSize(kImageCacheBytes);
+        context.attachTo(surface);
+        startTimer(kStartupTimeoutMs);
+    }
+
+    ~GpuCompositor() override
+    {
+        detach();
+    }
+
+    /// True once a GL context is compositing frames (false after fallback).
+    bool isActive() const { return !fellBack && contextReady.load(std::memory_order_acquire); }
+
+    /// GL_RENDERER of the active context ("llvmpipe ..." on Mesa software).
+    juce::String getRendererName() const
+    {
+        const juce::SpinLock::ScopedLockType sl(frameLock);
+        return rendererName;
+    }
+
+private:
+    static constexpr int kStartupTimeoutMs = 2000;
+    static constexpr int kTileSize = 256;   // physical pixels
+    // Tile textures for two full 4K frames, so replaced tiles can age out
+    // of JUCE's cache without evicting the ones still on screen.
+    static constexpr size_t kImageCacheBytes = 2 * 3840 * 2160 * 4;
+
+    /// An immutable set of tiles covering the target at `scale`.
+    struct Frame
+    {
+        juce::Array<juce::Image> tiles;   // row-major, `columns` per row
+        int   columns = 0;
+        int   width = 0, height = 0;      // physical pixels
+        float scale = 1.0f;
+    };
+
+    //==========================================================================
+    // Dirty-area tracking: installed as the target's CachedComponentImage,
+    // so Component::repaint() of the target or any descendant reports the
+    // invalidated area here (in target coordinates) before it would reach
+    // the peer.
+    //==========================================================================
+    struct DirtyTracker : public juce::CachedComponentImage
+    {
+        explicit DirtyTracker(GpuCompositor& o) : owner(o) {}
+
+        void paint(juce::Graphics& g) override
+        {
+            // Peer paints (expose, resize) land here.  While the GL surface
+            // composites, it covers the target and there is nothing to draw.
+            if (!owner.isActive())
+                owner.target.paintEntireComponent(g, false);
+        }
+
+        bool invalidateAll() override { return owner.invalidate(owner.target.getLocalBounds()); }
+        bool invalidate(const juce::Rectangle<int>& area) override { return owner.invalidate(area); }
+        void releaseResources() override {}
+
+        GpuCompositor& owner;
+    };
+
+    /// Returns whether the peer still needs the repaint (software path).
+    bool invalidate(juce::Rectangle<int> area)
+    {
+        dirty.add(area.getIntersection(target.getLocalBounds()));
+        triggerAsyncUpdate();
+        return !isActive();
+    }
+
+    void componentMovedOrResized(juce::Component&, bool, bool wasResized) override
+    {
+        if (wasResized)
+            surface.setBounds(target.getLocalBounds());
+    }
+
+    //==========================================================================
+    // GL thread
+    //==========================================================================
+    void newOpenGLContextCreated() override
+    {
+        auto* name = reinterpret_cast<const char*>(juce::gl::glGetString(juce::gl::GL_RENDERER));
+        if (name == nullptr)
+        {
+            glFailed.store(true, std::memory_order_release);
+            triggerAsyncUpdate();
+            return;
+        }
+        {
+            const juce::SpinLock::ScopedLockType sl(frameLock);
+            rendererName = juce::String(name);
+        }
+        renderScale.store(context.getRenderingScale(), std::memory_order_relaxed);
+        contextReady.store(true, std::memory_order_release);
+
+        // Nothing was tracked for the GL path until now: build a full frame
+        fullRepaintRequested.store(true);
+        triggerAsyncUpdate();
+    }
+
+    void renderOpenGL() override
+    {
+        std::shared_ptr<const Frame> frame;
+        {
+            const juce::SpinLock::ScopedLockType sl(frameLock);
+            frame = latestFrame;
+        }
+
+        // Window moved to a display with another scale: ask for new tiles,
+        // and stretch the current ones until they arrive.
+        const double scale = context.getRenderingScale();
+        renderScale.store(scale, std::memory_order_relaxed);
+
+        juce::OpenGLHelpers::clear(juce::Colours::black);
+        if (frame == nullptr) return;
+
+        const bool scaleChanged = std::abs(scale - (double)frame->scale) > 1.0e-3;
+        if (scaleChanged && !fullRepaintRequested.exchange(true))
+            triggerAsyncUpdate();
+
+        const int w = juce::roundToInt((double)frame->width  * scale / frame->scale);
+        const int h = juce::roundToInt((double)frame->height * scale / frame->scale);
+        std::unique_ptr<juce::LowLevelGraphicsContext> glg(
+            juce::createOpenGLGraphicsContext(context, w, h));
+        if (glg == nullptr) return;
+
+        juce::Graphics g(*glg);
+        if (scaleChanged)
+            g.addTransform(juce::AffineTransform::scale((float)(scale / frame->scale)));
+
+        for (int i = 0; i < frame->tiles.size(); ++i)
+        {
+            const auto& tile = frame->tiles.getReference(i);
+            if (tile.isValid())
+                g.drawImageAt(tile, (i % frame->columns) * kTileSize,
+                                    (i / frame->columns) * kTileSize);
+        }
+    }
+
+    void openGLContextClosing() override
+    {
+        contextReady.store(false, std::memory_order_release);
+    }
+
+    //==========================================================================
+    // Message thread
+    //==========================================================================
+    void handleAsyncUpdate() override
+    {
+        if (glFailed.load(std::memory_order_acquire))
+        {
+            fallBack("no OpenGL renderer");
+            return;
+        }
+        if (fellBack || !contextReady.load(std::memory_order_acquire))
+            return;   // dirty areas stay queued; a full frame follows the context
+
+        const double rs = renderScale.load(std::memory_order_relaxed);
+        const float scale = rs > 0.0 ? (float)rs
+                                     : juce::Component::getApproximateScaleFactorForComponent(&target);
+        const int w = juce::roundToInt((float)target.getWidth()  * scale);
+        const int h = juce::roundToInt((float)target.getHeight() * scale);
+        if (w <= 0 || h <= 0) return;
+
+        if (fullRepaintRequested.exchange(false)
+            || canvas.getWidth() != w || canvas.getHeight() != h || canvasScale != scale)
+        {
+            canvas = juce::Image(juce::Image::ARGB, w, h, true, juce::SoftwareImageType());
+            canvasScale = scale;
+            columns = (w + kTileSize - 1) / kTileSize;
+            rows    = (h + kTileSize - 1) / kTileSize;
+            tiles.clearQuick();
+            tiles.resize(columns * rows);
+            dirty.clear();
+            dirty.add(target.getLocalBounds());
+        }
+        if (dirty.isEmpty()) return;
+
+        // Dirty area in physical pixels, snapped outwards to whole pixels
+        juce::RectangleList<int> area;
+        for (const auto& r : dirty)
+            area.add((r.toFloat() * scale).getSmallestIntegerContainer());
+        area.clipTo(canvas.getBounds());
+        dirty.clear();
+
+        {
+            juce::Graphics g(canvas);
+            g.reduceClipRegion(area);
+            auto& lg = g.getInternalContext();
+            lg.setFill(juce::Colours::transparentBlack);
+            lg.fillRect(canvas.getBounds(), true);
+            lg.setFill(juce::Colours::black);
+            g.addTransform(juce::AffineTransform::scale(scale));
+            target.paintEntireComponent(g, true);
+        }
+
+        // Replace (never modify) the tiles the dirty area touches: the GL
+        // thread may still be drawing the published ones.
+        auto frame = std::make_shared<Frame>();
+        for (int row = 0; row < rows; ++row)
+        {
+            for (int col = 0; col < columns; ++col)
+            {
+                const auto bounds = juce::Rectangle<int>(col * kTileSize, row * kTileSize,
+                                                         kTileSize, kTileSize)
+                                        .getIntersection(canvas.getBounds());
+                if (area.intersectsRectangle(bounds))
+                    tiles.set(row * columns + col, canvas.getClippedImage(bounds).createCopy());
+            }
+        }
+        frame->tiles   = tiles;
+        frame->columns = columns;
+        frame->width   = w;
+        frame->height  = h;
+        frame->scale   = scale;
+
+        {
+            const juce::SpinLock::ScopedLockType sl(frameLock);
+            latestFrame = std::move(frame);
+        }
+        context.triggerRepaint();
+    }
+
+    void timerCallback() override
+    {
+        stopTimer();
+        if (!contextReady.load(std::memory_order_acquire))
+            fallBack("no OpenGL context after " + juce::String(kStartupTimeoutMs) + " ms");
+    }
+
+    void fallBack(const juce::String& reason)
+    {
+        DBG("GpuCompositor: falling back to software rendering (" << reason << ")");
+        juce::ignoreUnused(reason);
+        fellBack = true;
+        detach();
+        target.repaint();
+    }
+
+    void detach()
+    {
+        stopTimer();
+        target.removeComponentListener(this);
+        if (context.isAttached())
+            context.detach();   // joins the GL thread
+        context.setRenderer(nullptr);
+        if (tracker != nullptr && target.getCachedComponentImage() == tracker)
+            target.setCachedComponentImage(nullptr);   // deletes the tracker
+        tracker = nullptr;
+        target.removeChildComponent(&surface);
+        cancelPendingUpdate();
+    }
+
+    juce::Component& target;
+    juce::Component surface;             // GL context host, covers the target
+    juce::OpenGLContext context;
+    DirtyTracker* tracker = nullptr;     // owned by the target
+
+    std::atomic<bool> contextReady { false };
+    std::atomic<bool> glFailed { false };
+    std::atomic<bool> fullRepaintRequested { false };
+    std::atomic<double> renderScale { 0.0 };   // written by the GL thread
+    bool fellBack = false;            // message thread only
+
+    // Message thread only
+    juce::RectangleList<int> dirty;   // target coordinates
+    juce::Image canvas;               // whole target at canvasScale, reused
+    float canvasScale = 0.0f;
+    juce::Array<juce::Image> tiles;   // current tiles, row-major
+    int columns = 0, rows = 0;
+
+    mutable juce::SpinLock frameLock; // guards latestFrame, rendererName
+    std::shared_ptr<const Frame> latestFrame;
+    juce::String rendererName;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GpuCompositor)
+};
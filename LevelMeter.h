@@ -4,6 +4,7 @@
 
 #pragma once
 #include <JuceHeader.h>
+#include "ChromeCache.h"
 
 class LevelMeter : public juce::Component
 {
@@ -16,11 +17,14 @@ public:
         newLevel = juce::jlimit(0.0f, 2.0f, newLevel);
         if (std::abs(currentLevel - newLevel) > 0.001f)
         {
+            const float oldLevel = currentLevel;
             currentLevel = newLevel;
-            repaint();
+            repaintChangedSpan(oldLevel, newLevel);
         }
     }
 
+    float getLevel() const { return currentLevel; }
+
     void setMeterColour(juce::Colour c) { meterColour = c; }
 
     void paint(juce::Graphics& g) override
@@ -28,65 +32,109 @@ public:
         // Use full integer bounds for the background fill so there are no
         // uncleared pixels at the component edge (previously reduced(0.5f)
         // left a fractional-pixel strip that caused a flickering halo).
-        auto intBounds = getLocalBounds();
-        float cornerSize = 2.0f;
+        auto fullBounds = getLocalBounds().toFloat();
 
         // Background -- fill the full component area first
-        g.setColour(juce::Colour(0xFF0D0E12));
-        g.fillRoundedRectangle(intBounds.toFloat(), cornerSize);
+        chrome.draw(g, fullBounds, kLayerBackground, [](juce::Graphics& cg, juce::Rectangle<float> r)
+        {
+            cg.setColour(juce::Colour(0xFF0D0E12));
+            cg.fillRoundedRectangle(r, kCornerSize);
+        });
 
         // Inner drawing area inset by 1px so the border sits cleanly on top
-        auto bounds = intBounds.toFloat().reduced(1.0f);
+        auto bounds = fullBounds.reduced(1.0f);
 
-        // Filled level bar
+        // Filled level bar: the full-width bar of the current colour zone,
+        // clipped to the level
         if (currentLevel > 0.001f)
         {
             // Clamp display width to bar bounds, but use real level for colour
-            float displayLevel = juce::jmin(1.0f, currentLevel);
-            float fillW = bounds.getWidth() * displayLevel;
-            auto fillBounds = bounds.withWidth(fillW);
-
-            // Green -> Yellow -> Red gradient based on actual level (not clamped)
-            juce::Colour barColour;
-            if (currentLevel < 0.6f)
-                barColour = meterColour.withAlpha(0.7f);
-            else if (currentLevel < 0.85f)
-                barColour = juce::Colour(0xFFFFAB00).withAlpha(0.8f);
-            else
-                barColour = juce::Colour(0xFFC62828).withAlpha(0.9f);
-
-            g.setColour(barColour);
-            g.fillRoundedRectangle(fillBounds, cornerSize);
-
-            // Subtle glow on top
-            g.setColour(juce::Colours::white.withAlpha(0.08f));
-            g.fillRoundedRectangle(fillBounds.withHeight(fillBounds.getHeight() * 0.4f), cornerSize);
+            const int zone = colourZone(currentLevel);
+            const juce::Colour barColour = zoneColour(zone);
+            const float fillW = bounds.getWidth() * juce::jmin(1.0f, currentLevel);
+
+            {
+                juce::Graphics::ScopedSaveState ss(g);
+                g.reduceClipRegion(bounds.withWidth(fillW).getSmallestIntegerContainer());
+                chrome.draw(g, bounds, ChromeCache::mixKey(kLayerBar, barColour.getARGB()),
+                            [barColour](juce::Graphics& cg, juce::Rectangle<float> r)
+                {
+                    cg.setColour(barColour);
+                    cg.fillRoundedRectangle(r, kCornerSize);
+
+                    // Subtle glow on top
+                    cg.setColour(juce::Colours::white.withAlpha(0.08f));
+                    cg.fillRoundedRectangle(r.withHeight(r.getHeight() * 0.4f), kCornerSize);
+                });
+            }
 
             // Clipping indicator: flash full bar red when level > 1.0
             if (currentLevel > 1.0f)
             {
                 g.setColour(juce::Colour(0xFFC62828).withAlpha(0.3f));
-                g.fillRoundedRectangle(bounds, cornerSize);
+                g.fillRoundedRectangle(bounds, kCornerSize);
             }
         }
 
-        // Border
-        g.setColour(juce::Colour(0xFF2A2D35));
-        g.drawRoundedRectangle(bounds, cornerSize, 0.5f);
+        // Border + tick marks at -12dB (~0.25), -6dB (~0.5), 0dB (~1.0)
+        chrome.draw(g, fullBounds, kLayerOverlay, [](juce::Graphics& cg, juce::Rectangle<float> r)
+        {
+            auto inner = r.reduced(1.0f);
+            cg.setColour(juce::Colour(0xFF2A2D35));
+            cg.drawRoundedRectangle(inner, kCornerSize, 0.5f);
+
+            cg.setColour(juce::Colour(0xFF2A2D35).withAlpha(0.6f));
+            for (float tp : { 0.25f, 0.5f, 0.75f })
+            {
+                float x = inner.getX() + inner.getWidth() * tp;
+                cg.drawLine(x, inner.getY(), x, inner.getBottom(), 0.5f);
+            }
+        });
+    }
+
+private:
+    static constexpr float kCornerSize = 2.0f;
+    static constexpr uint64_t kLayerBackground = 1, kLayerBar = 2, kLayerOverlay = 3;
+
+    /// Green -> Yellow -> Red based on actual level (not clamped)
+    static int colourZone(float level)
+    {
+        return level < 0.6f ? 0 : level < 0.85f ? 1 : 2;
+    }
+
+    juce::Colour zoneColour(int zone) const
+    {
+        if (zone == 0) return meterColour.withAlpha(0.7f);
+        if (zone == 1) return juce::Colour(0xFFFFAB00).withAlpha(0.8f);
+        return juce::Colour(0xFFC62828).withAlpha(0.9f);
+    }
 
-        // Tick marks at -12dB (~0.25), -6dB (~0.5), 0dB (~1.0)
-        g.setColour(juce::Colour(0xFF2A2D35).withAlpha(0.6f));
-        float tickPositions[] = { 0.25f, 0.5f, 0.75f };
-        for (float tp : tickPositions)
+    /// Invalidates only the strip between the old and new bar ends while
+    /// the bar keeps its colour; a zone or clip change repaints the meter.
+    void repaintChangedSpan(float oldLevel, float newLevel)
+    {
+        const bool oldOn = oldLevel > 0.001f, newOn = newLevel > 0.001f;
+        if ((oldOn && newOn && colourZone(oldLevel) != colourZone(newLevel))
+            || (oldLevel > 1.0f) != (newLevel > 1.0f))
         {
-            float x = bounds.getX() + bounds.getWidth() * tp;
-            g.drawLine(x, bounds.getY(), x, bounds.getBottom(), 0.5f);
+            repaint();
+            return;
         }
+
+        auto bounds = getLocalBounds().toFloat().reduced(1.0f);
+        const float x0 = bounds.getX() + bounds.getWidth() * juce::jmin(1.0f, oldOn ? oldLevel : 0.0f);
+        const float x1 = bounds.getX() + bounds.getWidth() * juce::jmin(1.0f, newOn ? newLevel : 0.0f);
+        if (std::abs(x1 - x0) < 0.01f) return;
+
+        // 1px slack either side for the anti-aliased bar edge
+        const int left  = (int)std::floor(juce::jmin(x0, x1)) - 1;
+        const int right = (int)std::ceil (juce::jmax(x0, x1)) + 1;
+        repaint(juce::Rectangle<int>(left, 0, right - left, getHeight()).getIntersection(getLocalBounds()));
     }
 
-private:
     float currentLevel = 0.0f;
     juce::Colour meterColour { 0xFF2E7D32 };  // Default green
+    ChromeCache chrome { 6 };                 // background, overlay, bar per colour zone
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeter)
 };
@@ -5,6 +5,7 @@
 #pragma once
 #include <JuceHeader.h>
 #include "TimecodeCore.h"
+#include "AudioDeviceHub.h"
 #include <atomic>
 #include <cmath>
 #include <cstring>
@@ -35,32 +36,8 @@ public:
         currentDeviceName = devName;
         currentTypeName   = typeName;
 
-        deviceManager.closeAudioDevice();
-
-        // Register all device types without opening anything
-        deviceManager.initialise(128, 0, nullptr, false);
-
-        // Switch to requested type WITHOUT auto-opening (false)
-        if (typeName.isNotEmpty())
-            deviceManager.setCurrentAudioDeviceType(typeName, false);
-
-        // Scan so the device name is recognised
-        if (auto* type = deviceManager.getCurrentDeviceTypeObject())
-            type->scanForDevices();
-
-        // Open the specific device -- single open call
-        auto setup = deviceManager.getAudioDeviceSetup();
-        setup.inputDeviceName   = devName;
-        setup.outputDeviceName  = "";
-        setup.useDefaultInputChannels  = true;
-        setup.useDefaultOutputChannels = false;
-        if (sampleRate > 0)  setup.sampleRate = sampleRate;
-        if (bufferSize > 0)  setup.bufferSize = bufferSize;
-        auto err = deviceManager.setAudioDeviceSetup(setup, true);
-        if (err.isNotEmpty())
-            return false;
-
-        auto* device = deviceManager.getCurrentAudioDevice();
+        auto* device = audioHub->attach(this, typeName, devName, AudioDeviceHub::input,
+                                        sampleRate, bufferSize);
         if (!device)
             return false;
 
@@ -81,12 +58,12 @@ public:
         currentBufferSize = device->getCurrentBufferSizeSamples();
 
         // resetDecoder() and resetPassthruBuffer() are called by
-        // audioDeviceAboutToStart() when addAudioCallback triggers the device;
+        // audioDeviceAboutToStart() when the hub starts this client;
         // only peak levels need explicit reset here since they're not part of
         // the device-start callback.
         ltcPeakLevel.store(0.0f, std::memory_order_relaxed);
         thruPeakLevel.store(0.0f, std::memory_order_relaxed);
-        deviceManager.addAudioCallback(this);
+        audioHub->start(this);
         isRunningFlag.store(true, std::memory_order_relaxed);
         return true;
     }
@@ -95,8 +72,7 @@ public:
     {
         if (isRunningFlag.load(std::memory_order_relaxed))
         {
-            deviceManager.removeAudioCallback(this);
-            deviceManager.closeAudioDevice();
+            audioHub->detach(this);
             isRunningFlag.store(false, std::memory_order_relaxed);
         }
     }
@@ -190,7 +166,7 @@ public:
     }
 
 private:
-    juce::AudioDeviceManager deviceManager;
+    juce::SharedResourcePointer<AudioDeviceHub> audioHub;
     juce::String currentDeviceName;
     juce::String currentTypeName;
     std::atomic<bool> isRunningFlag { false };
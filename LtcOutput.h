@@ -5,6 +5,7 @@
 #pragma once
 #include <JuceHeader.h>
 #include "TimecodeCore.h"
+#include "AudioDeviceHub.h"
 #include <atomic>
 #include <cmath>
 #include <cstdlib>
@@ -29,32 +30,8 @@ public:
         currentDeviceName = devName;
         currentTypeName = typeName;
 
-        deviceManager.closeAudioDevice();
-
-        // Register all device types without opening anything
-        deviceManager.initialise(0, 128, nullptr, false);
-
-        // Switch to requested type WITHOUT auto-opening a device (false)
-        if (typeName.isNotEmpty())
-            deviceManager.setCurrentAudioDeviceType(typeName, false);
-
-        // Scan so the device name is recognised
-        if (auto* type = deviceManager.getCurrentDeviceTypeObject())
-            type->scanForDevices();
-
-        // Open the specific device -- this is the ONLY open call
-        auto setup = deviceManager.getAudioDeviceSetup();
-        setup.outputDeviceName  = devName;
-        setup.inputDeviceName   = "";
-        setup.useDefaultInputChannels  = false;
-        setup.useDefaultOutputChannels = true;
-        if (sampleRate > 0)  setup.sampleRate = sampleRate;
-        if (bufferSize > 0)  setup.bufferSize = bufferSize;
-        auto err = deviceManager.setAudioDeviceSetup(setup, true);
-        if (err.isNotEmpty())
-            return false;
-
-        auto* device = deviceManager.getCurrentAudioDevice();
+        auto* device = audioHub->attach(this, typeName, devName, AudioDeviceHub::output,
+                                        sampleRate, bufferSize);
         if (!device)
             return false;
 
@@ -73,7 +50,7 @@ public:
 
         resetEncoder();
         peakLevel.store(0.0f, std::memory_order_relaxed);
-        deviceManager.addAudioCallback(this);
+        audioHub->start(this);
         isRunningFlag.store(true, std::memory_order_relaxed);
         return true;
     }
@@ -82,8 +59,7 @@ public:
     {
         if (isRunningFlag.load(std::memory_order_relaxed))
         {
-            deviceManager.removeAudioCallback(this);
-            deviceManager.closeAudioDevice();
+            audioHub->detach(this);
             isRunningFlag.store(false, std::memory_order_relaxed);
         }
     }
@@ -128,7 +104,7 @@ public:
     float getPeakLevel() const        { return peakLevel.load(std::memory_order_relaxed); }
 
 private:
-    juce::AudioDeviceManager deviceManager;
+    juce::SharedResourcePointer<AudioDeviceHub> audioHub;
     juce::String currentDeviceName;
     juce::String currentTypeName;
     std::atomic<bool> isRunningFlag { false };
@@ -94,6 +94,7 @@ MainComponent::MainComponent()
     engines.push_back(std::make_unique<TimecodeEngine>(0));
     engines[0]->setSharedProDJLinkInput(&sharedProDJLinkInput);
     engines[0]->setSharedStageLinQInput(&sharedStageLinQInput);
+    engines[0]->setArtnetDiscovery(&artnetDiscovery);
     sharedStageLinQInput.onMetadataRequest = [this](const juce::String& path)
     {
         sharedStageLinQDb.requestMetadata(path);
@@ -108,6 +109,7 @@ MainComponent::MainComponent()
     };
     engines[0]->setDbServerClient(&sharedDbClient);
     engines[0]->setTrackMap(&settings.trackMap);
+    engines[0]->setTrackBindings(&settings.trackBindings);
     engines[0]->setMixerMap(&sharedMixerMap);
     engines[0]->setSlqMixerMap(&sharedSlqMixerMap);
 
@@ -184,7 +186,7 @@ MainComponent::MainComponent()
     };
 
     // --- Output toggles ---
-    for (auto* btn : { &btnMtcOut, &btnArtnetOut, &btnLtcOut, &btnThruOut, &btnTcnetOut })
+    for (auto* btn : { &btnMtcOut, &btnArtnetOut, &btnLtcOut, &btnThruOut, &btnTcnetOut, &btnOscTcOut })
         rightContent.addAndMakeVisible(btn);
 
     styleOutputToggle(btnMtcOut, accentRed);
@@ -192,6 +194,7 @@ MainComponent::MainComponent()
     styleOutputToggle(btnLtcOut, accentPurple);
     styleOutputToggle(btnThruOut, accentCyan);
     styleOutputToggle(btnTcnetOut, juce::Colour(0xFF00CC66));
+    styleOutputToggle(btnOscTcOut, juce::Colour(0xFFFFAB00));
 
     // On-air gate lives in the ProDJLink input panel (it gates input activity,
     // not a particular output). Use the small tick-style toggle like btnLink
@@ -219,6 +222,7 @@ MainComponent::MainComponent()
         eng.setOutputLtcEnabled(btnLtcOut.getToggleState());
         eng.setOutputThruEnabled(btnThruOut.getToggleState());
         eng.setOutputTcnetEnabled(btnTcnetOut.getToggleState());
+        eng.setOutputOscTcEnabled(btnOscTcOut.getToggleState());
 
         // Auto-start/stop shared TCNet output based on any engine needing it
         bool anyTcnet = false;
@@ -240,6 +244,7 @@ MainComponent::MainComponent()
         saveSettings();
     };
     btnMtcOut.onClick = btnArtnetOut.onClick = btnLtcOut.onClick = btnThruOut.onClick = btnTcnetOut.onClick = outputToggleHandler;
+    btnOscTcOut.onClick = outputToggleHandler;
 
     // --- Collapse toggle buttons for outputs ---
     for (auto* btn : { &btnCollapseMtcOut, &btnCollapseArtnetOut, &btnCollapseLtcOut, &btnCollapseThruOut })
@@ -960,13 +965,9 @@ MainComponent::MainComponent()
         if (isShowLockedToggle(btnArtnetMixerFwd)) return;
         currentEngine().setArtnetMixerForward(btnArtnetMixerFwd.getToggleState(),
                                                getArtNetAddressFromCombos(cmbArtMixNet, cmbArtMixSub, cmbArtMixUni));
-        // Ensure ArtNet output is running -- DMX uses the same socket.
-        // If ArtNet timecode out is already running, this is a no-op.
-        if (btnArtnetMixerFwd.getToggleState() && !currentEngine().getArtnetOutput().getIsRunning())
-        {
-            int iface = cmbArtnetDmxInterface.getSelectedId() - 2;  // -1=All, 0+=NIC
-            currentEngine().startArtnetOutput(iface);
-        }
+        // Ensure the DMX sender(s) are running -- Art-Net DMX uses the same
+        // socket as timecode out, so that part is a no-op if it's running.
+        startCurrentDmxOutputs();
         propagateGlobalSettings();
         updateDeviceSelectorVisibility();
         saveSettings();
@@ -1228,12 +1229,8 @@ MainComponent::MainComponent()
         if (syncing) return;
         if (isShowLockedToggle(btnArtnetTrigger)) return;
         currentEngine().setArtnetTriggerEnabled(btnArtnetTrigger.getToggleState());
-        // Ensure ArtNet output is running if enabled
-        if (btnArtnetTrigger.getToggleState() && !currentEngine().getArtnetOutput().getIsRunning())
-        {
-            int iface = cmbArtnetDmxInterface.getSelectedId() - 2;  // -1=All, 0+=NIC
-            currentEngine().startArtnetOutput(iface);
-        }
+        // Ensure the DMX sender(s) are running if enabled
+        startCurrentDmxOutputs();
         updateDeviceSelectorVisibility();
         saveSettings();
     };
@@ -1250,7 +1247,7 @@ MainComponent::MainComponent()
     cmbArtTrigUni.setSelectedId(2, juce::dontSendNotification);
 
     // Art-Net DMX interface selector (for triggers and mixer forward)
-    addLabelAndCombo(lblArtnetDmxInterface, cmbArtnetDmxInterface, "ART-NET DMX INTERFACE:");
+    addLabelAndCombo(lblArtnetDmxInterface, cmbArtnetDmxInterface, "DMX INTERFACE:");
     cmbArtnetDmxInterface.onChange = [this]
     {
         if (syncing) return;
@@ -1261,12 +1258,80 @@ MainComponent::MainComponent()
         {
             int sel = cmbArtnetDmxInterface.getSelectedId() - 2;  // -1=All, 0+=NIC
             // Restart ArtnetOutput on the new interface (only if timecode output isn't controlling it)
-            if (!eng.isOutputArtnetEnabled() || !eng.getArtnetOutput().getIsRunning())
+            if (eng.dmxUsesArtnet() && (!eng.isOutputArtnetEnabled() || !eng.getArtnetOutput().getIsRunning()))
                 eng.startArtnetOutput(sel);
+            if (eng.dmxUsesSacn())
+                eng.startSacnOutput(sel);
         }
         saveSettings();
     };
 
+    // DMX transport for triggers + mixer forward
+    addLabelAndCombo(lblDmxProtocol, cmbDmxProtocol, "DMX PROTOCOL:");
+    cmbDmxProtocol.addItem("Art-Net (Broadcast)", 1);
+    cmbDmxProtocol.addItem("sACN / E1.31 (Multicast)", 2);
+    cmbDmxProtocol.addItem("Art-Net + sACN", 3);
+    cmbDmxProtocol.setSelectedId(1, juce::dontSendNotification);
+    cmbDmxProtocol.onChange = [this]
+    {
+        if (syncing) return;
+        if (isShowLockedRevert()) return;
+        currentEngine().setDmxProtocol((TimecodeEngine::DmxProtocol)(cmbDmxProtocol.getSelectedId() - 1));
+        startCurrentDmxOutputs();
+        updateDeviceSelectorVisibility();
+        resized();
+        saveSettings();
+    };
+
+    addLabelAndCombo(lblSacnPriority, cmbSacnPriority, "sACN PRIORITY:");
+    for (int p = 0; p <= SacnOutput::kMaxPriority; p += 25)
+        cmbSacnPriority.addItem(juce::String(p) + (p == SacnOutput::kDefaultPriority ? " (default)" : ""), p + 1);
+    cmbSacnPriority.setSelectedId(SacnOutput::kDefaultPriority + 1, juce::dontSendNotification);
+    cmbSacnPriority.onChange = [this]
+    {
+        if (syncing) return;
+        if (isShowLockedRevert()) return;
+        currentEngine().setSacnPriority(cmbSacnPriority.getSelectedId() - 1);
+        saveSettings();
+    };
+
+    leftContent.addAndMakeVisible(btnSacnSync);
+    btnSacnSync.setVisible(false);
+    btnSacnSync.setColour(juce::ToggleButton::textColourId, textMid);
+    btnSacnSync.setColour(juce::ToggleButton::tickColourId, accentAmber);
+    btnSacnSync.onClick = [this]
+    {
+        if (syncing) return;
+        if (isShowLockedToggle(btnSacnSync)) return;
+        currentEngine().setSacnSyncUniverse(btnSacnSync.getToggleState() ? SacnOutput::kMaxUniverse : 0);
+        saveSettings();
+    };
+
+    leftContent.addAndMakeVisible(lblSacnOutStatus);
+    styleLabel(lblSacnOutStatus);
+    lblSacnOutStatus.setColour(juce::Label::textColourId, accentAmber);
+
+    // ArtPoll discovery: global, shared by every engine's Art-Net DMX
+    leftContent.addAndMakeVisible(btnArtnetUnicast);
+    btnArtnetUnicast.setVisible(false);
+    btnArtnetUnicast.setColour(juce::ToggleButton::textColourId, textMid);
+    btnArtnetUnicast.setColour(juce::ToggleButton::tickColourId, accentAmber);
+    btnArtnetUnicast.setToggleState(true, juce::dontSendNotification);
+    btnArtnetUnicast.onClick = [this]
+    {
+        if (syncing) return;
+        if (isShowLockedToggle(btnArtnetUnicast)) return;
+        settings.artnetUnicast = btnArtnetUnicast.getToggleState();
+        if (settings.artnetUnicast)
+            artnetDiscovery.start();
+        else
+            artnetDiscovery.stop();
+        saveSettings();
+    };
+    leftContent.addAndMakeVisible(lblArtnetNodes);
+    styleLabel(lblArtnetNodes);
+    lblArtnetNodes.setColour(juce::Label::textColourId, accentAmber);
+
     addLabelAndCombo(lblAudioInputDevice, cmbAudioInputDevice, "AUDIO INPUT DEVICE:");
     cmbAudioInputDevice.onChange = [this]
     {
@@ -1358,7 +1423,7 @@ MainComponent::MainComponent()
             {
                 auto trigDevName = stripComboMarker(cmbTriggerMidiDevice.getText());
                 if (trigDevName == eng.getMtcOutput().getCurrentDeviceName())
-                    eng.getTriggerOutput().setSharedMidiOutput(eng.getMtcOutput().getMidiOutputPtr());
+                    eng.getTriggerOutput().setSharedMidiOutput(eng.getMtcOutput().getMidiScheduler());
                 else
                     applyTriggerSettings();  // reopen trigger on its own device
             }
@@ -1470,6 +1535,48 @@ MainComponent::MainComponent()
     lblHippoOutStatus.setFont(juce::Font(juce::FontOptions(11.0f)));
     lblHippoOutStatus.setColour(juce::Label::textColourId, textMid);
 
+    // --- OSC timecode stream output controls ---
+    rightContent.addAndMakeVisible(lblOscTcDest);
+    lblOscTcDest.setText("OSC TC DEST (IP:PORT):", juce::dontSendNotification);
+    styleLabel(lblOscTcDest);
+    rightContent.addAndMakeVisible(txtOscTcDest);
+    txtOscTcDest.setText("127.0.0.1:9900", false);
+    txtOscTcDest.setFont(juce::Font(juce::FontOptions(13.0f)));
+    txtOscTcDest.setColour(juce::TextEditor::backgroundColourId, juce::Colour(0xFF1A1D23));
+    txtOscTcDest.setColour(juce::TextEditor::textColourId, textBright);
+    txtOscTcDest.setColour(juce::TextEditor::outlineColourId, borderCol);
+    addRightLabelAndCombo(lblOscTcRate, cmbOscTcRate, "OSC TC RATE:");
+    for (int hz : { 25, 30, 50, 60, 100, 250, 500, 1000 })
+        cmbOscTcRate.addItem(juce::String(hz) + " Hz", hz);
+    cmbOscTcRate.setSelectedId(100, juce::dontSendNotification);
+    rightContent.addAndMakeVisible(btnOscTcTimetags);
+    btnOscTcTimetags.setColour(juce::ToggleButton::textColourId, textMid);
+    btnOscTcTimetags.setColour(juce::ToggleButton::tickColourId, accentAmber);
+    auto oscTcConfigChanged = [this]
+    {
+        if (syncing) return;
+        if (isShowLockedRevert()) return;
+        auto& eng = currentEngine();
+        auto dest = txtOscTcDest.getText().trim();
+        auto ip   = dest.upToFirstOccurrenceOf(":", false, false).trim();
+        int  port = dest.containsChar(':') ? dest.fromFirstOccurrenceOf(":", false, false).getIntValue()
+                                           : eng.getOscTcDestPort();
+        eng.setOscTcConfig(ip, port > 0 ? port : OscTimecodeOutput::kDefaultPort,
+                           cmbOscTcRate.getSelectedId() > 0 ? cmbOscTcRate.getSelectedId() : OscTimecodeOutput::kDefaultRateHz,
+                           btnOscTcTimetags.getToggleState());
+        txtOscTcDest.setText(eng.getOscTcDestIp() + ":" + juce::String(eng.getOscTcDestPort()), false);
+        if (eng.isOutputOscTcEnabled())
+            startCurrentOscTcOutput();
+        saveSettings();
+    };
+    txtOscTcDest.onReturnKey = oscTcConfigChanged;
+    txtOscTcDest.onFocusLost = oscTcConfigChanged;
+    cmbOscTcRate.onChange    = oscTcConfigChanged;
+    btnOscTcTimetags.onClick = oscTcConfigChanged;
+    rightContent.addAndMakeVisible(lblOscTcOutStatus);
+    styleLabel(lblOscTcOutStatus);
+    lblOscTcOutStatus.setColour(juce::Label::textColourId, accentAmber);
+
     addRightLabelAndCombo(lblAudioOutputTypeFilter, cmbAudioOutputTypeFilter, "AUDIO DRIVER:");
     cmbAudioOutputTypeFilter.onChange = [this]
     {
@@ -1587,14 +1694,15 @@ MainComponent::MainComponent()
     for (auto* cmb : { &cmbAudioInputDevice, &cmbAudioOutputDevice, &cmbThruOutputDevice })
         cmb->addItem("Scanning...", kPlaceholderItemId);
 
-    startTimerHz(60);
+    startTimerHz(60);                        // engines (fixed rate)
+    frameScheduler->addClient(this, 60);     // selected-engine display (adaptive)
     startAudioDeviceScan();
 
-    // GPU-accelerated rendering: DISABLED for thread safety.
+    // GPU-accelerated rendering: no plain OpenGL context, for thread safety.
     //
     // When glContext.attachTo(*this) is active, JUCE calls paint() for ALL
     // child components on the OpenGL thread -- not the message thread.
-    // Meanwhile, timerCallback() writes juce::String members (artist, title,
+    // Meanwhile, uiFrame() writes juce::String members (artist, title,
     // playState, sourceName, etc.) on the message thread.  juce::String is
     // reference-counted: a concurrent read during write can corrupt the
     // refcount and crash.  This affects TimecodeDisplay, ProDJLinkView,
@@ -1610,15 +1718,22 @@ MainComponent::MainComponent()
     //
     // For a live performance application, eliminating the entire class of
     // GL-thread data races is worth more than the marginal compositing
-    // speedup.  If GPU acceleration is ever re-enabled, all juce::String
-    // members read in paint() must be replaced with atomic-safe types
-    // (fixed char arrays, packed atomics, or a SpinLock-protected snapshot).
+    // speedup.  Optional GPU compositing (settings.gpuCompositing or
+    // STC_GPU_COMPOSITING=1) goes through GpuCompositor instead: components
+    // repaint only their invalidated areas on the message thread into
+    // immutable image tiles and the GL thread only composites those tiles,
+    // so the race cannot happen.  It falls back to this software path when
+    // no GL context comes up.
+    if (GpuCompositor::isRequested(settings.gpuCompositing))
+        gpuCompositor = std::make_unique<GpuCompositor>(*this);
 }
 
 MainComponent::~MainComponent()
 {
-    // 1. Stop our UI timer first -- no more timerCallback() after this
+    // 1. Stop our UI timer first -- no more timerCallback() / uiFrame() after this
     stopTimer();
+    frameScheduler->removeClient(this);
+    gpuCompositor = nullptr;   // joins the GL thread; back to software painting
 
     // 2. Detach LookAndFeel before destroying any child components
     setLookAndFeel(nullptr);
@@ -1688,6 +1803,7 @@ MainComponent::~MainComponent()
     }
 
     settings.save();
+    settings.flushPendingWrites();   // settings.json + presets on disk before exit
 
     // 7. Stop ProDJLink receiver FIRST. This joins its thread, so no more
     //    gcPlayers() calls can fire onPlayerLost after this returns.
@@ -1717,10 +1833,12 @@ MainComponent::~MainComponent()
     {
         eng->setMidiClockEnabled(false);
         eng->setTrackMap(nullptr);
+        eng->setTrackBindings(nullptr);
         eng->setMixerMap(nullptr);
         eng->setSlqMixerMap(nullptr);
         eng->setSharedProDJLinkInput(nullptr);
         eng->setSharedStageLinQInput(nullptr);
+        eng->setArtnetDiscovery(nullptr);
         eng->setDbServerClient(nullptr);
         eng->stopMtcOutput();
         eng->stopArtnetOutput();
@@ -1757,8 +1875,10 @@ void MainComponent::addEngine()
     engines.push_back(std::make_unique<TimecodeEngine>(newIndex, newName));
     engines.back()->setSharedProDJLinkInput(&sharedProDJLinkInput);
     engines.back()->setSharedStageLinQInput(&sharedStageLinQInput);
+    engines.back()->setArtnetDiscovery(&artnetDiscovery);
     engines.back()->setDbServerClient(&sharedDbClient);
     engines.back()->setTrackMap(&settings.trackMap);
+    engines.back()->setTrackBindings(&settings.trackBindings);
     engines.back()->setMixerMap(&sharedMixerMap);
     engines.back()->setSlqMixerMap(&sharedSlqMixerMap);
     rebuildTabButtons();
@@ -1785,10 +1905,12 @@ void MainComponent::removeEngine(int index)
     // erasing it, so destructors don't race with any pending callbacks.
     // Disconnect shared pointers first to prevent stale access during stop.
     engines[(size_t)index]->setTrackMap(nullptr);
+    engines[(size_t)index]->setTrackBindings(nullptr);
     engines[(size_t)index]->setMixerMap(nullptr);
     engines[(size_t)index]->setSlqMixerMap(nullptr);
     engines[(size_t)index]->setSharedProDJLinkInput(nullptr);
     engines[(size_t)index]->setSharedStageLinQInput(nullptr);
+    engines[(size_t)index]->setArtnetDiscovery(nullptr);
     engines[(size_t)index]->setDbServerClient(nullptr);
     engines[(size_t)index]->setMidiClockEnabled(false);
     engines[(size_t)index]->getTriggerOutput().setSharedMidiOutput(nullptr);
@@ -1871,6 +1993,7 @@ void MainComponent::selectEngine(int index)
     syncUIFromEngine();
     updateTabAppearance();
     repaint();
+    frameScheduler->requestFrame(this);   // new engine's display now, not at the idle rate
 }
 
 void MainComponent::renameEngine(int index)
@@ -1991,6 +2114,10 @@ void MainComponent::syncUIFromEngine()
     btnTcnetOut.setToggleState(eng.isOutputTcnetEnabled(), juce::dontSendNotification);
     repopulateTcnetLayerCombo();
     btnHippoOut.setToggleState(eng.isOutputHippoEnabled(), juce::dontSendNotification);
+    btnOscTcOut.setToggleState(eng.isOutputOscTcEnabled(), juce::dontSendNotification);
+    txtOscTcDest.setText(eng.getOscTcDestIp() + ":" + juce::String(eng.getOscTcDestPort()), false);
+    cmbOscTcRate.setSelectedId(eng.getOscTcRateHz(), juce::dontSendNotification);
+    btnOscTcTimetags.setToggleState(eng.isOscTcTimetagsEnabled(), juce::dontSendNotification);
     if (selectedEngine < (int)settings.engines.size())
         txtHippoDestIp.setText(settings.engines[(size_t)selectedEngine].hippotizerDestIp, false);
 
@@ -2065,6 +2192,8 @@ void MainComponent::syncUIFromEngine()
         if (artOutId <= cmbArtnetOutputInterface.getNumItems())
             cmbArtnetOutputInterface.setSelectedId(artOutId, juce::dontSendNotification);
 
+        btnArtnetUnicast.setToggleState(settings.artnetUnicast, juce::dontSendNotification);
+
         // TCNet interface combo (global setting, not per-engine)
         int tcnetIfId = settings.tcnetInterface + 2;  // -1->1(All), 0->2, 1->3...
         if (tcnetIfId < 1) tcnetIfId = 1;
@@ -2089,6 +2218,10 @@ void MainComponent::syncUIFromEngine()
         edOscFwdBpmAddr.setText(eng.getOscFwdBpmAddr(), false);
         edOscFwdBpmCmd.setText(eng.getOscFwdBpmCmd(), false);
 
+        cmbDmxProtocol.setSelectedId((int)eng.getDmxProtocol() + 1, juce::dontSendNotification);
+        cmbSacnPriority.setSelectedId((eng.getSacnPriority() / 25) * 25 + 1, juce::dontSendNotification);
+        btnSacnSync.setToggleState(eng.getSacnSyncUniverse() > 0, juce::dontSendNotification);
+
         // Art-Net DMX interface (for trigger + mixer forward)
         {
             int artDmxId = es.artnetDmxInterface + 2;  // -1->1 (All), 0->2, 1->3...
@@ -2395,7 +2528,7 @@ void MainComponent::applyTriggerSettings()
             && trigDevName == eng.getMtcOutput().getCurrentDeviceName())
         {
             trig.releaseOwnMidi();
-            trig.setSharedMidiOutput(eng.getMtcOutput().getMidiOutputPtr());
+            trig.setSharedMidiOutput(eng.getMtcOutput().getMidiScheduler());
         }
         else
         {
@@ -2490,7 +2623,7 @@ void MainComponent::openTrackMapEditor()
 
     auto& eng = currentEngine();
 
-    auto* editor = new TrackMapEditor(settings.trackMap, &sharedProDJLinkInput);
+    auto* editor = new TrackMapEditor(settings.trackMap, trackMapIndex, &sharedProDJLinkInput);
     editor->setDbServerClient(&sharedDbClient);
     {
         auto info = eng.getActiveTrackInfo();
@@ -2759,8 +2892,9 @@ void MainComponent::openCuePointEditor(TrackMapEntry* entry)
     if (!foundMeta && entry->durationSec > 0)
         cuePointWindow->setDurationMs((uint32_t)entry->durationSec * 1000);
 
-    cuePointWindow->setOnChange([this]
+    cuePointWindow->setOnChange([this, entry]
     {
+        settings.trackMap.markChanged(*entry);   // edited in place by the cue editor
         settings.trackMap.save();
         for (auto& eng : engines)
             eng->refreshTrackMapLookup();
@@ -2903,6 +3037,8 @@ void MainComponent::openProDJLinkView()
     proDJLinkViewWindow->setLayoutState(settings.pdlViewHorizontal, settings.pdlViewShowMixer);
     if (settings.pdlViewBounds.isNotEmpty())
         proDJLinkViewWindow->restoreFromBoundsString(settings.pdlViewBounds);
+    if (GpuCompositor::isRequested(settings.gpuCompositing))
+        proDJLinkViewWindow->enableGpuCompositing();
 
     proDJLinkViewWindow->setOnTrackMapChanged([this]
     {
@@ -2956,6 +3092,8 @@ void MainComponent::openStageLinQView()
     // Restore layout state and bounds
     if (settings.slqViewBounds.isNotEmpty())
         stageLinQViewWindow->restoreFromBoundsString(settings.slqViewBounds);
+    if (GpuCompositor::isRequested(settings.gpuCompositing))
+        stageLinQViewWindow->enableGpuCompositing();
 
     stageLinQViewWindow->setOnLayoutChanged([this]
     {
@@ -2983,16 +3121,18 @@ void MainComponent::openStageLinQView()
 //==============================================================================
 void MainComponent::exportConfig()
 {
+    if (showPackageJob != nullptr) return;
+
     // Save current state to disk first so the export is up-to-date
     saveSettings();
     sharedMixerMap.save();
     sharedSlqMixerMap.save();
 
     configFileChooser = std::make_unique<juce::FileChooser>(
-        "Export STC Configuration",
+        "Export STC Show Package",
         juce::File::getSpecialLocation(juce::File::userDesktopDirectory)
-            .getChildFile("stc_backup.json"),
-        "*.json");
+            .getChildFile("stc_show.stcshow"),
+        "*.stcshow");
 
     configFileChooser->launchAsync(
         juce::FileBrowserComponent::saveMode | juce::FileBrowserComponent::canSelectFiles,
@@ -3000,18 +3140,38 @@ void MainComponent::exportConfig()
         {
             auto file = fc.getResult();
             if (file == juce::File()) return;
+            file = file.withFileExtension("stcshow");
 
-            auto bundle = settings.buildExportBundle();
-            file.replaceWithText(juce::JSON::toString(bundle));
+            // Snapshot on the message thread; packing runs on the job thread
+            auto contents = std::make_shared<AppSettings::ShowPackageContents>(
+                settings.collectShowPackage());
+
+            showPackageJob = std::make_unique<ShowPackageJob>("Exporting show package...",
+                [contents, file](const ShowPackageProgressFn& progress)
+                {
+                    return AppSettings::writeShowPackage(*contents, file, progress);
+                },
+                [this, file](bool ok, bool cancelled)
+                {
+                    juce::MessageManager::callAsync([this] { showPackageJob.reset(); });
+                    if (!ok && !cancelled)
+                        juce::AlertWindow::showMessageBoxAsync(
+                            juce::MessageBoxIconType::WarningIcon,
+                            "Export Failed",
+                            "Could not write " + file.getFullPathName());
+                });
+            showPackageJob->launchThread();
         });
 }
 
 void MainComponent::importConfig()
 {
+    if (showPackageJob != nullptr) return;
+
     configFileChooser = std::make_unique<juce::FileChooser>(
         "Import STC Configuration",
         juce::File::getSpecialLocation(juce::File::userDesktopDirectory),
-        "*.json");
+        "*.stcshow;*.json");
 
     configFileChooser->launchAsync(
         juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
@@ -3020,15 +3180,22 @@ void MainComponent::importConfig()
             auto file = fc.getResult();
             if (file == juce::File() || !file.existsAsFile()) return;
 
-            auto parsed = juce::JSON::parse(file.loadFileAsString());
-            auto* obj = parsed.getDynamicObject();
-            if (!obj || !obj->hasProperty("stc_backup_version"))
+            // Show packages are read on the restore job; .json is the
+            // older single-file backup
+            const bool isPackage = file.hasFileExtension("stcshow");
+            juce::var parsed;
+            if (!isPackage)
             {
-                juce::AlertWindow::showMessageBoxAsync(
-                    juce::MessageBoxIconType::WarningIcon,
-                    "Import Failed",
-                    "This file is not a valid STC backup.");
-                return;
+                parsed = juce::JSON::parse(file.loadFileAsString());
+                auto* obj = parsed.getDynamicObject();
+                if (!obj || !obj->hasProperty("stc_backup_version"))
+                {
+                    juce::AlertWindow::showMessageBoxAsync(
+                        juce::MessageBoxIconType::WarningIcon,
+                        "Import Failed",
+                        "This file is not a valid STC backup.");
+                    return;
+                }
             }
 
             auto options = juce::MessageBoxOptions()
@@ -3041,37 +3208,79 @@ void MainComponent::importConfig()
                 .withButton("Cancel");
 
             importConfirmBox = juce::AlertWindow::showScopedAsync(options,
-                [this, parsed](int result)
+                [this, parsed, file, isPackage](int result)
                 {
                     if (result != 1) return;
 
-                    if (settings.applyImportBundle(parsed))
-                    {
-                        // Reload settings into live state
-                        settings.load();
-                        sharedMixerMap.resetToDefaults();
-                        sharedMixerMap.load();
-                        sharedSlqMixerMap.resetToDefaults();
-                        sharedSlqMixerMap.load();
-
-                        juce::AlertWindow::showMessageBoxAsync(
-                            juce::MessageBoxIconType::InfoIcon,
-                            "Import Complete",
-                            "Configuration restored successfully.\n\n"
-                            "Please restart STC to fully apply all settings "
-                            "(engine configuration, audio devices, etc.).");
-                    }
+                    if (isPackage)
+                        startShowPackageRestore(file);
                     else
-                    {
-                        juce::AlertWindow::showMessageBoxAsync(
-                            juce::MessageBoxIconType::WarningIcon,
-                            "Import Failed",
-                            "Could not apply the backup file.");
-                    }
+                        finishConfigImport(settings.applyImportBundle(parsed));
                 });
         });
 }
 
+void MainComponent::startShowPackageRestore(const juce::File& package)
+{
+    if (showPackageJob != nullptr) return;
+
+    // Engines keep learning bindings and the UI keeps saving while the job
+    // runs; none of that may land on top of the restored files
+    settings.suspendWrites();
+
+    auto restored = std::make_shared<AppSettings::ShowPackageRestore>();
+    showPackageJob = std::make_unique<ShowPackageJob>("Restoring show package...",
+        [package, restored](const ShowPackageProgressFn& progress)
+        {
+            return AppSettings::restoreShowPackage(package, *restored, progress);
+        },
+        [this, restored](bool, bool cancelled)
+        {
+            juce::MessageManager::callAsync([this] { showPackageJob.reset(); });
+
+            settings.flushPendingWrites();   // nothing queued may follow the extraction
+
+            // Cancelling while the cache is unpacked only skips the pre-warm
+            if (restored->configRestored)
+            {
+                settings.applyShowPackageRestore(*restored);
+                DBG("Show package restored: " << restored->cacheFiles << " cache files");
+            }
+            if (restored->configRestored || !cancelled)
+                finishConfigImport(restored->configRestored);
+
+            settings.resumeWrites();   // live state now comes from the restored files
+        });
+    showPackageJob->launchThread();
+}
+
+void MainComponent::finishConfigImport(bool ok)
+{
+    if (ok)
+    {
+        // Reload settings into live state
+        settings.load();
+        sharedMixerMap.resetToDefaults();
+        sharedMixerMap.load();
+        sharedSlqMixerMap.resetToDefaults();
+        sharedSlqMixerMap.load();
+
+        juce::AlertWindow::showMessageBoxAsync(
+            juce::MessageBoxIconType::InfoIcon,
+            "Import Complete",
+            "Configuration restored successfully.\n\n"
+            "Please restart STC to fully apply all settings "
+            "(engine configuration, audio devices, etc.).");
+    }
+    else
+    {
+        juce::AlertWindow::showMessageBoxAsync(
+            juce::MessageBoxIconType::WarningIcon,
+            "Import Failed",
+            "Could not apply the backup file.");
+    }
+}
+
 void MainComponent::startCurrentThruOutput()
 {
     auto& eng = currentEngine();
@@ -3118,7 +3327,7 @@ void MainComponent::startCurrentMtcOutput()
     {
         auto trigDevName = stripComboMarker(cmbTriggerMidiDevice.getText());
         if (trigDevName == eng.getMtcOutput().getCurrentDeviceName())
-            trig.setSharedMidiOutput(eng.getMtcOutput().getMidiOutputPtr());
+            trig.setSharedMidiOutput(eng.getMtcOutput().getMidiScheduler());
         else
             trig.setSharedMidiOutput(nullptr);
     }
@@ -3133,6 +3342,32 @@ void MainComponent::startCurrentArtnetOutput()
     eng.startArtnetOutput(sel);
 }
 
+void MainComponent::startCurrentDmxOutputs()
+{
+    auto& eng = currentEngine();
+    bool needsDmx = eng.isArtnetMixerForwardEnabled() || eng.isArtnetTriggerEnabled();
+    int iface = cmbArtnetDmxInterface.getSelectedId() - 2;  // -1=All, 0+=NIC
+
+    // Art-Net DMX rides on the timecode output's socket: start it only if idle
+    if (needsDmx && eng.dmxUsesArtnet() && !eng.getArtnetOutput().getIsRunning())
+        eng.startArtnetOutput(iface);
+
+    if (needsDmx && eng.dmxUsesSacn())
+    {
+        if (!eng.getSacnOutput().getIsRunning())
+            eng.startSacnOutput(iface);
+    }
+    else if (eng.getSacnOutput().getIsRunning())
+    {
+        eng.stopSacnOutput();   // sends stream-terminated so receivers release
+    }
+}
+
+void MainComponent::startCurrentOscTcOutput()
+{
+    currentEngine().startOscTimecodeOutput();
+}
+
 void MainComponent::startCurrentLtcOutput()
 {
     auto& eng = currentEngine();
@@ -3179,6 +3414,9 @@ void MainComponent::updateCurrentOutputStates()
     if (eng.isOutputArtnetEnabled() && !eng.getArtnetOutput().getIsRunning()) startCurrentArtnetOutput();
     else if (!eng.isOutputArtnetEnabled() && eng.getArtnetOutput().getIsRunning()) eng.stopArtnetOutput();
 
+    if (eng.isOutputOscTcEnabled() && !eng.getOscTimecodeOutput().getIsRunning()) startCurrentOscTcOutput();
+    else if (!eng.isOutputOscTcEnabled() && eng.getOscTimecodeOutput().getIsRunning()) eng.stopOscTimecodeOutput();
+
     if (eng.isOutputLtcEnabled() && !eng.getLtcOutput().getIsRunning() && !scannedAudioOutputs.isEmpty()) startCurrentLtcOutput();
     else if (!eng.isOutputLtcEnabled() && eng.getLtcOutput().getIsRunning()) eng.stopLtcOutput();
 
@@ -3735,6 +3973,8 @@ void MainComponent::loadAndApplyNonAudioSettings()
 {
     if (!settings.load())
     {
+        if (settings.artnetUnicast)
+            artnetDiscovery.start();
         settingsLoaded = true;
         syncUIFromEngine();
         return;
@@ -3746,6 +3986,7 @@ void MainComponent::loadAndApplyNonAudioSettings()
         engines.push_back(std::make_unique<TimecodeEngine>((int)engines.size()));
         engines.back()->setSharedProDJLinkInput(&sharedProDJLinkInput);
         engines.back()->setSharedStageLinQInput(&sharedStageLinQInput);
+        engines.back()->setArtnetDiscovery(&artnetDiscovery);
         engines.back()->setDbServerClient(&sharedDbClient);
         engines.back()->setMixerMap(&sharedMixerMap);
         engines.back()->setSlqMixerMap(&sharedSlqMixerMap);
@@ -3776,6 +4017,8 @@ void MainComponent::loadAndApplyNonAudioSettings()
         eng.setOutputTcnetEnabled(es.tcnetOutEnabled);
         eng.setTcnetLayer(es.tcnetLayer);
         eng.setOutputHippoEnabled(es.hippoOutEnabled);
+        eng.setOutputOscTcEnabled(es.oscTcOutEnabled);
+        eng.setOscTcConfig(es.oscTcDestIp, es.oscTcDestPort, es.oscTcRateHz, es.oscTcTimetags);
         eng.setOnAirGateEnabled(es.onAirGateEnabled);
 
         eng.setMtcOutputOffset(es.mtcOutputOffset);
@@ -3841,6 +4084,7 @@ void MainComponent::loadAndApplyNonAudioSettings()
 
         // TrackMap -- wire pointer and restore enabled state
         eng.setTrackMap(&settings.trackMap);
+        eng.setTrackBindings(&settings.trackBindings);
         eng.setTrackMapEnabled(es.trackMapEnabled);
 
         // Track change triggers -- restore enable state and connect destinations
@@ -3868,6 +4112,9 @@ void MainComponent::loadAndApplyNonAudioSettings()
             eng.setArtnetMixerForward(true, es.artnetMixerUniverse);
         eng.setArtnetTriggerUniverse(es.artnetTriggerUniverse);
         eng.setArtnetTriggerEnabled(es.artnetTriggerEnabled);
+        eng.setDmxProtocol((TimecodeEngine::DmxProtocol)es.dmxProtocol);
+        eng.setSacnPriority(es.sacnPriority);
+        eng.setSacnSyncUniverse(es.sacnSyncUniverse);
 
         // Ableton Link (exclusive: only one engine can have it)
         if (es.linkEnabled)
@@ -3914,20 +4161,28 @@ void MainComponent::loadAndApplyNonAudioSettings()
                 && es.triggerMidiDevice == eng.getMtcOutput().getCurrentDeviceName())
             {
                 eng.getTriggerOutput().setSharedMidiOutput(
-                    eng.getMtcOutput().getMidiOutputPtr());
+                    eng.getMtcOutput().getMidiScheduler());
             }
         }
         if (es.artnetOutEnabled)
             eng.startArtnetOutput(es.artnetOutputInterface - 1);  // saved as combo-1; ArtnetOutput needs -1=All, 0=firstNIC
-        else if (es.artnetMixerForward && !eng.getArtnetOutput().getIsRunning())
+        else if (es.artnetMixerForward && eng.dmxUsesArtnet() && !eng.getArtnetOutput().getIsRunning())
             eng.startArtnetOutput(es.artnetDmxInterface);  // DMX mixer needs the socket even without timecode output
-        else if (es.artnetTriggerEnabled && !eng.getArtnetOutput().getIsRunning())
+        else if (es.artnetTriggerEnabled && eng.dmxUsesArtnet() && !eng.getArtnetOutput().getIsRunning())
             eng.startArtnetOutput(es.artnetDmxInterface);  // DMX triggers need the socket even without timecode output
+        if ((es.artnetMixerForward || es.artnetTriggerEnabled) && eng.dmxUsesSacn())
+            eng.startSacnOutput(es.artnetDmxInterface);
+        if (es.oscTcOutEnabled)
+            eng.startOscTimecodeOutput();
         // HippoNet output disabled in this version (pending hardware validation)
         // if (es.hippoOutEnabled)
         //     eng.startHippotizerOutput(es.hippotizerDestIp);
     }
 
+    // ArtPoll discovery for unicast Art-Net DMX
+    if (settings.artnetUnicast)
+        artnetDiscovery.start();
+
     // Start TCNet output if any engine has it enabled
     {
         bool anyTcnet = false;
@@ -4056,6 +4311,7 @@ void MainComponent::flushSettings()
 {
     if (!settingsLoaded) return;
     settingsDirty = false;
+    const double flushStart = juce::Time::getMillisecondCounterHiRes();
 
     settings.selectedEngine = selectedEngine;
     settings.audioInputTypeFilter  = (cmbAudioInputTypeFilter.getSelectedId() <= 1) ? "" : cmbAudioInputTypeFilter.getText();
@@ -4086,6 +4342,11 @@ void MainComponent::flushSettings()
         es.tcnetOutEnabled = eng.isOutputTcnetEnabled();
         es.tcnetLayer = eng.getTcnetLayer();
         es.hippoOutEnabled = eng.isOutputHippoEnabled();
+        es.oscTcOutEnabled = eng.isOutputOscTcEnabled();
+        es.oscTcDestIp     = eng.getOscTcDestIp();
+        es.oscTcDestPort   = eng.getOscTcDestPort();
+        es.oscTcRateHz     = eng.getOscTcRateHz();
+        es.oscTcTimetags   = eng.isOscTcTimetagsEnabled();
         es.onAirGateEnabled = eng.isOnAirGateEnabled();
         es.generatorClockMode = eng.getGeneratorClockMode();
         es.generatorStartMs = eng.getGeneratorStartMs();
@@ -4139,6 +4400,9 @@ void MainComponent::flushSettings()
             es.triggerMidiEnabled = eng.getTriggerOutput().isMidiEnabled();
             es.triggerOscEnabled  = eng.getTriggerOutput().isOscEnabled();
             es.artnetTriggerEnabled = eng.isArtnetTriggerEnabled();
+            es.dmxProtocol      = (int)eng.getDmxProtocol();
+            es.sacnPriority     = eng.getSacnPriority();
+            es.sacnSyncUniverse = eng.getSacnSyncUniverse();
             if (cmbTriggerMidiDevice.getSelectedId() > 0)
                 es.triggerMidiDevice = cmbTriggerMidiDevice.getText();
             else if (eng.getTriggerOutput().isMidiOpen())
@@ -4266,6 +4530,9 @@ void MainComponent::flushSettings()
             es.triggerMidiEnabled = eng.getTriggerOutput().isMidiEnabled();
             es.triggerOscEnabled  = eng.getTriggerOutput().isOscEnabled();
             es.artnetTriggerEnabled = eng.isArtnetTriggerEnabled();
+            es.dmxProtocol      = (int)eng.getDmxProtocol();
+            es.sacnPriority     = eng.getSacnPriority();
+            es.sacnSyncUniverse = eng.getSacnSyncUniverse();
             if (eng.getTriggerOutput().isMidiOpen())
                 es.triggerMidiDevice = eng.getTriggerOutput().getCurrentMidiDeviceName();
         }
@@ -4313,7 +4580,13 @@ void MainComponent::flushSettings()
                                  + " " + juce::String(b.getWidth()) + " " + juce::String(b.getHeight());
     }
 
-    settings.save();
+    settings.save();   // builds the snapshot; SettingsWriter does the I/O
+
+    // Message-thread stall of this save (the number the async write keeps low)
+    lastSettingsFlushMs = juce::Time::getMillisecondCounterHiRes() - flushStart;
+    maxSettingsFlushMs  = juce::jmax(maxSettingsFlushMs, lastSettingsFlushMs);
+    DBG("Settings flush: " << juce::String(lastSettingsFlushMs, 2) << " ms on the message thread (max "
+        << juce::String(maxSettingsFlushMs, 2) << " ms)");
 }
 
 int MainComponent::findDeviceByName(const juce::ComboBox& cmb, const juce::String& name)
@@ -4650,6 +4923,16 @@ void MainComponent::updateDeviceSelectorVisibility()
             && (btnArtnetMixerFwd.getToggleState() || btnArtnetTrigger.getToggleState());
         cmbArtnetDmxInterface.setVisible(showArtDmxIface);
         lblArtnetDmxInterface.setVisible(showArtDmxIface);
+        cmbDmxProtocol.setVisible(showArtDmxIface);
+        lblDmxProtocol.setVisible(showArtDmxIface);
+        bool showSacn = showArtDmxIface && eng.dmxUsesSacn();
+        cmbSacnPriority.setVisible(showSacn);
+        lblSacnPriority.setVisible(showSacn);
+        btnSacnSync.setVisible(showSacn);
+        lblSacnOutStatus.setVisible(showSacn);
+        bool showArtPoll = showArtDmxIface && eng.dmxUsesArtnet();
+        btnArtnetUnicast.setVisible(showArtPoll);
+        lblArtnetNodes.setVisible(showArtPoll && btnArtnetUnicast.getToggleState());
     }
     bool showOscConfig = (showProDJLinkIn || showAudioBpmActive)
         && (btnOscFwdBpm.getToggleState() || btnOscMixerFwd.getToggleState());
@@ -4796,6 +5079,13 @@ void MainComponent::updateDeviceSelectorVisibility()
     sldTcnetOffset.setVisible(showTcnetConfig);     lblTcnetOffset.setVisible(showTcnetConfig);
     if (showTcnetConfig) repopulateTcnetLayerCombo();
 
+    // OSC timecode stream: destination / rate visible when enabled
+    bool showOscTcConfig = eng.isOutputOscTcEnabled();
+    txtOscTcDest.setVisible(showOscTcConfig);     lblOscTcDest.setVisible(showOscTcConfig);
+    cmbOscTcRate.setVisible(showOscTcConfig);     lblOscTcRate.setVisible(showOscTcConfig);
+    btnOscTcTimetags.setVisible(showOscTcConfig);
+    lblOscTcOutStatus.setVisible(showOscTcConfig);
+
     // Hippotizer output: disabled in this version (pending hardware validation)
     btnHippoOut.setVisible(false);
     txtHippoDestIp.setVisible(false);      lblHippoDestIp.setVisible(false);
@@ -4862,6 +5152,34 @@ void MainComponent::updateStatusLabels()
         lblOutputThruStatus.setText(thruStatus, juce::dontSendNotification);
     }
 
+    if (lblArtnetNodes.isVisible())
+    {
+        int n = artnetDiscovery.getNumNodes();
+        juce::String nodesText = !artnetDiscovery.getIsRunning() ? juce::String("ARTPOLL: NOT RUNNING")
+                               : n == 0 ? juce::String("ARTPOLL: NO NODES (BROADCAST)")
+                               : "ARTPOLL: " + juce::String(n) + (n == 1 ? " NODE" : " NODES")
+                                 + (eng.getArtnetOutput().isDmxUnicast() ? " (UNICAST)" : " (BROADCAST)");
+        lblArtnetNodes.setText(nodesText, juce::dontSendNotification);
+    }
+
+    if (lblSacnOutStatus.isVisible())
+    {
+        juce::String sacnStatus = eng.getSacnOutStatusText();
+        auto errs = eng.getSacnOutput().getSendErrors();
+        if (errs > 0)
+            sacnStatus += " [ERRORS: " + juce::String(errs) + "]";
+        lblSacnOutStatus.setText(sacnStatus, juce::dontSendNotification);
+    }
+
+    if (eng.isOutputOscTcEnabled())
+    {
+        juce::String oscTcStatus = eng.getOscTcOutStatusText();
+        auto errs = eng.getOscTimecodeOutput().getSendErrors();
+        if (errs > 0)
+            oscTcStatus += " [ERRORS: " + juce::String(errs) + "]";
+        lblOscTcOutStatus.setText(oscTcStatus, juce::dontSendNotification);
+    }
+
     // Hippotizer output status
     if (eng.isOutputHippoEnabled())
     {
@@ -5280,6 +5598,13 @@ void MainComponent::paintMiniStrip(juce::Graphics& g)
     int centerX = miniStripArea.getCentreX();
     int counterW = juce::jmin(320, miniStripArea.getWidth() - 20);
 
+    // Text comes from the glyph atlas: rows repaint on every frame change
+    // of every other engine, so nothing here creates fonts or shapes text
+    if (miniStripCharW <= 0.0f)
+        miniStripCharW = measureStringWidth(juce::Font(juce::FontOptions(getMonoFontName(), 13.0f, juce::Font::bold)), "0");
+    miniStripAtlas.setScale(g.getInternalContext().getPhysicalPixelScaleFactor());
+    miniStripAtlas.prepareGlyphs(13.0f, miniStripCharW, (float)(kMiniStripRowH - 4));
+
     for (int i = 0; i < (int)engines.size(); i++)
     {
         if (i == selectedEngine) continue;
@@ -5312,26 +5637,27 @@ void MainComponent::paintMiniStrip(juce::Graphics& g)
         innerX += 12;
 
         // Engine name
-        g.setFont(juce::Font(juce::FontOptions(getMonoFontName(), 9.0f, juce::Font::bold)));
         g.setColour(active ? textBright : textMid);
-        g.drawText(eng.getName(), innerX, innerY, 80, innerH, juce::Justification::centredLeft);
+        miniStripAtlas.drawText(g, eng.getName(), 9.0f, true,
+                                { (float)innerX, (float)innerY, 80.0f, (float)innerH },
+                                juce::Justification::centredLeft);
         innerX += 82;
 
         // Timecode (big monospace) -- use '.' before frames to match main display
-        juce::String tcStr = juce::String(tc.hours).paddedLeft('0', 2) + ":"
-                           + juce::String(tc.minutes).paddedLeft('0', 2) + ":"
-                           + juce::String(tc.seconds).paddedLeft('0', 2) + "."
-                           + juce::String(tc.frames).paddedLeft('0', 2);
+        char tcStr[16];
+        std::snprintf(tcStr, sizeof(tcStr), "%02d:%02d:%02d.%02d",
+                      juce::jlimit(0, 99, tc.hours),   juce::jlimit(0, 99, tc.minutes),
+                      juce::jlimit(0, 99, tc.seconds), juce::jlimit(0, 99, tc.frames));
 
-        g.setFont(juce::Font(juce::FontOptions(getMonoFontName(), 13.0f, juce::Font::bold)));
         g.setColour(active ? juce::Colour(0xFF00E676) : textDim);
-        g.drawText(tcStr, innerX, innerY, 120, innerH, juce::Justification::centredLeft);
+        miniStripAtlas.drawGlyphs(g, tcStr, (float)innerX, (float)innerY);
         innerX += 122;
 
         // Source type label
-        g.setFont(juce::Font(juce::FontOptions(getMonoFontName(), 8.0f, juce::Font::plain)));
         g.setColour(active ? srcColour.withAlpha(0.7f) : textDim.withAlpha(0.5f));
-        g.drawText(TimecodeEngine::getInputName(src), innerX, innerY, 50, innerH, juce::Justification::centredLeft);
+        miniStripAtlas.drawText(g, TimecodeEngine::getInputName(src), 8.0f, false,
+                                { (float)innerX, (float)innerY, 50.0f, (float)innerH },
+                                juce::Justification::centredLeft);
 
         rowY += kMiniStripRowH;
     }
@@ -5366,6 +5692,8 @@ void MainComponent::paint(juce::Graphics& g)
 {
     if (engines.empty()) return;  // guard: same as resized()
 
+    frameScheduler->beginPaint(this);   // closed in paintOverChildren (children included)
+
     g.fillAll(bgDark);
     auto bounds = getLocalBounds();
     int panelWidth = juce::jlimit(240, 290, 240 + (getWidth() - 800) / 8);
@@ -5443,6 +5771,11 @@ void MainComponent::paint(juce::Graphics& g)
     paintMiniStrip(g);
 }
 
+void MainComponent::paintOverChildren(juce::Graphics&)
+{
+    frameScheduler->endPaint(this);
+}
+
 //==============================================================================
 // RESIZED
 //==============================================================================
@@ -5930,7 +6263,7 @@ void MainComponent::resized()
     // --- ART-NET DMX section ---
     if (btnArtnetMixerFwd.isVisible() || btnArtnetTrigger.isVisible())
     {
-        leftContent.addSectionSeparator(leftPanel.getY(), "ART-NET DMX");
+        leftContent.addSectionSeparator(leftPanel.getY(), "DMX (ART-NET / sACN)");
         leftPanel.removeFromTop(16);
     }
     if (btnArtnetMixerFwd.isVisible())
@@ -5971,6 +6304,24 @@ void MainComponent::resized()
     }
     if (cmbArtnetDmxInterface.isVisible())
         layCombo(lblArtnetDmxInterface, cmbArtnetDmxInterface, leftPanel);
+    if (cmbDmxProtocol.isVisible())
+        layCombo(lblDmxProtocol, cmbDmxProtocol, leftPanel);
+    if (cmbSacnPriority.isVisible())
+        layCombo(lblSacnPriority, cmbSacnPriority, leftPanel);
+    if (btnSacnSync.isVisible())
+    {
+        btnSacnSync.setBounds(leftPanel.removeFromTop(22));
+        leftPanel.removeFromTop(3);
+    }
+    if (lblSacnOutStatus.isVisible())
+        layStatus(lblSacnOutStatus, leftPanel);
+    if (btnArtnetUnicast.isVisible())
+    {
+        btnArtnetUnicast.setBounds(leftPanel.removeFromTop(22));
+        leftPanel.removeFromTop(3);
+    }
+    if (lblArtnetNodes.isVisible())
+        layStatus(lblArtnetNodes, leftPanel);
 
     // --- Ableton Link (skip when already placed inline in Audio BPM section) ---
     if (!bpmInline && btnLink.isVisible())
@@ -6081,6 +6432,23 @@ void MainComponent::resized()
         rp.removeFromTop(2);
     }
 
+    // OSC TC OUT
+    {
+        rightContent.addSectionSeparator(rp.getY());
+        rp.removeFromTop(4);
+        auto row = rp.removeFromTop(btnH);
+        btnOscTcOut.setBounds(row); rp.removeFromTop(2);
+        if (txtOscTcDest.isVisible())
+        {
+            lblOscTcDest.setBounds(rp.removeFromTop(14)); rp.removeFromTop(2);
+            txtOscTcDest.setBounds(rp.removeFromTop(24)); rp.removeFromTop(3);
+        }
+        if (cmbOscTcRate.isVisible()) layCombo(lblOscTcRate, cmbOscTcRate, rp);
+        if (btnOscTcTimetags.isVisible()) { btnOscTcTimetags.setBounds(rp.removeFromTop(22)); rp.removeFromTop(2); }
+        if (lblOscTcOutStatus.isVisible()) layStatus(lblOscTcOutStatus, rp);
+        rp.removeFromTop(2);
+    }
+
     // AUDIO THRU (primary engine only)
     if (btnThruOut.isVisible())
     {
@@ -6333,17 +6701,86 @@ void MainComponent::timerCallback()
                 sharedTcnetOutput.clearLayer(i);
     }
 
-    // Update UI for selected engine
+    // Debounced settings save
+    if (settingsDirty)
+    {
+        if (--settingsSaveCountdown <= 0)
+            flushSettings();
+    }
+
+    // --- Update checker ---
+    if (updateCheckDelay > 0)
+    {
+        if (--updateCheckDelay == 0)
+        {
+            auto appVer = juce::JUCEApplication::getInstance()->getApplicationVersion();
+            updateChecker.checkAsync(appVer);
+        }
+    }
+    else if (!updateNotificationShown && updateChecker.hasResult())
+    {
+        updateNotificationShown = true;
+        if (updateChecker.isUpdateAvailable())
+        {
+            juce::String label = "Update available: v" + updateChecker.getLatestVersion();
+            btnUpdateAvailable.setButtonText(label);
+            btnUpdateAvailable.setURL(juce::URL(updateChecker.getReleaseUrl()));
+            btnUpdateAvailable.setVisible(true);
+            btnCheckUpdates.setVisible(false);
+            // Position directly in top bar
+            btnUpdateAvailable.setBounds(getWidth() - 245, getHeight() - 24, 240, 24);
+        }
+        else if (updateChecker.didCheckFail())
+        {
+            btnCheckUpdates.setButtonText("Check failed - retry?");
+            btnCheckUpdates.setColour(juce::TextButton::textColourOffId, juce::Colour(0xFFFF8A65));  // orange
+            btnCheckUpdates.setVisible(true);
+            // Reset text after ~4 seconds (240 ticks at 60Hz)
+            updateResetCountdown = 240;
+        }
+        else
+        {
+            btnCheckUpdates.setButtonText("Up to date " + juce::String::charToString(0x2713));
+            btnCheckUpdates.setColour(juce::TextButton::textColourOffId, juce::Colour(0xFF66BB6A));  // green
+            btnCheckUpdates.setVisible(true);
+            // Reset text after ~4 seconds
+            updateResetCountdown = 240;
+        }
+    }
+
+    // Reset "check for updates" button text after countdown
+    if (updateResetCountdown > 0)
+    {
+        if (--updateResetCountdown == 0)
+        {
+            btnCheckUpdates.setButtonText("Check for updates");
+            btnCheckUpdates.setColour(juce::TextButton::textColourOffId, juce::Colour(0xFF546E7A));
+        }
+    }
+}
+
+//==============================================================================
+// UI FRAME -- driven by UiFrameScheduler at a rate that follows visibility,
+// activity and paint cost.  Engine work stays in timerCallback().
+//==============================================================================
+bool MainComponent::uiFrame(double elapsedMs)
+{
+    if (engines.empty()) return false;
+
+    // Update UI for selected engine -- from its end-of-tick snapshot (and
+    // the PDL / SLQ input snapshots below), so a frame is never torn
     auto& eng = currentEngine();
+    const auto& es = eng.getDisplaySnapshot();
 
     updateStatusLabels();
 
-    if (eng.getActiveInput() == SrcType::ProDJLink && sharedProDJLinkInput.isReceiving())
+    if (es.activeInput == SrcType::ProDJLink && sharedProDJLinkInput.isReceiving())
     {
-        int pdlPlayer = eng.getEffectivePlayer();
+        int pdlPlayer = es.effectivePlayer;
+        const auto& pdl = sharedProDJLinkInput.getDisplaySnapshot();
 
         // Guard: in XF mode, resolved player can be 0 (no player on this side)
-        if (pdlPlayer < 1)
+        if (pdlPlayer < 1 || pdlPlayer > ProDJLink::kMaxPlayers)
         {
             lblProDJLinkTrackInfo.setText("", juce::dontSendNotification);
             lblProDJLinkMetadata.setText("", juce::dontSendNotification);
@@ -6366,14 +6803,15 @@ void MainComponent::timerCallback()
         lblProDJLinkTrackInfo.setColour(juce::Label::textColourId,
             pdlTrackStr.isNotEmpty() ? juce::Colour(0xFF00AAFF).brighter(0.5f) : textDim);
 
-        double pdlBpm = sharedProDJLinkInput.getBPM(pdlPlayer);
+        const auto& pl = pdl.players[pdlPlayer - 1];
+        double pdlBpm = pl.bpm;
         juce::String pdlMeta;
         if (pdlBpm > 0.0)
         {
             pdlMeta += juce::String(pdlBpm, 1) + " BPM";
 
             // Show effective (multiplied) BPM if multiplier is active
-            int effMult = eng.getEffectiveBpmMultiplier();
+            int effMult = es.effectiveBpmMultiplier;
             if (effMult != 0)
             {
                 double multBpm = TimecodeEngine::applyBpmMultiplier(pdlBpm, effMult);
@@ -6389,16 +6827,15 @@ void MainComponent::timerCallback()
                          + juce::String(multBpm, 1) + " (" + multLabel + ")";
             }
         }
-        double pdlPitch = sharedProDJLinkInput.getActualSpeed(pdlPlayer);
+        double pdlPitch = pl.actualSpeed;
         if (pdlPitch > 0.01)
         {
             double pitchPct = (pdlPitch - 1.0) * 100.0;
             pdlMeta += "  " + (pitchPct >= 0.0 ? juce::String("+") : juce::String(""))
                             + juce::String(pitchPct, 2) + "%";
         }
-        juce::String pdlModel = sharedProDJLinkInput.getPlayerModel(pdlPlayer);
-        if (pdlModel.isNotEmpty())
-            pdlMeta += "  | " + pdlModel;
+        if (pl.model[0] != 0)
+            pdlMeta += "  | " + juce::String(pl.model);
 
         lblProDJLinkMetadata.setText(pdlMeta, juce::dontSendNotification);
         lblProDJLinkMetadata.setColour(juce::Label::textColourId, juce::Colour(0xFF00AAFF).brighter(0.3f));
@@ -6428,20 +6865,20 @@ void MainComponent::timerCallback()
                 return (bars <= 2) ? kBar2[juce::jlimit(0, 2, filled)]
                                    : kBar3[juce::jlimit(0, 3, filled)];
             };
-            if (sharedProDJLinkInput.hasMixerFaderData())
+            const auto& mx = pdl.mixer;
+            if (mx.hasFaderData)
             {
-                juce::String djmModel = sharedProDJLinkInput.getDJMModel();
+                juce::String djmModel(mx.djmModel);
                 if (djmModel.isEmpty()) djmModel = "DJM";
-                int numCh = sharedProDJLinkInput.getMixerChannelCount();
+                int numCh = mx.getChannelCount();
                 // Cap model name and adjust bar width to fit panel
                 if (djmModel.length() > 7) djmModel = djmModel.substring(0, 7);
                 int bars = (numCh > 4) ? 2 : 3;  // narrower bars for 6-channel DJMs
-                auto& pdl = sharedProDJLinkInput;
                 juce::String mixStr = djmModel;
                 for (int ch = 1; ch <= numCh; ++ch)
-                    mixStr += " " + juce::String(ch) + ":" + faderBar(pdl.getChannelFader(ch), bars);
-                mixStr += " " + kCrossSymbol + ":" + faderBar(pdl.getCrossfader(), bars)
-                        + " M:" + faderBar(pdl.getMasterFader(), bars);
+                    mixStr += " " + juce::String(ch) + ":" + faderBar(mx.fader[ch - 1], bars);
+                mixStr += " " + kCrossSymbol + ":" + faderBar(mx.crossfader, bars)
+                        + " M:" + faderBar(mx.masterFader, bars);
                 lblMixerStatus.setText(mixStr, juce::dontSendNotification);
                 lblMixerStatus.setColour(juce::Label::textColourId,
                     juce::Colour(0xFF00AAFF).withAlpha(0.7f));
@@ -6479,10 +6916,10 @@ void MainComponent::timerCallback()
         // TimecodeEngine::requestDbMetadata).  Looking up with CDJ 2's IP
         // would miss the cache entry and the waveform would never load.
         uint32_t wfTrackId = trackInfo.trackId;
-        uint8_t wfSrcPlayer = sharedProDJLinkInput.getLoadedPlayer(pdlPlayer);
-        if (wfSrcPlayer == 0) wfSrcPlayer = (uint8_t)pdlPlayer;
-        juce::String srcIP = sharedProDJLinkInput.getPlayerIP((int)wfSrcPlayer);
-        if (srcIP.isEmpty()) srcIP = sharedProDJLinkInput.getPlayerIP(pdlPlayer);
+        uint8_t wfSrcPlayer = pl.loadedPlayer;
+        if (wfSrcPlayer == 0 || wfSrcPlayer > ProDJLink::kMaxPlayers) wfSrcPlayer = (uint8_t)pdlPlayer;
+        juce::String srcIP(pdl.players[wfSrcPlayer - 1].ip);
+        if (srcIP.isEmpty()) srcIP = juce::String(pl.ip);
 
         if (wfTrackId != 0 && wfTrackId != displayedWaveformTrackId)
         {
@@ -6505,9 +6942,14 @@ void MainComponent::timerCallback()
                     waveformDisplay.setRekordboxCues(meta.cueList);
                 if (meta.hasBeatGrid())
                     waveformDisplay.setBeatGrid(meta.beatGrid);
-                // Feed beat grid to engine for PLL micro-correction
+                // Feed beat grid (+ phrases) to engine for PLL micro-correction
+                // and the per-track event timeline
                 if (meta.hasBeatGrid())
+                {
                     eng.setBeatGrid(meta.beatGrid, wfTrackId);
+                    if (!meta.songStructure.empty())
+                        eng.setSongStructure(meta.songStructure, wfTrackId);
+                }
             }
         }
         else if (wfTrackId != 0 && !waveformDisplay.hasWaveformData())
@@ -6525,7 +6967,11 @@ void MainComponent::timerCallback()
                 if (meta.hasBeatGrid())
                     waveformDisplay.setBeatGrid(meta.beatGrid);
                 if (meta.hasBeatGrid())
+                {
                     eng.setBeatGrid(meta.beatGrid, wfTrackId);
+                    if (!meta.songStructure.empty())
+                        eng.setSongStructure(meta.songStructure, wfTrackId);
+                }
             }
         }
         else if (wfTrackId == 0 && displayedWaveformTrackId != 0)
@@ -6540,7 +6986,7 @@ void MainComponent::timerCallback()
         // has more variance than Windows.
         if (waveformDisplay.hasWaveformData())
         {
-            float posRatio = eng.getSmoothedPlayPositionRatio();
+            float posRatio = es.playPositionRatio;
             waveformDisplay.setPlayPosition(posRatio);
         }
 
@@ -6548,11 +6994,14 @@ void MainComponent::timerCallback()
         updateBpmMultButtonStates();
         } // end pdlPlayer >= 1
     }
-    else if (eng.getActiveInput() == SrcType::StageLinQ && sharedStageLinQInput.isReceiving())
+    else if (es.activeInput == SrcType::StageLinQ && sharedStageLinQInput.isReceiving())
     {
-        int slqDeck = eng.getEffectivePlayer();
+        int slqDeck = es.effectivePlayer;
+        const auto& slq = sharedStageLinQInput.getDisplaySnapshot();
         if (slqDeck >= 1 && slqDeck <= StageLinQ::kMaxDecks)
         {
+            const auto& dk = slq.decks[slqDeck - 1];
+
             // Track info from StageLinQ StateMap
             auto trackInfo = eng.getActiveTrackInfo();
             juce::String slqTrackStr;
@@ -6565,12 +7014,12 @@ void MainComponent::timerCallback()
             lblProDJLinkTrackInfo.setColour(juce::Label::textColourId,
                 slqTrackStr.isNotEmpty() ? slqAccent.brighter(0.5f) : textDim);
 
-            double slqBpm = sharedStageLinQInput.getBPM(slqDeck);
+            double slqBpm = dk.bpm;
             juce::String slqMeta;
             if (slqBpm > 0.0)
             {
                 slqMeta += juce::String(slqBpm, 1) + " BPM";
-                int effMult = eng.getEffectiveBpmMultiplier();
+                int effMult = es.effectiveBpmMultiplier;
                 if (effMult != 0)
                 {
                     double multBpm = TimecodeEngine::applyBpmMultiplier(slqBpm, effMult);
@@ -6585,16 +7034,15 @@ void MainComponent::timerCallback()
                     slqMeta += "  -> " + juce::String(multBpm, 1) + " (" + multLabel + ")";
                 }
             }
-            double slqSpeed = sharedStageLinQInput.getActualSpeed(slqDeck);
+            double slqSpeed = dk.speed;
             if (slqSpeed > 0.01)
             {
                 double pitchPct = (slqSpeed - 1.0) * 100.0;
                 slqMeta += "  " + (pitchPct >= 0.0 ? juce::String("+") : juce::String(""))
                                 + juce::String(pitchPct, 2) + "%";
             }
-            juce::String slqModel = sharedStageLinQInput.getPlayerModel(slqDeck);
-            if (slqModel.isNotEmpty())
-                slqMeta += "  | " + slqModel;
+            if (dk.model[0] != 0)
+                slqMeta += "  | " + juce::String(dk.model);
 
             lblProDJLinkMetadata.setText(slqMeta, juce::dontSendNotification);
             lblProDJLinkMetadata.setColour(juce::Label::textColourId, slqAccent.brighter(0.3f));
@@ -6606,7 +7054,7 @@ void MainComponent::timerCallback()
             if (sharedStageLinQDb.isDatabaseReady())
             {
                 auto netPath = sharedStageLinQInput.getTrackNetworkPath(slqDeck);
-                uint32_t slqTrackVer = sharedStageLinQInput.getTrackVersion(slqDeck);
+                uint32_t slqTrackVer = dk.trackVersion;
 
                 // Only update displays on track change (avoid 60Hz cache thrashing)
                 if (netPath.isNotEmpty() && slqTrackVer != displayedWaveformTrackId)
@@ -6629,7 +7077,7 @@ void MainComponent::timerCallback()
                             waveformDisplay.clearWaveform();
 
                         // Set track duration so minute markers and cue markers render
-                        uint32_t trackLenMs = sharedStageLinQInput.getTrackLengthSec(slqDeck) * 1000;
+                        uint32_t trackLenMs = dk.getTrackLengthSec() * 1000;
                         if (trackLenMs == 0 && dbMeta.length > 0.0)
                             trackLenMs = (uint32_t)(dbMeta.length * 1000.0);
                         if (trackLenMs > 0)
@@ -6664,12 +7112,8 @@ void MainComponent::timerCallback()
                             auto cueTrackInfo = eng.getActiveTrackInfo();
                             if (cueTrackInfo.title.isNotEmpty())
                             {
-                                int dur = (int)sharedStageLinQInput.getTrackLengthSec(slqDeck);
-                                auto* tmEntry = settings.trackMap.find(cueTrackInfo.artist, cueTrackInfo.title, dur);
-                                if (!tmEntry && dur > 0)
-                                    tmEntry = settings.trackMap.find(cueTrackInfo.artist, cueTrackInfo.title, 0);
-                                if (!tmEntry)
-                                    tmEntry = settings.trackMap.findIgnoringDuration(cueTrackInfo.artist, cueTrackInfo.title);
+                                int dur = (int)dk.getTrackLengthSec();
+                                auto* tmEntry = settings.trackMap.findBestMatch(cueTrackInfo.artist, cueTrackInfo.title, dur);
                                 if (tmEntry != nullptr && tmEntry->cuePoints.empty())
                                 {
                                     for (int ci = 0; ci < (int)perf.quickCues.size(); ++ci)
@@ -6709,7 +7153,7 @@ void MainComponent::timerCallback()
             // Update waveform cursor position every frame
             if (waveformDisplay.hasWaveformData())
             {
-                float posRatio = eng.getSmoothedPlayPositionRatio();
+                float posRatio = es.playPositionRatio;
                 waveformDisplay.setPlayPosition(posRatio);
             }
 
@@ -6731,8 +7175,8 @@ void MainComponent::timerCallback()
 
                 juce::String mixStr = "MIX";
                 for (int ch = 1; ch <= 4; ++ch)
-                    mixStr += " " + juce::String(ch) + ":" + faderBar3(sharedStageLinQInput.getFaderPosition(ch));
-                mixStr += " " + kCrossSymbol + ":" + faderBar3(sharedStageLinQInput.getCrossfaderPosition());
+                    mixStr += " " + juce::String(ch) + ":" + faderBar3(slq.decks[ch - 1].faderPos);
+                mixStr += " " + kCrossSymbol + ":" + faderBar3(slq.crossfader);
 
                 lblMixerStatus.setText(mixStr, juce::dontSendNotification);
                 lblMixerStatus.setColour(juce::Label::textColourId, slqAccent.withAlpha(0.7f));
@@ -6748,7 +7192,7 @@ void MainComponent::timerCallback()
             lblMixerStatus.setText("", juce::dontSendNotification);
         }
     }
-    else if (eng.getActiveInput() != SrcType::ProDJLink && eng.getActiveInput() != SrcType::StageLinQ)
+    else if (es.activeInput != SrcType::ProDJLink && es.activeInput != SrcType::StageLinQ)
     {
         lblProDJLinkTrackInfo.setText("", juce::dontSendNotification);
         lblProDJLinkMetadata.setText("", juce::dontSendNotification);
@@ -6812,28 +7256,28 @@ void MainComponent::timerCallback()
         }
     }
 
-    timecodeDisplay.setTimecode(eng.getCurrentTimecode());
-    timecodeDisplay.setFrameRate(eng.getCurrentFps());
-    timecodeDisplay.setRunning(eng.isSourceActive());
-    timecodeDisplay.setSourceName(TimecodeEngine::getInputName(eng.getActiveInput()));
-    timecodeDisplay.setFpsConvertEnabled(eng.isFpsConvertEnabled());
-    timecodeDisplay.setOutputTimecode(eng.getOutputTimecode());
-    timecodeDisplay.setOutputFrameRate(eng.getEffectiveOutputFps());
+    timecodeDisplay.setTimecode(es.currentTimecode);
+    timecodeDisplay.setFrameRate(es.currentFps);
+    timecodeDisplay.setRunning(es.sourceActive);
+    timecodeDisplay.setSourceName(TimecodeEngine::getInputName(es.activeInput));
+    timecodeDisplay.setFpsConvertEnabled(es.fpsConvertEnabled);
+    timecodeDisplay.setOutputTimecode(es.outputTimecode);
+    timecodeDisplay.setOutputFrameRate(es.outputFps);
 
     // Update VU meters for selected engine
-    if (eng.isAudioBpmRunning() && eng.getActiveInput() != SrcType::LTC)
-        mtrLtcInput.setLevel(eng.getAudioBpmPeakLevel());
+    if (es.audioBpmRunning && es.activeInput != SrcType::LTC)
+        mtrLtcInput.setLevel(es.audioBpmPeakLevel);
     else
-        mtrLtcInput.setLevel(eng.getSmoothedLtcInLevel());
+        mtrLtcInput.setLevel(es.ltcInLevel);
     // Separate Audio BPM meter (visible when LTC owns shared meter)
     if (mtrAudioBpm.isVisible())
-        mtrAudioBpm.setLevel(eng.getAudioBpmPeakLevel());
+        mtrAudioBpm.setLevel(es.audioBpmPeakLevel);
 
     // Audio BPM value display + beat LED
     if (lblBpmValue.isVisible())
     {
-        double bpm = eng.getAudioBpm();
-        double conf = eng.getAudioBpmConfidence();
+        double bpm = es.audioBpm;
+        double conf = es.audioBpmConfidence;
         if (bpm > 0.0 && conf > 0.15)
         {
             lblBpmValue.setText(juce::String(bpm, 1) + " BPM", juce::dontSendNotification);
@@ -6855,11 +7299,13 @@ void MainComponent::timerCallback()
     }
     if (ledBeat.isVisible())
     {
-        double bpm = eng.getAudioBpm();
-        if (bpm > 20.0 && eng.isAudioBpmRunning())
+        // 0.15 per 60Hz frame, scaled to the actual frame interval
+        const float ledDecay = 0.15f * (float)(elapsedMs * 60.0 / 1000.0);
+        double bpm = es.audioBpm;
+        if (bpm > 20.0 && es.audioBpmRunning)
         {
             double intervalMs = 60000.0 / bpm;
-            beatFlashAccumMs += 1000.0 / 60.0;  // ~16.67ms per tick at 60Hz timer
+            beatFlashAccumMs += elapsedMs;
             if (beatFlashAccumMs >= intervalMs)
             {
                 beatFlashAccumMs -= intervalMs;
@@ -6870,25 +7316,28 @@ void MainComponent::timerCallback()
             }
             else
             {
-                ledBeat.decay(0.15f);
+                ledBeat.decay(ledDecay);
             }
         }
         else
         {
             beatFlashAccumMs = 0.0;
-            ledBeat.decay(0.15f);
+            ledBeat.decay(ledDecay);
         }
     }
 
-    mtrThruInput.setLevel(eng.getSmoothedThruInLevel());
-    mtrLtcOutput.setLevel(eng.getSmoothedLtcOutLevel());
-    mtrThruOutput.setLevel(eng.getSmoothedThruOutLevel());
+    mtrThruInput.setLevel(es.thruInLevel);
+    mtrLtcOutput.setLevel(es.ltcOutLevel);
+    mtrThruOutput.setLevel(es.thruOutLevel);
+    const bool metersLive = mtrLtcInput.getLevel() > 0.001f || mtrAudioBpm.getLevel() > 0.001f
+                         || mtrThruInput.getLevel() > 0.001f || mtrLtcOutput.getLevel() > 0.001f
+                         || mtrThruOutput.getLevel() > 0.001f;
 
     // Auto-update FPS button states when the frame rate changes
     // (e.g. from protocol auto-detection in MTC/ArtNet/LTC inputs)
     {
-        FrameRate curFps = eng.getCurrentFps();
-        FrameRate curOutFps = eng.getEffectiveOutputFps();
+        FrameRate curFps = es.currentFps;
+        FrameRate curOutFps = es.outputFps;
         if (curFps != lastDisplayedFps)
         {
             lastDisplayedFps = curFps;
@@ -6903,83 +7352,29 @@ void MainComponent::timerCallback()
 
     // Repaint mini strip so non-selected engine timecodes update live.
     // Skip if no non-selected engine is running (nothing to animate).
+    bool anyOtherActive = false;
     if (engines.size() > 1 && !miniStripArea.isEmpty())
     {
-        bool anyOtherActive = false;
         for (int i = 0; i < (int)engines.size(); ++i)
         {
-            if (i != selectedEngine && engines[(size_t)i]->isSourceActive())
+            if (i != selectedEngine && engines[(size_t)i]->getDisplaySnapshot().sourceActive)
                 { anyOtherActive = true; break; }
         }
         if (anyOtherActive)
             repaint(miniStripArea);
     }
 
-    // Debounced settings save
-    if (settingsDirty)
-    {
-        if (--settingsSaveCountdown <= 0)
-            flushSettings();
-    }
-
-    // --- Update checker ---
-    if (updateCheckDelay > 0)
-    {
-        if (--updateCheckDelay == 0)
-        {
-            auto appVer = juce::JUCEApplication::getInstance()->getApplicationVersion();
-            updateChecker.checkAsync(appVer);
-        }
-    }
-    else if (!updateNotificationShown && updateChecker.hasResult())
-    {
-        updateNotificationShown = true;
-        if (updateChecker.isUpdateAvailable())
-        {
-            juce::String label = "Update available: v" + updateChecker.getLatestVersion();
-            btnUpdateAvailable.setButtonText(label);
-            btnUpdateAvailable.setURL(juce::URL(updateChecker.getReleaseUrl()));
-            btnUpdateAvailable.setVisible(true);
-            btnCheckUpdates.setVisible(false);
-            // Position directly in top bar
-            btnUpdateAvailable.setBounds(getWidth() - 245, getHeight() - 24, 240, 24);
-        }
-        else if (updateChecker.didCheckFail())
-        {
-            btnCheckUpdates.setButtonText("Check failed - retry?");
-            btnCheckUpdates.setColour(juce::TextButton::textColourOffId, juce::Colour(0xFFFF8A65));  // orange
-            btnCheckUpdates.setVisible(true);
-            // Reset text after ~4 seconds (240 ticks at 60Hz)
-            updateResetCountdown = 240;
-        }
-        else
-        {
-            btnCheckUpdates.setButtonText("Up to date " + juce::String::charToString(0x2713));
-            btnCheckUpdates.setColour(juce::TextButton::textColourOffId, juce::Colour(0xFF66BB6A));  // green
-            btnCheckUpdates.setVisible(true);
-            // Reset text after ~4 seconds
-            updateResetCountdown = 240;
-        }
-    }
-
-    // Reset "check for updates" button text after countdown
-    if (updateResetCountdown > 0)
-    {
-        if (--updateResetCountdown == 0)
-        {
-            btnCheckUpdates.setButtonText("Check for updates");
-            btnCheckUpdates.setColour(juce::TextButton::textColourOffId, juce::Colour(0xFF546E7A));
-        }
-    }
-
     // Bottom bar repaint when state changes
-    juce::String currentBottomStatus = TimecodeEngine::getInputName(eng.getActiveInput());
-    if (currentBottomStatus != lastBottomBarStatus || eng.isSourceActive() != lastBottomBarActive)
+    juce::String currentBottomStatus = TimecodeEngine::getInputName(es.activeInput);
+    if (currentBottomStatus != lastBottomBarStatus || es.sourceActive != lastBottomBarActive)
     {
         lastBottomBarStatus = currentBottomStatus;
-        lastBottomBarActive = eng.isSourceActive();
+        lastBottomBarActive = es.sourceActive;
         repaint(0, getHeight() - 24, getWidth(), 24);
     }
+
+    // Live while any source runs or a meter / LED still has to settle
+    return es.sourceActive || anyOtherActive || metersLive || ledBeat.isLit();
 }
 
 //==============================================================================
@@ -7019,12 +7414,8 @@ void MainComponent::updateBpmMultButtonStates()
     int map = 0;
     if (trackInfo.title.isNotEmpty())
     {
-        auto* entry = settings.trackMap.find(trackInfo.artist, trackInfo.title,
-                                              trackInfo.durationSec);
-        if (!entry && trackInfo.durationSec > 0)
-            entry = settings.trackMap.find(trackInfo.artist, trackInfo.title, 0);
-        if (!entry)
-            entry = settings.trackMap.findIgnoringDuration(trackInfo.artist, trackInfo.title);
+        auto* entry = std::as_const(settings.trackMap).findBestMatchFuzzy(
+            TrackKey::make(trackInfo.artist, trackInfo.title, trackInfo.durationSec));
         if (entry != nullptr) map = entry->bpmMultiplier;
     }
 
@@ -7070,11 +7461,7 @@ void MainComponent::saveBpmMultToTrackMap(int clickedMult)
     auto info = eng.getActiveTrackInfo();
     if (info.title.isEmpty()) return;
 
-    auto* entry = settings.trackMap.find(info.artist, info.title, info.durationSec);
-    if (!entry && info.durationSec > 0)
-        entry = settings.trackMap.find(info.artist, info.title, 0);
-    if (!entry)
-        entry = settings.trackMap.findIgnoringDuration(info.artist, info.title);
+    auto* entry = settings.trackMap.findBestMatch(info.artist, info.title, info.durationSec);
     int currentMapValue = (entry != nullptr) ? entry->bpmMultiplier : 0;
 
     // Double-click on 1x: clear saved value. Otherwise: save (no toggle).
@@ -7089,6 +7476,7 @@ void MainComponent::saveBpmMultToTrackMap(int clickedMult)
     if (entry != nullptr)
     {
         entry->bpmMultiplier = newValue;
+        settings.trackMap.markChanged(*entry);
     }
     else if (newValue != 0)
     {
@@ -21,6 +21,9 @@
 #include "StageLinQView.h"
 #include "StageLinQDbClient.h"
 #include "TCNetOutput.h"
+#include "UiFrameScheduler.h"
+#include "TimecodeGlyphAtlas.h"
+#include "GpuCompositor.h"
 #include <vector>
 #include <memory>
 
@@ -63,6 +66,8 @@ public:
         }
     }
 
+    bool isLit() const { return brightness > 0.0f; }
+
     void setLedColour(juce::Colour c) { onColour = c; repaint(); }
 
     void paint(juce::Graphics& g) override
@@ -136,13 +141,15 @@ private:
 
 //==============================================================================
 class MainComponent : public juce::Component,
-                      public juce::Timer
+                      public juce::Timer,
+                      private UiFrameScheduler::Client
 {
 public:
     MainComponent();
     ~MainComponent() override;
 
     void paint(juce::Graphics&) override;
+    void paintOverChildren(juce::Graphics&) override;
     void resized() override;
     void timerCallback() override;
     bool keyPressed(const juce::KeyPress& key) override;
@@ -205,6 +212,7 @@ private:
     //==============================================================================
     // ENGINE MANAGEMENT
     //==============================================================================
+    ArtnetDiscovery artnetDiscovery;      // shared ArtPoll node table (declared before engines: outlives them)
     std::vector<std::unique_ptr<TimecodeEngine>> engines;
     int selectedEngine = 0;
     ProDJLinkInput sharedProDJLinkInput;  // shared across all engines
@@ -251,6 +259,8 @@ private:
     int getMiniStripHeight() const;
     juce::Rectangle<int> miniStripArea;  // cached from resized()
     void paintMiniStrip(juce::Graphics& g);
+    TimecodeGlyphAtlas miniStripAtlas;    // mini-strip counters, one raster for all rows
+    float miniStripCharW = 0.0f;          // 13pt bold mono digit width, measured once
     void mouseDown(const juce::MouseEvent& e) override;
 
     //==============================================================================
@@ -262,6 +272,13 @@ private:
     void syncUIFromEngine();      // Load engine state into UI controls
     void syncEngineFromUI();      // Save UI state into engine settings
 
+    //==============================================================================
+    // UI FRAMES (selected-engine display; engines tick in timerCallback)
+    //==============================================================================
+    juce::SharedResourcePointer<UiFrameScheduler> frameScheduler;
+    bool uiFrame(double elapsedMs) override;
+    juce::Component& getFrameComponent() override { return *this; }
+
     //==============================================================================
     // UI COMPONENTS (single set, bound to selected engine)
     //==============================================================================
@@ -413,6 +430,7 @@ private:
     LevelMeter         mtrAudioBpm;
 
     juce::Component::SafePointer<juce::DocumentWindow> trackMapWindow;
+    TrackMapIndex trackMapIndex;   // editor sort/filter index, kept across editor sessions
     juce::Component::SafePointer<juce::DocumentWindow> genPresetWindow;
     std::unique_ptr<CuePointEditorWindow> cuePointWindow;
     std::string cuePointTrackKey;  // key of the entry being edited (for dangling ref safety)
@@ -428,6 +446,13 @@ private:
     juce::ComboBox cmbTcnetLayer; juce::Label lblTcnetLayer;
     GainSlider sldTcnetOffset;        juce::Label lblTcnetOffset;
 
+    // OSC timecode stream output
+    juce::ToggleButton btnOscTcOut { "OSC TC OUT" };
+    juce::TextEditor   txtOscTcDest;      juce::Label lblOscTcDest;
+    juce::ComboBox     cmbOscTcRate;      juce::Label lblOscTcRate;
+    juce::ToggleButton btnOscTcTimetags { "NTP TIMETAGS" };
+    juce::Label        lblOscTcOutStatus;
+
     // Hippotizer output
     juce::ToggleButton btnHippoOut { "HIPPONET OUT" };
     juce::TextEditor   txtHippoDestIp;    juce::Label lblHippoDestIp;
@@ -475,6 +500,7 @@ private:
     }
     std::unique_ptr<juce::FileChooser> configFileChooser;
     juce::ScopedMessageBox importConfirmBox;
+    std::unique_ptr<ShowPackageJob> showPackageJob;   // export / restore in progress
     std::unique_ptr<ProDJLinkViewWindow> proDJLinkViewWindow;
     std::unique_ptr<StageLinQViewWindow> stageLinQViewWindow;
 
@@ -488,6 +514,12 @@ private:
     juce::ComboBox cmbArtTrigNet, cmbArtTrigSub, cmbArtTrigUni;
     juce::Label    lblArtTrigAddr;
     juce::ComboBox cmbArtnetDmxInterface;     juce::Label lblArtnetDmxInterface;
+    juce::ComboBox cmbDmxProtocol;            juce::Label lblDmxProtocol;
+    juce::ComboBox cmbSacnPriority;           juce::Label lblSacnPriority;
+    juce::ToggleButton btnSacnSync { "sACN Universe Sync" };
+    juce::ToggleButton btnArtnetUnicast { "Art-Net Unicast (ArtPoll)" };
+    juce::Label    lblArtnetNodes;
+    juce::Label    lblSacnOutStatus;
     juce::ComboBox cmbAudioInputDevice;      juce::Label lblAudioInputDevice;
     juce::ComboBox cmbAudioInputChannel;     juce::Label lblAudioInputChannel;
     GainSlider sldLtcInputGain;              juce::Label lblLtcInputGain;
@@ -544,6 +576,8 @@ private:
     bool settingsDirty = false;
     int settingsSaveCountdown = 0;
     static constexpr int kSaveDelayTicks = 30;
+    double lastSettingsFlushMs = 0.0;     // message-thread time of the last flushSettings()
+    double maxSettingsFlushMs  = 0.0;
 
     // --- Methods ---
     void startAudioDeviceScan();
@@ -588,11 +622,15 @@ private:
     void openStageLinQView();
     void exportConfig();
     void importConfig();
+    void startShowPackageRestore(const juce::File& package);
+    void finishConfigImport(bool ok);
     void applyTriggerSettings();
     void propagateGlobalSettings();
     void startCurrentThruOutput();
     void startCurrentMtcOutput();
     void startCurrentArtnetOutput();
+    void startCurrentOscTcOutput();
+    void startCurrentDmxOutputs();
     void startCurrentLtcOutput();
     void updateCurrentOutputStates();
 
@@ -660,10 +698,9 @@ private:
     int  getArtNetAddressFromCombos(const juce::ComboBox& cmbNet, const juce::ComboBox& cmbSub,
                                      const juce::ComboBox& cmbUni);
 
-    // OpenGL context removed: see constructor comment for rationale.
-    // Keeping the juce_opengl module in Projucer is harmless and allows
-    // re-enabling GPU rendering in the future if the thread safety issues
-    // are addressed.
+    // Optional OpenGL compositing (settings.gpuCompositing): see constructor
+    // comment.  Null when disabled; falls back to software on its own.
+    std::unique_ptr<GpuCompositor> gpuCompositor;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MainComponent)
 };
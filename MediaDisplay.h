@@ -7,12 +7,17 @@
 // WaveformDisplay: Renders CDJ waveform preview in two formats:
 //   - CDJ-3000 3-band (PWV6): 1200 entries x 3 bytes = {mid, high, low} heights
 //   - NXS2 Color (PWV4): 1200 entries x 6 bytes = {d0, d1, d2, d3(R), d4(G), d5(B)}
+// Bars are sampled from a WaveformPyramid built off the message thread.
 //
-// ArtworkDisplay: Renders a decoded JPEG album art image.
+// ArtworkDisplay: Renders a decoded JPEG album art image (pre-scaled off the
+// message thread via ScaledImageCache).
 
 #pragma once
 #include <JuceHeader.h>
 #include "DbServerClient.h"
+#include "WaveformPyramid.h"
+#include "RenderWorker.h"
+#include <memory>
 #include <algorithm>
 #include <cmath>
 #include <vector>
@@ -36,18 +41,45 @@ public:
     /// bytesPerEntry: 3 = CDJ-3000 3-band (mid,high,low), 6 = NXS2 color (d0-d5)
     void setColorWaveformData(const std::vector<uint8_t>& data, int entryCount, int bytesPerEntry)
     {
-        colorWaveformData = data;
         colorEntryCount = entryCount;
         colorBytesPerEntry = bytesPerEntry;
         hasColorData = (entryCount > 0 && (int)data.size() >= entryCount * bytesPerEntry);
+
+        pyramid = nullptr;
+        cachedWaveformImg = {};   // previous track's image
+        const uint32_t gen = ++pyramidGeneration;
+        if (hasColorData)
+        {
+            juce::Component::SafePointer<WaveformDisplay> safe(this);
+            WaveformPyramidBuilder::buildAsync(*renderWorker, data, entryCount, bytesPerEntry,
+                [safe, gen](std::shared_ptr<const WaveformPyramid> p)
+                {
+                    if (safe == nullptr || safe->pyramidGeneration != gen) return;
+                    safe->pyramid = std::move(p);
+                    safe->pendingRepaint = true;
+                    safe->invalidateCache();
+                    safe->repaint();
+                });
+        }
         invalidateCache();
         repaint();
     }
 
+    /// True once after the pyramid for new data arrived.  For orphan use
+    /// (PDL View): our repaint() doesn't reach the parent, so it polls this.
+    bool takePendingRepaint()
+    {
+        const bool r = pendingRepaint;
+        pendingRepaint = false;
+        return r;
+    }
+
     /// Clear all waveform data (e.g. on track change before new data arrives)
     void clearWaveform()
     {
-        colorWaveformData.clear();
+        pyramid = nullptr;
+        cachedWaveformImg = {};
+        ++pyramidGeneration;
         hasColorData = false;
         colorEntryCount = 0;
         colorBytesPerEntry = 0;
@@ -127,7 +159,7 @@ public:
     {
         auto bounds = getLocalBounds().toFloat();
 
-        if (hasColorData && !colorWaveformData.empty() && colorEntryCount > 0)
+        if (hasColorData && pyramid != nullptr && colorEntryCount > 0)
         {
             ensureCachedImage();
             if (cachedWaveformImg.isValid())
@@ -144,6 +176,7 @@ public:
         // No waveform -- plain background + placeholder text
         g.setColour(juce::Colour(0xFF0D1117));
         g.fillRoundedRectangle(bounds, 3.0f);
+        if (hasColorData) return;   // pyramid / image still rendering (a few ms)
         g.setColour(juce::Colour(0xFF4A5568));
         g.setFont(10.0f);
         g.drawText("No Waveform", bounds, juce::Justification::centred);
@@ -152,15 +185,23 @@ public:
 private:
     //----------------------------------------------------------------------
     // Cached waveform image -- rendered at physical pixel resolution to
-    // avoid HiDPI upscaling blur.  Regenerated only when data, size, or
-    // display scale changes.
+    // avoid HiDPI upscaling blur.  Regenerated on the RenderWorker only when
+    // data, size, or display scale changes.
     //----------------------------------------------------------------------
     juce::Image cachedWaveformImg;
     int cachedW = 0, cachedH = 0;
     float cachedScale = 0.0f;
     bool cacheValid = false;
+    uint32_t cacheGeneration = 1;          // bumped by invalidateCache(); stale renders are dropped
+    uint32_t requestedGeneration = 0;      // last render queued on the RenderWorker
+    int requestedW = 0, requestedH = 0;
+    float requestedScale = 0.0f;
 
-    void invalidateCache() { cacheValid = false; }
+    void invalidateCache()
+    {
+        cacheValid = false;
+        ++cacheGeneration;
+    }
 
     /// Detect the display scale factor for this component (or its parent).
     float getDisplayScale() const
@@ -178,243 +219,260 @@ private:
         return 1.0f;
     }
 
-    void ensureCachedImage()
+    //----------------------------------------------------------------------
+    // Image source -- immutable snapshot of what the cached image shows, so
+    // it can be rasterised on the RenderWorker.
+    //----------------------------------------------------------------------
+    struct ImageSource
     {
-        int w = getWidth();
-        int h = getHeight();
-        if (w <= 0 || h <= 0) return;
-
-        float scale = getDisplayScale();
-        if (scale < 1.0f) scale = 1.0f;
-
-        // Regenerate if size, scale, or data changed
-        if (cacheValid && cachedW == w && cachedH == h && cachedScale == scale)
-            return;
-
-        // Create image at physical pixel resolution
-        int imgW = (int)std::ceil(w * scale);
-        int imgH = (int)std::ceil(h * scale);
-        cachedWaveformImg = juce::Image(juce::Image::ARGB, imgW, imgH, true);
-        juce::Graphics ig(cachedWaveformImg);
-
-        // Scale the Graphics context so all drawing uses logical coordinates
-        // but renders at physical pixel density
-        ig.addTransform(juce::AffineTransform::scale(scale));
-
-        // Background
-        auto bounds = juce::Rectangle<float>(0.0f, 0.0f, (float)w, (float)h);
-        ig.setColour(juce::Colour(0xFF0D1117));
-        ig.fillRoundedRectangle(bounds, 3.0f);
-
-        if (colorBytesPerEntry == 3)
-            renderThreeBandBars(ig, bounds);
-        else
-            renderColorBars(ig, bounds);
-
-        // Center line (static, part of cached image)
-        float inset = 2.0f;
-        float drawW = bounds.getWidth() - inset * 2;
-        float drawH = bounds.getHeight() - inset * 2;
-        float midY = inset + drawH * 0.5f;
-        ig.setColour(juce::Colour(0x40FFFFFF));
-        ig.drawHorizontalLine((int)midY, inset, bounds.getWidth() - inset);
-
-        // Minute markers (white ticks below waveform)
-        if (durationMs > 0)
+        std::shared_ptr<const WaveformPyramid> pyramid;
+        int entryCount = 0;
+        int bytesPerEntry = 0;
+        uint32_t durationMs = 0;
+        std::vector<TrackMetadata::RekordboxCue> cues;
+        std::vector<TrackMetadata::BeatEntry> beatGrid;
+        int width = 0, height = 0;   // logical px
+        float scale = 1.0f;
+
+        juce::Image render() const
         {
-            uint32_t minuteMs = 60000;
-            float botY = inset + drawH;
-            for (uint32_t ms = minuteMs; ms < durationMs; ms += minuteMs)
+            const int w = width, h = height;
+
+            // Create image at physical pixel resolution
+            int imgW = (int)std::ceil(w * scale);
+            int imgH = (int)std::ceil(h * scale);
+            auto image = RenderWorker::createImage(imgW, imgH);
+            juce::Graphics ig(image);
+
+            // Scale the Graphics context so all drawing uses logical coordinates
+            // but renders at physical pixel density
+            ig.addTransform(juce::AffineTransform::scale(scale));
+
+            // Background
+            auto bounds = juce::Rectangle<float>(0.0f, 0.0f, (float)w, (float)h);
+            ig.setColour(juce::Colour(0xFF0D1117));
+            ig.fillRoundedRectangle(bounds, 3.0f);
+
+            if (bytesPerEntry == 3)
+                renderThreeBandBars(ig, bounds);
+            else
+                renderColorBars(ig, bounds);
+
+            // Center line (static, part of cached image)
+            float inset = 2.0f;
+            float drawW = bounds.getWidth() - inset * 2;
+            float drawH = bounds.getHeight() - inset * 2;
+            float midY = inset + drawH * 0.5f;
+            ig.setColour(juce::Colour(0x40FFFFFF));
+            ig.drawHorizontalLine((int)midY, inset, bounds.getWidth() - inset);
+
+            // Minute markers (white ticks below waveform)
+            if (durationMs > 0)
             {
-                float ratio = (float)ms / (float)durationMs;
-                float xp = inset + ratio * drawW;
-                ig.setColour(juce::Colour(0x80FFFFFF));
-                ig.fillRect(xp, botY - 4.0f, 1.0f, 4.0f);
+                uint32_t minuteMs = 60000;
+                float botY = inset + drawH;
+                for (uint32_t ms = minuteMs; ms < durationMs; ms += minuteMs)
+                {
+                    float ratio = (float)ms / (float)durationMs;
+                    float xp = inset + ratio * drawW;
+                    ig.setColour(juce::Colour(0x80FFFFFF));
+                    ig.fillRect(xp, botY - 4.0f, 1.0f, 4.0f);
+                }
             }
-        }
 
-        // Beat grid (downbeats only -- every 4 beats as subtle full-height lines)
-        if (!previewBeatGrid.empty() && durationMs > 0)
-        {
-            for (auto& beat : previewBeatGrid)
+            // Beat grid (downbeats only -- every 4 beats as subtle full-height lines)
+            if (!beatGrid.empty() && durationMs > 0)
             {
-                if (beat.beatNumber == 0) continue;
-                bool isDownbeat = ((beat.beatNumber - 1) % 4) == 0;
-                if (!isDownbeat) continue;  // only downbeats on preview
-
-                float ratio = (float)beat.timeMs / (float)durationMs;
-                float xp = inset + ratio * drawW;
-                ig.setColour(juce::Colour(0x12FFFFFF));
-                ig.fillRect(xp, inset, 1.0f, drawH);
+                for (auto& beat : beatGrid)
+                {
+                    if (beat.beatNumber == 0) continue;
+                    bool isDownbeat = ((beat.beatNumber - 1) % 4) == 0;
+                    if (!isDownbeat) continue;  // only downbeats on preview
+
+                    float ratio = (float)beat.timeMs / (float)durationMs;
+                    float xp = inset + ratio * drawW;
+                    ig.setColour(juce::Colour(0x12FFFFFF));
+                    ig.fillRect(xp, inset, 1.0f, drawH);
+                }
             }
-        }
 
-        // Rekordbox cue markers (colored triangles above waveform)
-        if (!previewCues.empty() && durationMs > 0)
-        {
-            for (auto& cue : previewCues)
+            // Rekordbox cue markers (colored triangles above waveform)
+            if (!cues.empty() && durationMs > 0)
             {
-                if (cue.positionMs == 0 && cue.type == TrackMetadata::RekordboxCue::MemoryPoint)
-                    continue;  // skip memory point at position 0 (track start)
-                float ratio = (float)cue.positionMs / (float)durationMs;
-                float xp = inset + ratio * drawW;
-
-                juce::Colour col = cue.hasColor ? cue.getColour()
-                    : (cue.type == TrackMetadata::RekordboxCue::HotCue
-                        ? juce::Colour(0xFF1ECC3C)
-                        : cue.type == TrackMetadata::RekordboxCue::MemoryPoint
-                            ? juce::Colour(0xFFCC2020)
-                            : juce::Colour(0xFFFF8800));
-
-                juce::Path tri;
-                tri.addTriangle(xp - 3.0f, inset, xp + 3.0f, inset, xp, inset + 4.0f);
-                ig.setColour(col);
-                ig.fillPath(tri);
-
-                // Loop end marker
-                if (cue.loopEndMs > 0 && cue.loopEndMs < durationMs)
+                for (auto& cue : cues)
                 {
-                    float endRatio = (float)cue.loopEndMs / (float)durationMs;
-                    float xEnd = inset + endRatio * drawW;
-                    ig.setColour(col.withAlpha(0.15f));
-                    ig.fillRect(xp, inset, xEnd - xp, drawH);
+                    if (cue.positionMs == 0 && cue.type == TrackMetadata::RekordboxCue::MemoryPoint)
+                        continue;  // skip memory point at position 0 (track start)
+                    float ratio = (float)cue.positionMs / (float)durationMs;
+                    float xp = inset + ratio * drawW;
+
+                    juce::Colour col = cue.hasColor ? cue.getColour()
+                        : (cue.type == TrackMetadata::RekordboxCue::HotCue
+                            ? juce::Colour(0xFF1ECC3C)
+                            : cue.type == TrackMetadata::RekordboxCue::MemoryPoint
+                                ? juce::Colour(0xFFCC2020)
+                                : juce::Colour(0xFFFF8800));
+
+                    juce::Path tri;
+                    tri.addTriangle(xp - 3.0f, inset, xp + 3.0f, inset, xp, inset + 4.0f);
+                    ig.setColour(col);
+                    ig.fillPath(tri);
+
+                    // Loop end marker
+                    if (cue.loopEndMs > 0 && cue.loopEndMs < durationMs)
+                    {
+                        float endRatio = (float)cue.loopEndMs / (float)durationMs;
+                        float xEnd = inset + endRatio * drawW;
+                        ig.setColour(col.withAlpha(0.15f));
+                        ig.fillRect(xp, inset, xEnd - xp, drawH);
+                    }
                 }
             }
-        }
 
-        cachedW = w;
-        cachedH = h;
-        cachedScale = scale;
-        cacheValid = true;
-    }
-
-    /// Render CDJ-3000 3-band waveform bars into a Graphics context (cached).
-    void renderThreeBandBars(juce::Graphics& g, juce::Rectangle<float> bounds)
-    {
-        float w = bounds.getWidth();
-        float inset = 2.0f;
-        float drawW = w - inset * 2;
-        float drawH = bounds.getHeight() - inset * 2;
-        float midY = inset + drawH * 0.5f;
-        float halfH = drawH * 0.5f;
-        float entriesPerPx = (float)colorEntryCount / drawW;
-        float barW = std::max(1.0f, drawW / (float)colorEntryCount);
-        const uint8_t* data = colorWaveformData.data();
-        int totalBytes = (int)colorWaveformData.size();
-
-        // Find global peak amplitude for height normalization
-        uint8_t globalPeak = 1;
-        for (int i = 0; i < colorEntryCount; ++i)
-        {
-            int off = i * 3;
-            if (off + 2 >= totalBytes) break;
-            globalPeak = std::max({ globalPeak, data[off], data[off + 1], data[off + 2] });
+            return image;
         }
-        float hScale = halfH / (float)globalPeak;
 
-        for (int px = 0; px < (int)drawW; ++px)
+        /// Render CDJ-3000 3-band waveform bars into a Graphics context (cached).
+        void renderThreeBandBars(juce::Graphics& g, juce::Rectangle<float> bounds) const
         {
-            int eStart = juce::jlimit(0, colorEntryCount - 1, (int)(px * entriesPerPx));
-            int eEnd   = juce::jlimit(0, colorEntryCount - 1, (int)((px + 1) * entriesPerPx));
-            if (eEnd < eStart) eEnd = eStart;
-
-            float sumMid = 0, sumHigh = 0, sumLow = 0;
-            int count = 0;
-            for (int e = eStart; e <= eEnd; ++e)
+            float w = bounds.getWidth();
+            float inset = 2.0f;
+            float drawW = w - inset * 2;
+            float drawH = bounds.getHeight() - inset * 2;
+            float midY = inset + drawH * 0.5f;
+            float halfH = drawH * 0.5f;
+            float entriesPerPx = (float)entryCount / drawW;
+            float barW = std::max(1.0f, drawW / (float)entryCount);
+
+            // Global peak amplitude for height normalization
+            uint8_t globalPeak = juce::jmax((uint8_t)1, pyramid->getPeakOfFirst(3));
+            float hScale = halfH / (float)globalPeak;
+
+            WaveformPyramid::Column col;
+            for (int px = 0; px < (int)drawW; ++px)
             {
-                int off = e * 3;
-                if (off + 2 >= totalBytes) break;
-                sumMid  += data[off];
-                sumHigh += data[off + 1];
-                sumLow  += data[off + 2];
-                count++;
+                int eStart = juce::jlimit(0, entryCount - 1, (int)(px * entriesPerPx));
+                int eEnd   = juce::jlimit(0, entryCount - 1, (int)((px + 1) * entriesPerPx));
+                if (eEnd < eStart) eEnd = eStart;
+                if (!pyramid->sample(eStart, eEnd + 1, col)) continue;
+
+                float avgMid  = col.avg[0];
+                float avgHigh = col.avg[1];
+                float avgLow  = col.avg[2];
+
+                float amplitude = avgMid;
+                if (amplitude < 1.0f) continue;
+
+                float barH = amplitude * hScale;
+                float x = inset + (float)px;
+
+                float total = avgLow + avgMid + avgHigh + 0.001f;
+                float highRatio = avgHigh / total;
+                float blueR = 0.0f  + highRatio * 1.0f;
+                float blueG = 0.45f + highRatio * 0.55f;
+                float blueB = 1.0f;
+
+                g.setColour(juce::Colour::fromFloatRGBA(blueR, blueG, blueB, 1.0f));
+                g.fillRect(x, midY - barH, barW, barH);
+                g.fillRect(x, midY, barW, barH);
             }
-            if (count == 0) continue;
-
-            float avgMid  = sumMid  / (float)count;
-            float avgHigh = sumHigh / (float)count;
-            float avgLow  = sumLow  / (float)count;
-
-            float amplitude = avgMid;
-            if (amplitude < 1.0f) continue;
-
-            float barH = amplitude * hScale;
-            float x = inset + (float)px;
-
-            float total = avgLow + avgMid + avgHigh + 0.001f;
-            float highRatio = avgHigh / total;
-            float blueR = 0.0f  + highRatio * 1.0f;
-            float blueG = 0.45f + highRatio * 0.55f;
-            float blueB = 1.0f;
-
-            g.setColour(juce::Colour::fromFloatRGBA(blueR, blueG, blueB, 1.0f));
-            g.fillRect(x, midY - barH, barW, barH);
-            g.fillRect(x, midY, barW, barH);
-        }
-    }
-
-    /// Render CDJ NXS2+ color waveform bars into a Graphics context (cached).
-    void renderColorBars(juce::Graphics& g, juce::Rectangle<float> bounds)
-    {
-        float w = bounds.getWidth();
-        float inset = 2.0f;
-        float drawW = w - inset * 2;
-        float drawH = bounds.getHeight() - inset * 2;
-        float midY = inset + drawH * 0.5f;
-        float halfH = drawH * 0.5f;
-        float entriesPerPx = (float)colorEntryCount / drawW;
-        float barW = std::max(1.0f, drawW / (float)colorEntryCount);
-        const uint8_t* data = colorWaveformData.data();
-        int totalBytes = (int)colorWaveformData.size();
-
-        uint8_t globalPeak = 1;
-        for (int i = 0; i < colorEntryCount; ++i)
-        {
-            int off = i * 6;
-            if (off + 5 >= totalBytes) break;
-            globalPeak = std::max(globalPeak, data[off + 5]);
         }
-        float hScale = halfH / (float)globalPeak;
 
-        for (int px = 0; px < (int)drawW; ++px)
+        /// Render CDJ NXS2+ color waveform bars into a Graphics context (cached).
+        void renderColorBars(juce::Graphics& g, juce::Rectangle<float> bounds) const
         {
-            int eStart = juce::jlimit(0, colorEntryCount - 1, (int)(px * entriesPerPx));
-            int eEnd   = juce::jlimit(0, colorEntryCount - 1, (int)((px + 1) * entriesPerPx));
-            if (eEnd < eStart) eEnd = eStart;
-
-            float sumD3 = 0, sumD4 = 0, sumD5 = 0;
-            int count = 0;
-            for (int e = eStart; e <= eEnd; ++e)
+            float w = bounds.getWidth();
+            float inset = 2.0f;
+            float drawW = w - inset * 2;
+            float drawH = bounds.getHeight() - inset * 2;
+            float midY = inset + drawH * 0.5f;
+            float halfH = drawH * 0.5f;
+            float entriesPerPx = (float)entryCount / drawW;
+            float barW = std::max(1.0f, drawW / (float)entryCount);
+
+            uint8_t globalPeak = juce::jmax((uint8_t)1, pyramid->getPeak(5));
+            float hScale = halfH / (float)globalPeak;
+
+            WaveformPyramid::Column col;
+            for (int px = 0; px < (int)drawW; ++px)
             {
-                int off = e * 6;
-                if (off + 5 >= totalBytes) break;
-                sumD3 += data[off + 3];
-                sumD4 += data[off + 4];
-                sumD5 += data[off + 5];
-                count++;
+                int eStart = juce::jlimit(0, entryCount - 1, (int)(px * entriesPerPx));
+                int eEnd   = juce::jlimit(0, entryCount - 1, (int)((px + 1) * entriesPerPx));
+                if (eEnd < eStart) eEnd = eStart;
+                if (!pyramid->sample(eStart, eEnd + 1, col)) continue;
+
+                float avgD3 = col.avg[3];
+                float avgD4 = col.avg[4];
+                float avgD5 = col.avg[5];
+
+                float amplitude = avgD5;
+                if (amplitude < 1.0f) continue;
+
+                float barH = amplitude * hScale;
+                float x = inset + (float)px;
+
+                float total = avgD3 + avgD4 + avgD5 + 0.001f;
+                float highRatio = avgD3 / total;
+                float blueR = 0.0f  + highRatio * 1.0f;
+                float blueG = 0.45f + highRatio * 0.55f;
+                float blueB = 1.0f;
+
+                g.setColour(juce::Colour::fromFloatRGBA(blueR, blueG, blueB, 1.0f));
+                g.fillRect(x, midY - barH, barW, barH);
+                g.fillRect(x, midY, barW, barH);
             }
-            if (count == 0) continue;
-
-            float avgD3 = sumD3 / (float)count;
-            float avgD4 = sumD4 / (float)count;
-            float avgD5 = sumD5 / (float)count;
-
-            float amplitude = avgD5;
-            if (amplitude < 1.0f) continue;
+        }
+    };
 
-            float barH = amplitude * hScale;
-            float x = inset + (float)px;
+    /// Queue a re-render when size, scale, or data changed.  The previous
+    /// image keeps being drawn (stretched if the size changed) until the
+    /// new one arrives.
+    void ensureCachedImage()
+    {
+        int w = getWidth();
+        int h = getHeight();
+        if (w <= 0 || h <= 0) return;
 
-            float total = avgD3 + avgD4 + avgD5 + 0.001f;
-            float highRatio = avgD3 / total;
-            float blueR = 0.0f  + highRatio * 1.0f;
-            float blueG = 0.45f + highRatio * 0.55f;
-            float blueB = 1.0f;
+        float scale = getDisplayScale();
+        if (scale < 1.0f) scale = 1.0f;
 
-            g.setColour(juce::Colour::fromFloatRGBA(blueR, blueG, blueB, 1.0f));
-            g.fillRect(x, midY - barH, barW, barH);
-            g.fillRect(x, midY, barW, barH);
-        }
+        if (cacheValid && cachedW == w && cachedH == h && cachedScale == scale)
+            return;
+        if (requestedGeneration == cacheGeneration
+            && requestedW == w && requestedH == h && requestedScale == scale)
+            return;   // already queued
+
+        requestedGeneration = cacheGeneration;
+        requestedW = w;
+        requestedH = h;
+        requestedScale = scale;
+
+        auto src = std::make_shared<ImageSource>();
+        src->pyramid = pyramid;
+        src->entryCount = colorEntryCount;
+        src->bytesPerEntry = colorBytesPerEntry;
+        src->durationMs = durationMs;
+        src->cues = previewCues;
+        src->beatGrid = previewBeatGrid;
+        src->width = w;
+        src->height = h;
+        src->scale = scale;
+
+        const uint32_t gen = cacheGeneration;
+        juce::Component::SafePointer<WaveformDisplay> safe(this);
+        renderWorker->post<juce::Image>(
+            [src] { return src->render(); },
+            [safe, src, gen](juce::Image img)
+            {
+                if (safe == nullptr || safe->cacheGeneration != gen) return;
+                safe->cachedWaveformImg = std::move(img);
+                safe->cachedW = src->width;
+                safe->cachedH = src->height;
+                safe->cachedScale = src->scale;
+                safe->cacheValid = true;
+                safe->pendingRepaint = true;
+                safe->repaint();
+            });
     }
 
     /// Paint cursor and labels (lightweight -- called every frame over cached image)
@@ -443,7 +501,10 @@ private:
         g.drawText(label, bounds.reduced(4.0f, 1.0f), juce::Justification::topRight);
     }
 
-    std::vector<uint8_t> colorWaveformData;
+    std::shared_ptr<const WaveformPyramid> pyramid;   // null until built
+    uint32_t pyramidGeneration = 0;                   // drops results for replaced data
+    bool pendingRepaint = false;
+    juce::SharedResourcePointer<RenderWorker> renderWorker;
     int colorEntryCount = 0;
     int colorBytesPerEntry = 0;  // 3=ThreeBand(CDJ-3000), 6=ColorNxs2
     bool hasColorData = false;
@@ -466,6 +527,7 @@ public:
     ArtworkDisplay()
     {
         setOpaque(false);
+        scaledArtwork.onReady = [this] { repaint(); };
     }
 
     /// Set the artwork image (call from message thread).
@@ -479,6 +541,7 @@ public:
     void clearImage()
     {
         artwork = {};
+        scaledArtwork.clear();
         repaint();
     }
 
@@ -516,12 +579,18 @@ public:
         float dx = drawBounds.getX() + (drawBounds.getWidth() - dw) * 0.5f;
         float dy = drawBounds.getY() + (drawBounds.getHeight() - dh) * 0.5f;
 
-        g.drawImage(artwork, (int)dx, (int)dy, (int)dw, (int)dh,
-                     0, 0, artwork.getWidth(), artwork.getHeight());
+        // Pre-scaled variant at the physical size, rescaled on the
+        // RenderWorker; the source is drawn scaled until it's ready
+        const float px = g.getInternalContext().getPhysicalPixelScaleFactor();
+        auto img = scaledArtwork.get(artwork, juce::roundToInt((float)(int)dw * px),
+                                     juce::roundToInt((float)(int)dh * px));
+        g.drawImage(img, (int)dx, (int)dy, (int)dw, (int)dh,
+                     0, 0, img.getWidth(), img.getHeight());
     }
 
 private:
     juce::Image artwork;
+    ScaledImageCache scaledArtwork;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ArtworkDisplay)
 };
@@ -0,0 +1,329 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+//==============================================================================
+// MidiOutputScheduler -- Single arbitration point for one MIDI output port.
+//
+// MTC quarter frames (MtcOutput timer thread), MIDI Clock (MidiClockTimer
+// thread), trigger notes/CC and mixer-forwarded CC (message thread) all end
+// up on the same port.  Without arbitration a burst of CC on a 31.25 kbaud
+// DIN link (3125 bytes/s, ~320us per byte) delays quarter frames and clock
+// ticks by whole milliseconds.
+//
+// Policy:
+//   - Clock and Timecode messages are strict priority: always transmitted
+//     immediately on the calling thread.
+//   - Note and Control messages go out immediately only when nothing is
+//     queued and the estimated wire backlog is below kLowPriorityBacklogMs.
+//     Otherwise they wait in a per-class FIFO drained by a small worker
+//     thread once the wire frees up (Note before Control).
+//   - Control messages are coalesced: a queued message with the same status
+//     and first data byte (CC number, or note for fader-style notes) is
+//     updated in place -- the receiver only needs the latest value.
+//   - Running status: Note Off is rewritten as Note On velocity 0 so that
+//     the driver / interface can keep the running status byte, and the
+//     wire model omits repeated status bytes when estimating bandwidth.
+//
+// Per-class queuing delay (submit -> start of transmission on the wire,
+// including the estimated wire backlog) is exposed via getStats().
+//
+// The physical port is abstracted behind Port so the scheduler can be
+// exercised against VirtualMidiPort, which simulates a bandwidth-limited
+// wire and records when each message would have completed.
+//==============================================================================
+class MidiOutputScheduler : private juce::Thread
+{
+public:
+    enum class MessageClass { Clock = 0, Timecode, Note, Control };
+    static constexpr int kNumClasses = 4;
+
+    static constexpr double kDinBytesPerSecond    = 3125.0;   // 31250 baud, 10 bits/byte
+    static constexpr double kLowPriorityBacklogMs = 1.0;      // max wire backlog before CC/notes queue
+    static constexpr size_t kMaxQueuedPerClass    = 512;
+
+    //--------------------------------------------------------------------------
+    /// Physical (or simulated) output port.  send() is only ever called with
+    /// the scheduler lock held, so implementations need no extra locking.
+    struct Port
+    {
+        virtual ~Port() = default;
+        virtual void send(const juce::MidiMessage& msg) = 0;
+    };
+
+    /// Port backed by an open juce::MidiOutput device (owned).
+    class DevicePort : public Port
+    {
+    public:
+        explicit DevicePort(std::unique_ptr<juce::MidiOutput> out) : device(std::move(out)) {}
+        void send(const juce::MidiMessage& msg) override { if (device) device->sendMessageNow(msg); }
+    private:
+        std::unique_ptr<juce::MidiOutput> device;
+    };
+
+    struct ClassStats
+    {
+        uint64_t sent      = 0;    // messages transmitted
+        uint64_t queued    = 0;    // messages that had to wait in the FIFO
+        uint64_t coalesced = 0;    // Control messages merged into a queued one
+        uint64_t dropped   = 0;    // rejected because the FIFO was full
+        double   avgDelayMs = 0.0;
+        double   maxDelayMs = 0.0;
+        double   lastDelayMs = 0.0;
+    };
+
+    //--------------------------------------------------------------------------
+    explicit MidiOutputScheduler(std::unique_ptr<Port> p)
+        : juce::Thread("MIDI Out Scheduler"), port(std::move(p))
+    {
+        startThread(juce::Thread::Priority::high);
+    }
+
+    ~MidiOutputScheduler() override
+    {
+        signalThreadShouldExit();
+        wakeEvent.signal();
+        stopThread(1000);
+    }
+
+    /// Open a MIDI output device and wrap it in a scheduler.
+    /// Returns nullptr if the device could not be opened.
+    static std::unique_ptr<MidiOutputScheduler> openDevice(const juce::String& identifier)
+    {
+        auto out = juce::MidiOutput::openDevice(identifier);
+        if (out == nullptr)
+            return nullptr;
+        return std::make_unique<MidiOutputScheduler>(std::make_unique<DevicePort>(std::move(out)));
+    }
+
+    //--------------------------------------------------------------------------
+    /// Wire bandwidth used for pacing.  Default is DIN MIDI (3125 bytes/s).
+    /// Pass 0 to disable pacing (USB-only / virtual ports): priority ordering
+    /// still applies but nothing waits for the wire.
+    void setWireBytesPerSecond(double bytesPerSecond)
+    {
+        const juce::ScopedLock sl(lock);
+        usPerByte = bytesPerSecond > 0.0 ? 1.0e6 / bytesPerSecond : 0.0;
+    }
+
+    //--------------------------------------------------------------------------
+    /// Submit a message.  Thread-safe; may be called from any thread except
+    /// the audio callback.
+    void send(const juce::MidiMessage& msg, MessageClass cls)
+    {
+        const int ci = (int)cls;
+        const double now = juce::Time::getMillisecondCounterHiRes();
+        bool wake = false;
+        {
+            const juce::ScopedLock sl(lock);
+
+            if (cls == MessageClass::Clock || cls == MessageClass::Timecode)
+            {
+                transmit(msg, ci, now, now);
+                return;
+            }
+
+            auto& q = queues[(size_t)ci];
+            if (queuesEmpty() && backlogMs(now) <= kLowPriorityBacklogMs)
+            {
+                transmit(msg, ci, now, now);
+                return;
+            }
+
+            if (cls == MessageClass::Control && msg.getRawDataSize() >= 2)
+            {
+                const auto* raw = msg.getRawData();
+                for (auto& pending : q)
+                {
+                    const auto* p = pending.msg.getRawData();
+                    if (pending.msg.getRawDataSize() >= 2 && p[0] == raw[0] && p[1] == raw[1])
+                    {
+                        pending.msg = msg;   // keep original submit time (delay is from first request)
+                        stats[(size_t)ci].coalesced++;
+                        return;
+                    }
+                }
+            }
+
+            if (q.size() >= kMaxQueuedPerClass)
+            {
+                stats[(size_t)ci].dropped++;
+                return;
+            }
+
+            q.push_back({ msg, now });
+            stats[(size_t)ci].queued++;
+            wake = true;
+        }
+        if (wake)
+            wakeEvent.signal();
+    }
+
+    //--------------------------------------------------------------------------
+    ClassStats getStats(MessageClass cls) const
+    {
+        const juce::ScopedLock sl(lock);
+        return stats[(size_t)cls];
+    }
+
+    void resetStats()
+    {
+        const juce::ScopedLock sl(lock);
+        for (auto& s : stats) s = {};
+    }
+
+    /// Estimated time until the wire is idle (ms).  0 when pacing is disabled.
+    double getWireBacklogMs() const
+    {
+        const juce::ScopedLock sl(lock);
+        return backlogMs(juce::Time::getMillisecondCounterHiRes());
+    }
+
+    //--------------------------------------------------------------------------
+    /// Bytes this message occupies on a DIN wire given the current running
+    /// status.  Updates runningStatus.  Real-time messages (0xF8-0xFF) don't
+    /// affect it; system common / SysEx (0xF0-0xF7) cancel it.
+    static int wireBytesWithRunningStatus(const juce::MidiMessage& msg, uint8_t& runningStatus)
+    {
+        const int n = msg.getRawDataSize();
+        if (n <= 0) return 0;
+        const uint8_t status = msg.getRawData()[0];
+        if (status >= 0xF8) return n;
+        if (status >= 0xF0) { runningStatus = 0; return n; }
+        if (status == runningStatus) return n - 1;
+        runningStatus = status;
+        return n;
+    }
+
+private:
+    struct Pending
+    {
+        juce::MidiMessage msg;
+        double submitMs;
+    };
+
+    //--------------------------------------------------------------------------
+    // Lock must be held.
+    double backlogMs(double now) const
+    {
+        return juce::jmax(0.0, wireFreeAtMs - now);
+    }
+
+    bool queuesEmpty() const
+    {
+        return queues[(size_t)MessageClass::Note].empty()
+            && queues[(size_t)MessageClass::Control].empty();
+    }
+
+    void transmit(const juce::MidiMessage& original, int ci, double submitMs, double now)
+    {
+        juce::MidiMessage msg = original;
+        const auto* raw = msg.getRawData();
+        // Note Off (vel 0) -> Note On vel 0 when that keeps running status
+        if (msg.getRawDataSize() == 3 && (raw[0] & 0xF0) == 0x80 && raw[2] == 0
+            && runningStatus == (uint8_t)(0x90 | (raw[0] & 0x0F)))
+            msg = juce::MidiMessage(runningStatus, raw[1], 0);
+
+        const double delay = (now - submitMs) + backlogMs(now);
+        const int bytes = wireBytesWithRunningStatus(msg, runningStatus);
+        wireFreeAtMs = juce::jmax(wireFreeAtMs, now) + bytes * usPerByte * 0.001;
+
+        port->send(msg);
+
+        auto& s = stats[(size_t)ci];
+        s.sent++;
+        s.lastDelayMs = delay;
+        s.maxDelayMs  = juce::jmax(s.maxDelayMs, delay);
+        s.avgDelayMs += (delay - s.avgDelayMs) / (double)s.sent;
+    }
+
+    //--------------------------------------------------------------------------
+    // Drain thread: sleeps until work is queued, then releases low-priority
+    // messages as the wire backlog drops below the threshold.
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            int waitMs = -1;
+            {
+                const juce::ScopedLock sl(lock);
+                const double now = juce::Time::getMillisecondCounterHiRes();
+                for (int ci : { (int)MessageClass::Note, (int)MessageClass::Control })
+                {
+                    auto& q = queues[(size_t)ci];
+                    while (!q.empty() && backlogMs(now) <= kLowPriorityBacklogMs)
+                    {
+                        transmit(q.front().msg, ci, q.front().submitMs, now);
+                        q.pop_front();
+                    }
+                }
+                if (!queuesEmpty())
+                    waitMs = juce::jmax(1, (int)std::ceil(backlogMs(now) - kLowPriorityBacklogMs));
+            }
+            wakeEvent.wait(waitMs);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    std::unique_ptr<Port> port;
+    juce::CriticalSection lock;
+    juce::WaitableEvent wakeEvent;   // auto-reset
+
+    std::array<std::deque<Pending>, kNumClasses> queues;   // only Note/Control are used
+    std::array<ClassStats, kNumClasses> stats;
+
+    double  usPerByte    = 1.0e6 / kDinBytesPerSecond;
+    double  wireFreeAtMs = 0.0;
+    uint8_t runningStatus = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MidiOutputScheduler)
+};
+
+//==============================================================================
+// VirtualMidiPort -- In-memory Port that simulates a bandwidth-limited wire.
+//
+// Each message is stamped with the time it would finish transmitting on a
+// wire of the given rate (running status applied), so scheduler behaviour
+// can be checked without hardware: e.g. flood Control messages while a
+// clock timer runs and verify the clock messages' completion jitter.
+//==============================================================================
+class VirtualMidiPort : public MidiOutputScheduler::Port
+{
+public:
+    struct Record
+    {
+        juce::MidiMessage msg;
+        double sentMs;      // when send() was called
+        double doneMs;      // when the last byte would leave the wire
+    };
+
+    explicit VirtualMidiPort(double bytesPerSecond = MidiOutputScheduler::kDinBytesPerSecond)
+        : msPerByte(bytesPerSecond > 0.0 ? 1000.0 / bytesPerSecond : 0.0) {}
+
+    void send(const juce::MidiMessage& msg) override
+    {
+        const double now = juce::Time::getMillisecondCounterHiRes();
+        const int bytes = MidiOutputScheduler::wireBytesWithRunningStatus(msg, runningStatus);
+        wireFreeAtMs = juce::jmax(wireFreeAtMs, now) + bytes * msPerByte;
+        totalWireBytes += (uint64_t)bytes;
+        records.push_back({ msg, now, wireFreeAtMs });
+    }
+
+    // Read only once the scheduler has been destroyed or is idle.
+    const std::vector<Record>& getRecords() const { return records; }
+    uint64_t getTotalWireBytes() const { return totalWireBytes; }
+
+private:
+    double msPerByte;
+    double wireFreeAtMs = 0.0;
+    uint8_t runningStatus = 0;
+    uint64_t totalWireBytes = 0;
+    std::vector<Record> records;
+};
@@ -5,6 +5,7 @@
 #pragma once
 #include <JuceHeader.h>
 #include "TimecodeCore.h"
+#include "MidiOutputScheduler.h"
 #include <atomic>
 
 class MtcOutput : public juce::HighResolutionTimer
@@ -48,7 +49,7 @@ public:
         if (deviceIndex < 0 || deviceIndex >= availableDevices.size())
             return false;
 
-        midiOutput = juce::MidiOutput::openDevice(availableDevices[deviceIndex].identifier);
+        midiOutput = MidiOutputScheduler::openDevice(availableDevices[deviceIndex].identifier);
 
         if (midiOutput != nullptr)
         {
@@ -83,10 +84,10 @@ public:
 
     bool getIsRunning() const { return isRunningFlag.load(std::memory_order_relaxed); }
 
-    /// Raw pointer to the open MidiOutput device (for sharing with TriggerOutput).
-    /// Returns nullptr if not running.  Thread-safe: juce::MidiOutput::sendMessageNow()
-    /// uses an internal CriticalSection.
-    juce::MidiOutput* getMidiOutputPtr() const { return midiOutput.get(); }
+    /// Scheduler for the open MIDI port (for sharing with TriggerOutput so
+    /// clock, triggers and CC are arbitrated against our quarter frames).
+    /// Returns nullptr if not running.  MidiOutputScheduler::send() is thread-safe.
+    MidiOutputScheduler* getMidiScheduler() const { return midiOutput.get(); }
 
     //==============================================================================
     // Called from UI thread - thread-safe via SpinLock
@@ -186,7 +187,7 @@ public:
             0xF7
         };
 
-        midiOutput->sendMessageNow(juce::MidiMessage(sysex, sizeof(sysex)));
+        midiOutput->send(juce::MidiMessage(sysex, sizeof(sysex)), MidiOutputScheduler::MessageClass::Timecode);
     }
 
 private:
@@ -304,7 +305,7 @@ private:
         }
 
         uint8_t dataByte = (uint8_t)((index << 4) | (value & 0x0F));
-        midiOutput->sendMessageNow(juce::MidiMessage(0xF1, (int)dataByte));
+        midiOutput->send(juce::MidiMessage(0xF1, (int)dataByte), MidiOutputScheduler::MessageClass::Timecode);
     }
 
     void updateTimerRate()
@@ -316,7 +317,7 @@ private:
     }
 
     //==============================================================================
-    std::unique_ptr<juce::MidiOutput> midiOutput;
+    std::unique_ptr<MidiOutputScheduler> midiOutput;
     juce::Array<juce::MidiDeviceInfo> availableDevices;
     int currentDeviceIndex = -1;
     std::atomic<bool> isRunningFlag { false };
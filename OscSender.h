@@ -198,11 +198,17 @@ public:
         packet[off + 2] = (uint8_t)((asInt >> 8)  & 0xFF);
         packet[off + 3] = (uint8_t)(asInt & 0xFF);
 
-        int totalSize = (int)(addrPadded + 8);
+        return sendPacketDirect(packet, (int)(addrPadded + 8));
+    }
 
+    /// Send a pre-encoded OSC packet (message or bundle) as-is.
+    /// For callers that build packets in their own stack buffers on hot
+    /// paths (OscTimecodeOutput, sendFloatDirect).
+    bool sendPacketDirect(const void* packet, int size)
+    {
         juce::SpinLock::ScopedLockType lock(socketLock);
         if (!connected || !socket) return false;
-        return socket->write(destIp, destPort, packet, totalSize) > 0;
+        return socket->write(destIp, destPort, packet, size) > 0;
     }
 
     /// Convenience: send with a single string argument
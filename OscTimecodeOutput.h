@@ -0,0 +1,249 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+
+#pragma once
+#include <JuceHeader.h>
+#include "TimecodeCore.h"
+#include "OscSender.h"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+//==============================================================================
+// OscTimecodeOutput -- Streams the engine's timecode as compact OSC messages.
+//
+// For media servers and custom software that would otherwise need an MTC or
+// Art-Net timecode decoder.  One message per tick, built in a stack buffer
+// and sent through OscSender::sendPacketDirect (no allocation per packet):
+//
+//   <address>  ,iiiififi  hours minutes seconds frames fps playing speed positionMs
+//
+//   fps        float  (29.97 for drop-frame etc.)
+//   playing    int    1 = source active, 0 = paused/stopped
+//   speed      float  playback speed (1.0 = nominal, 0 when paused)
+//   positionMs int    ms position; extrapolated from the last engine update
+//                     with speed, so it advances smoothly at rates above the
+//                     60Hz engine tick
+//
+// With timetags enabled each message is wrapped in an OSC bundle carrying an
+// NTP-format timetag of the send time (wall clock, sub-ms resolution).
+//
+// Runs on its own HighResolutionTimer at 1ms, like the other outputs, with a
+// fractional accumulator for the configured rate (1-1000 Hz).  Unlike the
+// MTC/Art-Net outputs it keeps streaming while the source is stopped
+// (playing = 0) so receivers always see the current transport state.
+//==============================================================================
+class OscTimecodeOutput : public juce::HighResolutionTimer
+{
+public:
+    static constexpr int kMinRateHz     = 1;
+    static constexpr int kMaxRateHz     = 1000;
+    static constexpr int kDefaultRateHz = 100;
+    static constexpr int kDefaultPort   = 9900;
+
+    OscTimecodeOutput() = default;
+    ~OscTimecodeOutput() override { stop(); }
+
+    //==============================================================================
+    bool start(const juce::String& ip, int port)
+    {
+        stop();
+        if (!sender.connect(ip, port))
+            return false;
+
+        destination = ip + ":" + juce::String(port);
+        wallMsAtStart = (double)juce::Time::currentTimeMillis();
+        hiResAtStart  = juce::Time::getMillisecondCounterHiRes();
+        isRunningFlag.store(true, std::memory_order_relaxed);
+        sendErrors.store(0, std::memory_order_relaxed);
+        lastSendTime = hiResAtStart;
+        startTimer(1);
+        return true;
+    }
+
+    void stop()
+    {
+        stopTimer();
+        isRunningFlag.store(false, std::memory_order_relaxed);
+        sender.disconnect();
+    }
+
+    bool getIsRunning() const { return isRunningFlag.load(std::memory_order_relaxed); }
+    juce::String getDestination() const { return destination; }
+    uint32_t getSendErrors() const { return sendErrors.load(std::memory_order_relaxed); }
+
+    //==============================================================================
+    void setRateHz(int hz)
+    {
+        rateHz.store(juce::jlimit(kMinRateHz, kMaxRateHz, hz), std::memory_order_relaxed);
+    }
+    int getRateHz() const { return rateHz.load(std::memory_order_relaxed); }
+
+    void setTimetagsEnabled(bool enabled) { timetags.store(enabled, std::memory_order_relaxed); }
+    bool isTimetagsEnabled() const { return timetags.load(std::memory_order_relaxed); }
+
+    /// OSC address of the stream (e.g. "/stc/1/tc").  Message thread only;
+    /// encoded once here so the timer thread only copies bytes.
+    void setAddress(const juce::String& address)
+    {
+        auto utf8 = address.toRawUTF8();
+        size_t len = std::strlen(utf8);
+        if (len == 0 || len >= kMaxAddressLen || utf8[0] != '/')
+            return;
+
+        const juce::SpinLock::ScopedLockType lock(stateLock);
+        std::memset(addressBytes, 0, sizeof(addressBytes));
+        std::memcpy(addressBytes, utf8, len);
+        addressPadded = (len + 1 + 3) & ~(size_t)3;
+    }
+
+    //==============================================================================
+    /// Called from the engine tick (message thread) with the routed timecode.
+    void setState(const Timecode& tc, FrameRate fps, bool playing, double speed, double positionMs)
+    {
+        const juce::SpinLock::ScopedLockType lock(stateLock);
+        state.tc         = tc;
+        state.fps        = fps;
+        state.playing    = playing;
+        state.speed      = playing ? speed : 0.0;
+        state.positionMs = positionMs;
+        state.stampMs    = juce::Time::getMillisecondCounterHiRes();
+    }
+
+    /// Send one message immediately (seek, clean stop) -- receivers don't
+    /// have to wait for the next rate tick to see the new position.
+    void forceResync()
+    {
+        if (isRunningFlag.load(std::memory_order_relaxed))
+            sendState(juce::Time::getMillisecondCounterHiRes());
+    }
+
+private:
+    static constexpr size_t kMaxAddressLen = 64;
+
+    struct State
+    {
+        Timecode  tc;
+        FrameRate fps        = FrameRate::FPS_25;
+        bool      playing    = false;
+        double    speed      = 0.0;
+        double    positionMs = 0.0;
+        double    stampMs    = 0.0;   // hi-res time of the update
+    };
+
+    //==============================================================================
+    void hiResTimerCallback() override
+    {
+        if (!isRunningFlag.load(std::memory_order_relaxed))
+        {
+            stopTimer();
+            return;
+        }
+
+        const double interval = 1000.0 / (double)rateHz.load(std::memory_order_relaxed);
+        const double now = juce::Time::getMillisecondCounterHiRes();
+
+        // Fractional accumulator; at most one message per callback, and
+        // resync after a stall instead of bursting
+        if (now - lastSendTime < interval)
+            return;
+        lastSendTime += interval;
+        if (now - lastSendTime > 50.0)
+            lastSendTime = now;
+
+        sendState(now);
+    }
+
+    void sendState(double now)
+    {
+        State s;
+        uint8_t addr[kMaxAddressLen];
+        size_t addrLen;
+        {
+            const juce::SpinLock::ScopedLockType lock(stateLock);
+            s = state;
+            addrLen = addressPadded;
+            std::memcpy(addr, addressBytes, addrLen);
+        }
+
+        double posMs = s.positionMs;
+        if (s.playing && s.stampMs > 0.0)
+            posMs += (now - s.stampMs) * s.speed;
+
+        // Address + ",iiiififi" (10 bytes -> 12 padded) + 8 args x 4 bytes
+        constexpr size_t kTagLen = 12, kArgLen = 32;
+        constexpr size_t kBundleHeader = 8 + 8 + 4;    // "#bundle\0" + timetag + size
+        uint8_t packet[kBundleHeader + kMaxAddressLen + kTagLen + kArgLen];
+        std::memset(packet, 0, sizeof(packet));
+
+        const bool bundle = timetags.load(std::memory_order_relaxed);
+        size_t off = bundle ? kBundleHeader : 0;
+        const size_t msgStart = off;
+
+        std::memcpy(packet + off, addr, addrLen);
+        off += addrLen;
+        std::memcpy(packet + off, ",iiiififi", 9);
+        off += kTagLen;
+
+        writeBE32(packet, off, (uint32_t)s.tc.hours);
+        writeBE32(packet, off, (uint32_t)s.tc.minutes);
+        writeBE32(packet, off, (uint32_t)s.tc.seconds);
+        writeBE32(packet, off, (uint32_t)s.tc.frames);
+        writeFloat(packet, off, (float)frameRateToDouble(s.fps));
+        writeBE32(packet, off, s.playing ? 1u : 0u);
+        writeFloat(packet, off, (float)s.speed);
+        writeBE32(packet, off, (uint32_t)(int32_t)juce::jmax(0.0, posMs));
+
+        if (bundle)
+        {
+            std::memcpy(packet, "#bundle", 8);
+            // NTP timetag: seconds since 1900-01-01 + 32-bit binary fraction
+            const double wallMs = wallMsAtStart + (now - hiResAtStart);
+            const uint64_t secs = (uint64_t)(wallMs / 1000.0) + 2208988800ull;
+            const double   frac = std::fmod(wallMs, 1000.0) / 1000.0;
+            size_t t = 8;
+            writeBE32(packet, t, (uint32_t)secs);
+            writeBE32(packet, t, (uint32_t)(frac * 4294967296.0));
+            writeBE32(packet, t, (uint32_t)(off - msgStart));
+        }
+
+        if (!sender.sendPacketDirect(packet, (int)off))
+            sendErrors.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void writeBE32(uint8_t* p, size_t& off, uint32_t v)
+    {
+        p[off]     = (uint8_t)((v >> 24) & 0xFF);
+        p[off + 1] = (uint8_t)((v >> 16) & 0xFF);
+        p[off + 2] = (uint8_t)((v >> 8)  & 0xFF);
+        p[off + 3] = (uint8_t)(v & 0xFF);
+        off += 4;
+    }
+
+    static void writeFloat(uint8_t* p, size_t& off, float f)
+    {
+        uint32_t asInt;
+        std::memcpy(&asInt, &f, 4);
+        writeBE32(p, off, asInt);
+    }
+
+    //==============================================================================
+    OscSender sender;
+    juce::String destination;
+    std::atomic<bool> isRunningFlag { false };
+    std::atomic<int>  rateHz { kDefaultRateHz };
+    std::atomic<bool> timetags { false };
+    std::atomic<uint32_t> sendErrors { 0 };
+
+    juce::SpinLock stateLock;
+    State   state;                                       // under stateLock
+    uint8_t addressBytes[kMaxAddressLen] { '/', 's', 't', 'c', '/', 't', 'c' };  // under stateLock
+    size_t  addressPadded = 8;                           // "/stc/tc\0"
+
+    double lastSendTime  = 0.0;    // timer thread
+    double wallMsAtStart = 0.0;    // wall clock / hi-res counter pair for timetags
+    double hiResAtStart  = 0.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OscTimecodeOutput)
+};
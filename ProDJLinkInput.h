@@ -43,6 +43,7 @@
 #include <JuceHeader.h>
 #include "TimecodeCore.h"
 #include "NetworkUtils.h"
+#include "DisplaySnapshot.h"
 #include <atomic>
 #include <array>
 #include <cstring>
@@ -275,6 +276,64 @@ struct ProDJLinkPlayerState
     }
 };
 
+//==============================================================================
+// Display snapshot -- everything the PDL view shows, published as one unit
+// by the network thread (see DisplaySnapshot.h).  Same units and defaults
+// as the matching ProDJLinkInput getters.
+//==============================================================================
+struct ProDJLinkDisplaySnapshot
+{
+    uint32_t version = 0;
+    double   publishedMs = 0.0;    // juce::Time::getMillisecondCounterHiRes()
+
+    struct Player
+    {
+        bool     discovered = false;
+        char     model[21] {};
+        char     ip[16] {};
+        uint32_t playState = 0;
+        double   bpm = 0.0, faderPitch = 1.0, actualSpeed = 0.0;
+        bool     onAir = false, master = false, playing = false, reverse = false;
+        bool     hasAbsolutePosition = false, hasBeatDerivedPosition = false;
+        uint8_t  beatInBar = 1, loadedPlayer = 0, loadedSlot = 0;
+        uint32_t playheadMs = 0, trackLenSec = 0, trackId = 0;
+        uint32_t loopStartMs = 0, loopEndMs = 0;
+
+        float getPlayPositionRatio() const
+        {
+            return trackLenSec == 0 ? 0.0f
+                                    : float(double(playheadMs) / (double(trackLenSec) * 1000.0));
+        }
+
+        const char* getPositionSourceString() const
+        {
+            return hasAbsolutePosition ? "ABS" : hasBeatDerivedPosition ? "BEAT" : "NONE";
+        }
+    } players[ProDJLink::kMaxPlayers];
+
+    struct Mixer
+    {
+        bool     hasFaderData = false, hasVuData = false;   // fresh within 5s at publish time
+        uint32_t packetCount = 0;
+        char     djmModel[32] {};
+        uint8_t  fader[ProDJLink::kMaxMixerChannels] {}, trim[ProDJLink::kMaxMixerChannels] {};
+        uint8_t  comp[ProDJLink::kMaxMixerChannels] {}, send[ProDJLink::kMaxMixerChannels] {};
+        uint8_t  eqHi[ProDJLink::kMaxMixerChannels] {}, eqMid[ProDJLink::kMaxMixerChannels] {};
+        uint8_t  eqLoMid[ProDJLink::kMaxMixerChannels] {}, eqLo[ProDJLink::kMaxMixerChannels] {};
+        uint8_t  color[ProDJLink::kMaxMixerChannels] {}, xfAssign[ProDJLink::kMaxMixerChannels] {};
+        uint8_t  cue[ProDJLink::kMaxMixerChannels] {}, cueB[ProDJLink::kMaxMixerChannels] {};
+        uint8_t  crossfader = 128, masterFader = 255, booth = 0, hpLevel = 0;
+        uint8_t  beatFxSelect = 0, beatFxOn = 0;
+        float    vuPeak[ProDJLink::kVuSlots] {};                // normalised 0-1
+
+        /// DJM-V10 / V10-LF = 6 channels; all others (900NXS2, A9) = 4.
+        int getChannelCount() const
+        {
+            return juce::String(djmModel).containsIgnoreCase("V10") ? 6 : 4;
+        }
+    } mixer;
+};
+
 //==============================================================================
 // ProDJLinkInput -- main network handler
 //==============================================================================
@@ -1249,6 +1308,13 @@ public:
              + " DJ:" + juce::String((int)pktCountDJMStatus.load(std::memory_order_relaxed));
     }
 
+    //==========================================================================
+    // Display snapshot -- one consistent copy of all player and mixer state,
+    // republished by the network thread after every batch of packets.
+    // Message thread only (see DisplaySnapshot.h); compare `version` to skip work.
+    //==========================================================================
+    const ProDJLinkDisplaySnapshot& getDisplaySnapshot() { return displaySnapshots.read(); }
+
 private:
     //==========================================================================
     // Thread loop
@@ -1262,8 +1328,10 @@ private:
         // -> then starts 54B keepalive 0x06 (player=0xC1).
         // The DJM needs to see this announce before it activates fader delivery.
         performBridgeJoinSequence();
+        publishDisplaySnapshot();
 
         double lastKeepaliveSend  = 0.0;
+        double lastSnapshotPublish = 0.0;
         double lastBridgeSubSend  = 0.0;
         double lastBridgeNotify   = 0.0;
         double firstKeepaliveSent = 0.0;   // timestamp of very first keepalive
@@ -1362,6 +1430,7 @@ private:
 
             juce::String sender;
             int port = 0;
+            bool stateChanged = false;
 
             // Block up to 5ms waiting for a beat/abspos/mixer packet.
             // Falls through immediately if a packet is already waiting.
@@ -1374,7 +1443,10 @@ private:
                 uint8_t buf[256];
                 int n = keepaliveSock->read(buf, sizeof(buf), false, sender, port);
                 if (n > 0)
+                {
                     handleKeepalivePacket(buf, n, sender);
+                    stateChanged = true;
+                }
             }
 
             // Beat (port 50001) -- abspos ~67Hz, DJM mixer ~33Hz, drain all ready
@@ -1386,7 +1458,10 @@ private:
                     uint8_t buf[600];
                     int n = beatSock->read(buf, sizeof(buf), false, sender, port);
                     if (n > 0)
+                    {
                         handleBeatPacket(buf, n);
+                        stateChanged = true;
+                    }
                     ++beatDrained;
                 }
             }
@@ -1400,18 +1475,102 @@ private:
                     uint8_t buf[1200];
                     int n = statusSock->read(buf, sizeof(buf), false, sender, port);
                     if (n > 0)
+                    {
                         handleStatusPacket(buf, n);
+                        stateChanged = true;
+                    }
                     ++statusDrained;
                 }
             }
 
             // GC: remove stale players
             gcPlayers(now);
+
+            // One display snapshot per batch of packets; a slow refresh
+            // otherwise so timeouts and staleness flags still show
+            if (stateChanged || (now - lastSnapshotPublish) >= 250.0)
+            {
+                publishDisplaySnapshot();
+                lastSnapshotPublish = now;
+            }
         }
 
         DBG("ProDJLink: Thread stopped");
     }
 
+    //==========================================================================
+    // Display snapshot (network thread -- the only producer)
+    //==========================================================================
+    void publishDisplaySnapshot()
+    {
+        auto& s = displaySnapshots.beginWrite();
+        s.publishedMs = juce::Time::getMillisecondCounterHiRes();
+
+        for (int i = 0; i < ProDJLink::kMaxPlayers; ++i)
+        {
+            const int pn = i + 1;
+            const auto& p = players[i];
+            auto& d = s.players[i];
+            d.discovered = p.discovered.load(std::memory_order_acquire);
+            std::memcpy(d.model, d.discovered ? p.model : "", d.discovered ? sizeof(d.model) : 1);
+            std::memcpy(d.ip, d.discovered ? p.ipStr : "", d.discovered ? sizeof(d.ip) : 1);
+            d.playState   = p.playState.load(std::memory_order_relaxed);
+            d.bpm         = getBPM(pn);
+            d.faderPitch  = getFaderPitch(pn);
+            d.actualSpeed = getActualSpeed(pn);
+            d.onAir       = p.isOnAir.load(std::memory_order_relaxed);
+            d.master      = p.isMaster.load(std::memory_order_relaxed);
+            d.playing     = isPlayerPlaying(pn);
+            d.reverse     = p.isReverse.load(std::memory_order_relaxed);
+            d.hasAbsolutePosition    = p.hasAbsolutePosition.load(std::memory_order_relaxed);
+            d.hasBeatDerivedPosition = p.hasBeatDerivedPosition.load(std::memory_order_relaxed);
+            d.beatInBar    = p.beatInBar.load(std::memory_order_relaxed);
+            d.loadedPlayer = p.loadedPlayer.load(std::memory_order_relaxed);
+            d.loadedSlot   = p.loadedSlot.load(std::memory_order_relaxed);
+            d.playheadMs   = p.playheadMs.load(std::memory_order_relaxed);
+            d.trackLenSec  = p.trackLenSec.load(std::memory_order_relaxed);
+            d.trackId      = p.trackId.load(std::memory_order_relaxed);
+            d.loopStartMs  = p.loopStartMs.load(std::memory_order_relaxed);
+            d.loopEndMs    = p.loopEndMs.load(std::memory_order_relaxed);
+        }
+
+        auto& m = s.mixer;
+        m.hasFaderData = hasMixerFaderData();
+        m.hasVuData    = hasVuMeterData();
+        m.packetCount  = getMixerPacketCount();
+        {
+            const juce::ScopedLock sl(djmIpLock);
+            const char* model = djmModels.empty() ? "" : djmModels[0].c_str();
+            std::strncpy(m.djmModel, model, sizeof(m.djmModel) - 1);
+            m.djmModel[sizeof(m.djmModel) - 1] = 0;
+        }
+        for (int ch = 0; ch < ProDJLink::kMaxMixerChannels; ++ch)
+        {
+            m.fader[ch]    = mixerFader[ch].load(std::memory_order_relaxed);
+            m.trim[ch]     = mixerTrim[ch].load(std::memory_order_relaxed);
+            m.comp[ch]     = mixerComp[ch].load(std::memory_order_relaxed);
+            m.send[ch]     = mixerSend[ch].load(std::memory_order_relaxed);
+            m.eqHi[ch]     = mixerEqHi[ch].load(std::memory_order_relaxed);
+            m.eqMid[ch]    = mixerEqMid[ch].load(std::memory_order_relaxed);
+            m.eqLoMid[ch]  = mixerEqLoMid[ch].load(std::memory_order_relaxed);
+            m.eqLo[ch]     = mixerEqLo[ch].load(std::memory_order_relaxed);
+            m.color[ch]    = mixerColor[ch].load(std::memory_order_relaxed);
+            m.xfAssign[ch] = mixerXfAssign[ch].load(std::memory_order_relaxed);
+            m.cue[ch]      = mixerCueBtn[ch].load(std::memory_order_relaxed);
+            m.cueB[ch]     = mixerCueBtnB[ch].load(std::memory_order_relaxed);
+        }
+        m.crossfader   = mixerCrossfader.load(std::memory_order_relaxed);
+        m.masterFader  = mixerMasterFader.load(std::memory_order_relaxed);
+        m.booth        = mixerBooth.load(std::memory_order_relaxed);
+        m.hpLevel      = mixerHpLevel.load(std::memory_order_relaxed);
+        m.beatFxSelect = mixerBeatFxSel.load(std::memory_order_relaxed);
+        m.beatFxOn     = mixerBeatFxOn.load(std::memory_order_relaxed);
+        for (int ch = 0; ch < ProDJLink::kVuSlots; ++ch)
+            m.vuPeak[ch] = getVuPeakNorm(ch);
+
+        displaySnapshots.publish();
+    }
+
     //==========================================================================
     // Dual keepalive system -- CDJ + DJM compatible
     //
@@ -2863,6 +3022,8 @@ private:
     juce::CriticalSection         djmIpLock;
     std::vector<std::string>      djmIps;
     std::vector<std::string>      djmModels;    // model name per DJM, parallel to djmIps
+
+    SnapshotTripleBuffer<ProDJLinkDisplaySnapshot> displaySnapshots;
     std::vector<double>           djmLastSeen;  // millisecond timestamp, parallel to djmIps
 
     // Selected player for timecode output (1-based)
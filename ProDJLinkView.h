@@ -15,7 +15,8 @@
 //   - On-air / master / beat indicators
 //   - DJM mixer fader + crossfader visualization
 //
-// Architecture: Owns its own 60Hz Timer, reads data from shared objects
+// Architecture: Framed by UiFrameScheduler (up to 60Hz, less when hidden,
+// covered or idle), reads data from shared objects
 // (ProDJLinkInput, DbServerClient, TrackMap, engines) via const getters.
 // Actively requests metadata from DbServerClient for all discovered
 // players (independently of engine assignments) so waveform, artwork,
@@ -27,6 +28,9 @@
 #include "DbServerClient.h"
 #include "MediaDisplay.h"
 #include "WaveformDetailDisplay.h"
+#include "RenderWorker.h"
+#include "UiFrameScheduler.h"
+#include "GpuCompositor.h"
 #include "TimecodeEngine.h"
 #include "AppSettings.h"
 #include "CustomLookAndFeel.h"
@@ -37,7 +41,7 @@
 // ProDJLinkViewComponent -- Main content: 4 deck panels + mixer strip
 //==============================================================================
 class ProDJLinkViewComponent : public juce::Component,
-                                public juce::Timer
+                                private UiFrameScheduler::Client
 {
 public:
     ProDJLinkViewComponent(ProDJLinkInput& pdl,
@@ -77,14 +81,28 @@ public:
             if (onLayoutChanged) onLayoutChanged();
         };
 
-        startTimerHz(60);
+        // Pre-scaled artwork lands asynchronously; the deck image holds it
+        for (int d = 0; d < 4; ++d)
+        {
+            deckState[d].scaledArtwork.onReady = [this, d]
+            {
+                deckState[d].invalidateDeckImg();
+                if (!deckBounds[d].isEmpty())
+                    repaint(deckBounds[d]);
+            };
+        }
+
+        frameScheduler->addClient(this, 60);
     }
 
     ~ProDJLinkViewComponent() override
     {
-        stopTimer();
+        stopUpdates();
     }
 
+    /// No more frames (window closed; it is recreated on reopen).
+    void stopUpdates() { frameScheduler->removeClient(this); }
+
     // Called when BPM multiplier is saved to TrackMap via double-click.
     // Wire this to save settings and refresh engine lookups.
     std::function<void()> onTrackMapChanged;
@@ -113,7 +131,7 @@ public:
 
 private:
     //==========================================================================
-    // Per-deck state cache (updated every timer tick)
+    // Per-deck state cache (updated every UI frame)
     //==========================================================================
     struct DeckState
     {
@@ -140,23 +158,41 @@ private:
         juce::Rectangle<int> wfLocalBounds;  // waveform area relative to deck (set during paintDeckStatic)
         juce::Rectangle<int> detailLocalBounds; // detail waveform area relative to deck
         uint32_t displayedDetailTrackId = 0;
-        int detailRetryTicks = 0;  // countdown for supplementary data retry
+        double detailRetryMs = 0.0;     // time spent polling for the detail waveform
+        double detailNextPollMs = 0.0;  // detailRetryMs of the next cache fetch
         // Fed-tracking: avoid redundant full metadata copies during retry
         bool previewCuesFed = false, previewBeatGridFed = false;
-        int  previewRetryTicks = 0;  // countdown for preview supplementary data
+        double previewRetryMs = 0.0;  // countdown for preview supplementary data
         bool detailCuesFed = false, detailBeatGridFed = false, detailSongStructFed = false;
         uint32_t lastMetaVersion = 0;  // tracks DbServerClient cache version to skip redundant copies
         uint32_t lastDetailVersion = 0;  // separate version tracker for detail waveform section
+
+        // Memoised TrackMap resolution (resolveTrackMapEntry) -- redone only
+        // when one of the key fields changes
+        struct TrackMapMemo
+        {
+            uint32_t trackId = 0, lenSec = 0;
+            uint64_t generation = ~(uint64_t)0;
+            juce::String artist, title;
+            const TrackMapEntry* entry = nullptr;
+            juce::String offsetText;      // entry->timecodeOffset that oH..oF were parsed from
+            bool offsetParsed = false, offsetValid = false;
+            int oH = 0, oM = 0, oS = 0, oF = 0;
+        } tmMemo;
+        // Key of the last full metadata copy: re-read only on a new version
+        uint32_t metaReadTrackId = 0, metaReadVersion = 0;
+        juce::String metaReadIP;
         juce::Rectangle<int> tcLocalBounds;  // timecode row relative to deck (set during paintDeckStatic)
         juce::Rectangle<int> mapLocalBounds; // offset timecode row relative to deck
         juce::Rectangle<int> timeLocalBounds; // track time row relative to deck (for click-to-toggle)
         bool showRemainingTime = false;      // false=elapsed, true=remaining (per deck)
         juce::Image     cachedArtworkImg;  // cached from DbServerClient (avoid lock during paint)
+        ScaledImageCache scaledArtwork;    // cachedArtworkImg at its drawn size (RenderWorker)
         uint32_t displayedWaveformTrackId = 0;
         uint32_t displayedArtworkId = 0;
         uint32_t prevTrackId = 0;
         bool     metadataRequested = false;  // true once we've sent a dbserver request for this track
-        int      metadataRequestTick = 0;   // tick counter for retry after ~3s
+        double   metadataRequestMs = 0.0;   // time since request, retried after ~3s
 
         // Cached deck image -- Windows only (GDI benefits from caching).
         // On macOS, painting directly preserves CoreGraphics subpixel AA.
@@ -296,6 +332,59 @@ public:
         }
     }
 
+    //--------------------------------------------------------------------------
+    // TrackMap entry for a deck's track: exact duration, then no duration,
+    // then any duration, then a differently-tagged match above the
+    // auto-match threshold (findBestMatchFuzzy).  Memoised on (trackId, length, artist, title,
+    // TrackMap generation); the generation changes whenever entries are added
+    // or removed, which is also what keeps the cached pointer valid.  Entry
+    // fields are read live, so in-place edits need no invalidation -- only
+    // the parsed offset is re-checked against the entry's string.
+    //--------------------------------------------------------------------------
+    static bool sameText(const juce::String& a, const juce::String& b)
+    {
+        return a.getCharPointer() == b.getCharPointer() || a == b;   // shared buffer: no compare
+    }
+
+    const TrackMapEntry* resolveTrackMapEntry(DeckState& ds)
+    {
+        auto& m = ds.tmMemo;
+        const uint64_t gen = trackMap.getGeneration();
+
+        if (m.generation != gen || m.trackId != ds.trackId || m.lenSec != ds.trackLenSec
+            || !sameText(m.artist, ds.artist) || !sameText(m.title, ds.title))
+        {
+            m.generation = gen;
+            m.trackId    = ds.trackId;
+            m.lenSec     = ds.trackLenSec;
+            m.artist     = ds.artist;
+            m.title      = ds.title;
+            m.entry      = nullptr;
+            m.offsetParsed = false;
+
+            if (ds.title.isNotEmpty())
+            {
+                m.entry = std::as_const(trackMap).findBestMatchFuzzy(TrackKey::make(ds.artist, ds.title, (int)ds.trackLenSec));
+            }
+        }
+
+        if (m.entry != nullptr && (!m.offsetParsed || !sameText(m.offsetText, m.entry->timecodeOffset)))
+        {
+            m.offsetParsed = true;
+            m.offsetText  = m.entry->timecodeOffset;
+            m.offsetValid = TrackMapEntry::parseTimecodeString(m.offsetText, m.oH, m.oM, m.oS, m.oF);
+        }
+        return m.entry;
+    }
+
+    /// The resolved entry for editing: looked up again through TrackMap's
+    /// mutable (memoised) overload, so only edits are tracked for save().
+    TrackMapEntry* resolveTrackMapEntryForEdit(DeckState& ds)
+    {
+        if (resolveTrackMapEntry(ds) == nullptr) return nullptr;
+        return trackMap.findBestMatchFuzzy(TrackKey::make(ds.artist, ds.title, (int)ds.trackLenSec));
+    }
+
     //--------------------------------------------------------------------------
     // Persist BPM multiplier to TrackMap.
     // Toggle logic: if TrackMap already has this value, clear it; else set it.
@@ -307,11 +396,7 @@ public:
         if (ds.title.isEmpty()) return;
 
         int dur = (int)ds.trackLenSec;
-        auto* entry = trackMap.find(ds.artist, ds.title, dur);
-        if (!entry && dur > 0)
-            entry = trackMap.find(ds.artist, ds.title, 0);
-        if (!entry)
-            entry = trackMap.findIgnoringDuration(ds.artist, ds.title);
+        auto* entry = resolveTrackMapEntryForEdit(ds);
         int currentMapValue = (entry != nullptr) ? entry->bpmMultiplier : 0;
 
         // Double-click on 1x: clear saved value. Otherwise: save (no toggle).
@@ -326,6 +411,7 @@ public:
         if (entry != nullptr)
         {
             entry->bpmMultiplier = newValue;
+            trackMap.markChanged(*entry);
         }
         else if (newValue != 0)
         {
@@ -391,6 +477,7 @@ public:
     //==========================================================================
     void paint(juce::Graphics& g) override
     {
+        frameScheduler->beginPaint(this);   // closed in paintOverChildren
         g.fillAll(bgMain);
     }
 
@@ -457,29 +544,37 @@ public:
     }
 
     //==========================================================================
-    void timerCallback() override
+    juce::Component& getFrameComponent() override { return *this; }
+
+    bool uiFrame(double elapsedMs) override
     {
+        bool live = false;   // anything moving this frame (keeps the full frame rate)
+
+        // One consistent copy of all player/mixer state for this frame
+        const auto& pdl = proDJLink.getDisplaySnapshot();
+
         for (int deck = 0; deck < 4; ++deck)
         {
             int pn = deck + 1; // 1-based player number
             auto& ds = deckState[deck];
-
-            ds.discovered    = proDJLink.isPlayerDiscovered(pn);
-            ds.model         = proDJLink.getPlayerModel(pn);
-            ds.ip            = proDJLink.getPlayerIP(pn);
-            ds.playState     = proDJLink.getPlayStateString(pn);
-            ds.bpm           = proDJLink.getBPM(pn);
-            ds.faderPitch    = proDJLink.getFaderPitch(pn);
-            ds.isOnAir       = proDJLink.isPlayerOnAir(pn);
-            ds.isMaster      = proDJLink.isPlayerMaster(pn);
-            ds.isPlaying     = proDJLink.isPlayerPlaying(pn);
-            ds.isReverse     = proDJLink.isPlayingReverse(pn);
-            ds.beatInBar     = proDJLink.getBeatInBar(pn);
-            ds.xfAssign      = proDJLink.hasMixerFaderData() ? proDJLink.getChannelXfAssign(pn) : 0;
-            ds.playheadMs    = proDJLink.getPlayheadMs(pn);
-            ds.trackLenSec   = proDJLink.getTrackLengthSec(pn);
-            ds.trackId       = proDJLink.getTrackID(pn);
-            ds.posSource     = proDJLink.getPositionSourceString(pn);
+            const auto& pl = pdl.players[deck];
+
+            ds.discovered    = pl.discovered;
+            if (ds.model != pl.model) ds.model = pl.model;
+            if (ds.ip    != pl.ip)    ds.ip    = pl.ip;
+            ds.playState     = ProDJLink::playStateToString(pl.playState);
+            ds.bpm           = pl.bpm;
+            ds.faderPitch    = pl.faderPitch;
+            ds.isOnAir       = pl.onAir;
+            ds.isMaster      = pl.master;
+            ds.isPlaying     = pl.playing;
+            ds.isReverse     = pl.reverse;
+            ds.beatInBar     = pl.beatInBar;
+            ds.xfAssign      = pdl.mixer.hasFaderData ? pdl.mixer.xfAssign[deck] : 0;
+            ds.playheadMs    = pl.playheadMs;
+            ds.trackLenSec   = pl.trackLenSec;
+            ds.trackId       = pl.trackId;
+            ds.posSource     = pl.getPositionSourceString();
 
             // Timecode from playhead
             FrameRate fps = proDJLink.getDetectedFrameRate(pn);
@@ -487,33 +582,23 @@ public:
             ds.fpsStr = frameRateToString(fps);
 
             // Position ratio for waveform cursor
-            ds.posRatio = proDJLink.getPlayPositionRatio(pn);
+            ds.posRatio = pl.getPlayPositionRatio();
 
-            // TrackMap lookup (single find, reused for offset + BPM multiplier)
-            const TrackMapEntry* tmEntry = nullptr;
+            // TrackMap lookup (memoised, reused for offset + BPM multiplier)
+            const TrackMapEntry* tmEntry = resolveTrackMapEntry(ds);
             ds.trackMapped = false;
             ds.offset = "00:00:00:00";
             ds.offsetTimecode = {};
-            if (ds.title.isNotEmpty())
+            if (tmEntry != nullptr)
             {
-                tmEntry = trackMap.find(ds.artist, ds.title, (int)ds.trackLenSec);
-                if (!tmEntry && ds.trackLenSec > 0)
-                    tmEntry = trackMap.find(ds.artist, ds.title, 0);
-                if (!tmEntry)
-                    tmEntry = trackMap.findIgnoringDuration(ds.artist, ds.title);
-                if (tmEntry != nullptr)
-                {
-                    ds.trackMapped = true;
-                    ds.offset = tmEntry->timecodeOffset;
-
-                    // Parse offset and compute running timecode with offset applied
-                    int oH, oM, oS, oF;
-                    if (TrackMapEntry::parseTimecodeString(tmEntry->timecodeOffset, oH, oM, oS, oF))
-                    {
-                        ds.offsetTimecode = applyTimecodeOffset(
-                            ds.timecode, fps, oH, oM, oS, oF, fps);
-                    }
-                }
+                ds.trackMapped = true;
+                ds.offset = tmEntry->timecodeOffset;
+
+                // Compute running timecode with the (pre-parsed) offset applied
+                auto& m = ds.tmMemo;
+                if (m.offsetParsed && m.offsetValid)
+                    ds.offsetTimecode = applyTimecodeOffset(
+                        ds.timecode, fps, m.oH, m.oM, m.oS, m.oF, fps);
             }
 
             // Engine assignment: find which engines monitor this player
@@ -538,14 +623,15 @@ public:
                 ds.detailWaveform.clear();
                 ds.displayedWaveformTrackId = 0;
                 ds.displayedDetailTrackId = 0;
-                ds.detailRetryTicks = 0;
-                ds.previewRetryTicks = 0;
+                ds.detailRetryMs = ds.detailNextPollMs = 0.0;
+                ds.previewRetryMs = 0.0;
                 ds.previewCuesFed = false;
                 ds.previewBeatGridFed = false;
                 ds.detailCuesFed = false;
                 ds.detailBeatGridFed = false;
                 ds.detailSongStructFed = false;
                 ds.lastMetaVersion = 0;
+                ds.metaReadVersion = 0;
                 ds.lastDetailVersion = 0;
                 ds.displayedArtworkId = 0;
                 ds.cachedArtworkImg = {};
@@ -564,21 +650,22 @@ public:
             // so waveform/artwork/info loads even without an engine assigned.
             // IMPORTANT: resolve SOURCE player IP -- when CDJ 2 loads from
             // CDJ 1's USB via Link Export, the metadata is on CDJ 1.
-            uint8_t srcPlayer = proDJLink.getLoadedPlayer(pn);
-            if (srcPlayer == 0) srcPlayer = (uint8_t)pn;
-            juce::String srcIP = proDJLink.getPlayerIP((int)srcPlayer);
+            uint8_t srcPlayer = pl.loadedPlayer;
+            if (srcPlayer == 0 || srcPlayer > ProDJLink::kMaxPlayers) srcPlayer = (uint8_t)pn;
+            const auto& src = pdl.players[srcPlayer - 1];
+            juce::String srcIP = src.discovered ? juce::String(src.ip) : ds.ip;
             if (srcIP.isEmpty()) srcIP = ds.ip;
 
             if (ds.trackId != 0 && !ds.metadataRequested
                 && !srcIP.isEmpty() && dbClient.getIsRunning())
             {
-                uint8_t slot = proDJLink.getLoadedSlot(pn);
+                uint8_t slot = pl.loadedSlot;
                 if (slot != 0)
                 {
                     // Choose dbserver query identity.
                     // CDJ-3000: accepts player 5 (VCDJ). NXS2: requires 1-4.
                     int dbCtx;
-                    if (proDJLink.playerHasAbsolutePosition((int)srcPlayer))
+                    if (src.hasAbsolutePosition)
                     {
                         dbCtx = proDJLink.getVCDJPlayerNumber();
                         if (dbCtx == (int)srcPlayer)
@@ -589,19 +676,19 @@ public:
                         dbCtx = proDJLink.suggestDbPlayerNumber((int)srcPlayer);
                         if (dbCtx == 0) dbCtx = 1;  // last resort fallback
                     }
-                    juce::String model = proDJLink.getPlayerModel((int)srcPlayer);
                     dbClient.requestMetadata(
-                        srcIP, slot, 1, ds.trackId, dbCtx, model);
+                        srcIP, slot, 1, ds.trackId, dbCtx, juce::String(src.model));
                     ds.metadataRequested = true;
-                    ds.metadataRequestTick = 0;
+                    ds.metadataRequestMs = 0.0;
                 }
             }
 
-            // Retry if metadata hasn't arrived after ~3s (180 ticks at 60Hz)
+            // Retry if metadata hasn't arrived after ~3s
             if (ds.metadataRequested && ds.artist.isEmpty()
                 && ds.displayedWaveformTrackId != ds.trackId)
             {
-                if (++ds.metadataRequestTick > 180)
+                ds.metadataRequestMs += elapsedMs;
+                if (ds.metadataRequestMs > 3000.0)
                     ds.metadataRequested = false;  // allow re-request
             }
 
@@ -613,6 +700,24 @@ public:
                 bool needMeta = ds.artist.isEmpty()
                              || ds.displayedWaveformTrackId != ds.trackId;
 
+                // ...and only when the cache holds something newer than the
+                // last copy we took (a version check doesn't copy the struct)
+                if (needMeta && !srcIP.isEmpty())
+                {
+                    uint32_t ver = dbClient.getMetadataVersion(srcIP, ds.trackId);
+                    if (ver == 0) ver = dbClient.getMetadataVersionByTrackId(ds.trackId);
+                    if (ver == 0
+                        || (ver == ds.metaReadVersion && ds.trackId == ds.metaReadTrackId
+                            && srcIP == ds.metaReadIP))
+                        needMeta = false;
+                    else
+                    {
+                        ds.metaReadVersion = ver;
+                        ds.metaReadTrackId = ds.trackId;
+                        ds.metaReadIP = srcIP;
+                    }
+                }
+
                 if (needMeta && !srcIP.isEmpty())
                 {
                     auto meta = dbClient.getCachedMetadata(srcIP, ds.trackId);
@@ -644,7 +749,7 @@ public:
                             if (meta.hasBeatGrid())
                                 { ds.waveform.setBeatGrid(meta.beatGrid); ds.previewBeatGridFed = true; }
                             ds.displayedWaveformTrackId = ds.trackId;
-                            ds.previewRetryTicks = (!ds.previewCuesFed || !ds.previewBeatGridFed) ? 180 : 0;
+                            ds.previewRetryMs = (!ds.previewCuesFed || !ds.previewBeatGridFed) ? 3000.0 : 0.0;
                             ds.invalidateDeckImg();
                             if (!deckBounds[pn - 1].isEmpty())
                                 repaint(deckBounds[pn - 1]);
@@ -716,7 +821,7 @@ public:
                                 if (metaById.hasBeatGrid())
                                     { ds.waveform.setBeatGrid(metaById.beatGrid); ds.previewBeatGridFed = true; }
                                 ds.displayedWaveformTrackId = ds.trackId;
-                                ds.previewRetryTicks = (!ds.previewCuesFed || !ds.previewBeatGridFed) ? 180 : 0;
+                                ds.previewRetryMs = (!ds.previewCuesFed || !ds.previewBeatGridFed) ? 3000.0 : 0.0;
                                 ds.invalidateDeckImg();
                                 if (!deckBounds[pn - 1].isEmpty())
                                     repaint(deckBounds[pn - 1]);
@@ -729,7 +834,7 @@ public:
                 // after the preview waveform.  Only fetch when the background
                 // thread has actually updated the cache (version changed).
                 if (ds.displayedWaveformTrackId == ds.trackId
-                    && ds.previewRetryTicks > 0
+                    && ds.previewRetryMs > 0.0
                     && (!ds.previewCuesFed || !ds.previewBeatGridFed))
                 {
                     uint32_t ver = dbClient.getMetadataVersion(srcIP, ds.trackId);
@@ -770,9 +875,9 @@ public:
                         }
                     }
                     if (ds.previewCuesFed && ds.previewBeatGridFed)
-                        ds.previewRetryTicks = 0;
+                        ds.previewRetryMs = 0.0;
                     else
-                        ds.previewRetryTicks--;
+                        ds.previewRetryMs -= elapsedMs;
                 }
 
                 // Fallback: if still no title, show "Track #ID" from protocol
@@ -833,15 +938,16 @@ public:
                 {
                     ds.detailWaveform.clear();
                     ds.displayedDetailTrackId = 0;
-                    ds.detailRetryTicks = 0;
+                    ds.detailRetryMs = ds.detailNextPollMs = 0.0;
                 }
-                ds.previewRetryTicks = 0;
+                ds.previewRetryMs = 0.0;
                 ds.previewCuesFed = false;
                 ds.previewBeatGridFed = false;
                 ds.detailCuesFed = false;
                 ds.detailBeatGridFed = false;
                 ds.detailSongStructFed = false;
                 ds.lastMetaVersion = 0;
+                ds.metaReadVersion = 0;
                 ds.lastDetailVersion = 0;
                 ds.displayedArtworkId = 0;
                 ds.cachedArtworkImg = {};
@@ -857,6 +963,14 @@ public:
             if (ds.waveform.hasWaveformData())
                 ds.waveform.setPlayPosition(ds.posRatio);
 
+            // Waveform pyramids and detail tiles are rendered off-thread;
+            // repaint once they land (we paint both manually)
+            if (ds.waveform.takePendingRepaint() && !deckBounds[pn - 1].isEmpty())
+                repaint(deckBounds[pn - 1]);
+            if (ds.detailWaveform.takePendingRepaint()
+                && !ds.detailLocalBounds.isEmpty() && !deckBounds[pn - 1].isEmpty())
+                repaint(ds.detailLocalBounds + deckBounds[pn - 1].getPosition());
+
             // Detail waveform: feed data, beat grid, song structure, cues.
             // Data arrives asynchronously from DbServerClient (phase 2 + NFS thread).
             // Poll periodically until detail data arrives.
@@ -876,20 +990,18 @@ public:
                         doFetch = true;
                     else
                     {
-                        ds.detailRetryTicks++;
-                        if (ds.detailRetryTicks % 60 == 1)
+                        // Fetch once per second while waiting, first one immediately
+                        ds.detailRetryMs += elapsedMs;
+                        if (ds.detailRetryMs >= ds.detailNextPollMs)
+                        {
                             doFetch = true;
-                    }
+                            ds.detailNextPollMs = ds.detailRetryMs + 1000.0;
 
-                    // Log once per second to track progress
-                    if (ds.detailRetryTicks % 60 == 0)
-                    {
-                        DBG("PDL Detail POLL P" + juce::String(pn)
-                            + ": needsInitial tick=" + juce::String(ds.detailRetryTicks)
-                            + " hasDetail=" + juce::String((int)hasDetail)
-                            + " doFetch=" + juce::String((int)doFetch)
-                            + " trackId=" + juce::String(ds.trackId)
-                            + " srcIP=" + srcIP);
+                            DBG("PDL Detail POLL P" + juce::String(pn)
+                                + ": needsInitial ms=" + juce::String((int)ds.detailRetryMs)
+                                + " trackId=" + juce::String(ds.trackId)
+                                + " srcIP=" + srcIP);
+                        }
                     }
                 }
                 else if (needsSupplementary)
@@ -928,7 +1040,7 @@ public:
                             ds.detailWaveform.setDetailData(meta.detailData,
                                 meta.detailEntryCount, meta.detailBytesPerEntry, durMs);
                             ds.displayedDetailTrackId = ds.trackId;
-                            ds.detailRetryTicks = 0;  // stop polling
+                            ds.detailRetryMs = ds.detailNextPollMs = 0.0;  // stop polling
                             ds.invalidateDeckImg();
                             if (!deckBounds[pn - 1].isEmpty())
                                 repaint(deckBounds[pn - 1]);
@@ -1021,12 +1133,7 @@ public:
                             if (ds.title.isNotEmpty()
                                 && (!isShowLockedFn || !isShowLockedFn()))
                             {
-                                int dur = (int)ds.trackLenSec;
-                                auto* mutableEntry = trackMap.find(ds.artist, ds.title, dur);
-                                if (!mutableEntry && dur > 0)
-                                    mutableEntry = trackMap.find(ds.artist, ds.title, 0);
-                                if (!mutableEntry)
-                                    mutableEntry = trackMap.findIgnoringDuration(ds.artist, ds.title);
+                                auto* mutableEntry = resolveTrackMapEntryForEdit(ds);
                                 if (mutableEntry != nullptr && mutableEntry->cuePoints.empty())
                                 {
                                     for (auto& rc : meta.cueList)
@@ -1050,18 +1157,14 @@ public:
                                         mutableEntry->cuePoints.push_back(std::move(cp));
                                     }
                                     mutableEntry->sortCuePoints();
+                                    trackMap.markChanged(*mutableEntry);
                                 }
                             }
                         }
                         else if (!ds.detailCuesFed)
                         {
                             // Cues not yet from rekordbox -- fallback to TrackMap
-                            int dur = (int)ds.trackLenSec;
-                            auto* tmFallback = trackMap.find(ds.artist, ds.title, dur);
-                            if (!tmFallback && dur > 0)
-                                tmFallback = trackMap.find(ds.artist, ds.title, 0);
-                            if (!tmFallback)
-                                tmFallback = trackMap.findIgnoringDuration(ds.artist, ds.title);
+                            auto* tmFallback = resolveTrackMapEntry(ds);
                             if (tmFallback && !tmFallback->cuePoints.empty())
                                 ds.detailWaveform.setCuePoints(tmFallback->cuePoints);
                         }
@@ -1098,15 +1201,14 @@ public:
             if (ds.detailWaveform.hasDetailData())
             {
                 ds.detailWaveform.setPlayheadMs(ds.playheadMs, ds.isPlaying, ds.faderPitch);
-                ds.detailWaveform.setActiveLoop(
-                    proDJLink.getLoopStartMs(pn),
-                    proDJLink.getLoopEndMs(pn));
+                ds.detailWaveform.setActiveLoop(pl.loopStartMs, pl.loopEndMs);
 
                 // Force repaint of detail area every frame when playing or decelerating.
                 // The detail waveform is not a real child component (painted manually
                 // in paintDeck), so its repaint() doesn't reach us. We must drive it.
                 bool needsDetailRepaint = ds.isPlaying
                     || ds.detailWaveform.isAnimating();
+                live = live || needsDetailRepaint;
                 if (needsDetailRepaint && !ds.detailLocalBounds.isEmpty()
                     && !deckBounds[pn - 1].isEmpty())
                 {
@@ -1117,23 +1219,25 @@ public:
         }
 
         // --- Smooth VU meters ---
-        if (proDJLink.hasVuMeterData())
+        // Decay factors are per 60Hz frame, scaled to the actual interval
+        const float frames60 = (float)(elapsedMs * 60.0 / 1000.0);
+        if (pdl.mixer.hasVuData)
         {
             for (int ch = 0; ch < ProDJLink::kVuSlots; ++ch)
             {
-                float target = proDJLink.getVuPeakNorm(ch);
+                float target = pdl.mixer.vuPeak[ch];
                 // Fast attack, slow decay (ballistic meter feel)
                 if (target > vuSmoothed[ch])
                     vuSmoothed[ch] = target;
                 else
-                    vuSmoothed[ch] *= 0.94f;  // ~120ms decay at 60Hz
+                    vuSmoothed[ch] *= std::pow(0.94f, frames60);  // ~120ms decay
                 if (vuSmoothed[ch] < 0.001f) vuSmoothed[ch] = 0.0f;
             }
         }
         else
         {
             for (int ch = 0; ch < ProDJLink::kVuSlots; ++ch)
-                vuSmoothed[ch] *= 0.95f;  // decay when no VU data at 60Hz
+                vuSmoothed[ch] *= std::pow(0.95f, frames60);  // decay when no VU data
         }
 
         // Two levels of dirty:
@@ -1172,6 +1276,7 @@ public:
 
             if (staticDirty || frameDirty)
             {
+                live = true;
                 snap.discovered         = ds.discovered;
                 snap.isOnAir            = ds.isOnAir;
                 snap.isMaster           = ds.isMaster;
@@ -1231,7 +1336,7 @@ public:
         // Mixer panel: repaint when fader data arrives or VU changes.
         if (showMixer && !mixerBounds.isEmpty())
         {
-            bool hasFaderData = proDJLink.hasMixerFaderData();
+            bool hasFaderData = pdl.mixer.hasFaderData;
 
             // Detect fader/knob changes via DJM packet counter.
             // Each 0x39 packet increments the counter -- if it changed,
@@ -1239,7 +1344,7 @@ public:
             bool faderDirty = false;
             if (hasFaderData)
             {
-                uint32_t pktCount = proDJLink.getMixerPacketCount();
+                uint32_t pktCount = pdl.mixer.packetCount;
                 if (pktCount != lastMixerPktCount)
                 {
                     lastMixerPktCount = pktCount;
@@ -1275,8 +1380,13 @@ public:
             }
 
             if (faderDirty)
+            {
+                live = true;
                 repaint(mixerBounds);
+            }
         }
+
+        return live;
     }
 
     //==========================================================================
@@ -1292,6 +1402,8 @@ public:
         // Paint mixer (only if visible)
         if (showMixer && !mixerBounds.isEmpty())
             paintMixer(g, mixerBounds);
+
+        frameScheduler->endPaint(this);
     }
 
 private:
@@ -1320,7 +1432,9 @@ private:
     juce::TextButton   btnLayout;
     juce::ToggleButton btnShowMixer;
 
-    // Smoothed VU meter levels (decay-based, updated per timer tick)
+    juce::SharedResourcePointer<UiFrameScheduler> frameScheduler;
+
+    // Smoothed VU meter levels (decay-based, updated per UI frame)
     // Indices: 0-5=CH1-CH6, kVuMasterL=MasterL, kVuMasterR=MasterR
     float vuSmoothed   [ProDJLink::kVuSlots] {};
     float vuSnapshotted[ProDJLink::kVuSlots] {};  // last-painted VU values for dirty check
@@ -1891,8 +2005,12 @@ private:
             float dw = imgW * scale, dh = imgH * scale;
             float dx = db.getX() + (db.getWidth() - dw) * 0.5f;
             float dy = db.getY() + (db.getHeight() - dh) * 0.5f;
-            g.drawImage(ds.cachedArtworkImg, (int)dx, (int)dy, (int)dw, (int)dh,
-                        0, 0, ds.cachedArtworkImg.getWidth(), ds.cachedArtworkImg.getHeight());
+            const float px = g.getInternalContext().getPhysicalPixelScaleFactor();
+            auto art = ds.scaledArtwork.get(ds.cachedArtworkImg,
+                                            juce::roundToInt((float)(int)dw * px),
+                                            juce::roundToInt((float)(int)dh * px));
+            g.drawImage(art, (int)dx, (int)dy, (int)dw, (int)dh,
+                        0, 0, art.getWidth(), art.getHeight());
             return;
         }
 
@@ -1986,6 +2104,9 @@ private:
     //==========================================================================
     void paintMixer(juce::Graphics& g, juce::Rectangle<int> area)
     {
+        const auto& pdl = proDJLink.getDisplaySnapshot();
+        const auto& mx = pdl.mixer;
+
         if (area.getWidth() < 20 || area.getHeight() < 40) return;
 
         auto af = area.toFloat();
@@ -1998,14 +2119,14 @@ private:
 
         // --- Header: DJM model ---
         auto headerRow = inner.removeFromTop(16);
-        juce::String djmModel = proDJLink.getDJMModel();
+        juce::String djmModel = mx.djmModel;
         if (djmModel.isEmpty()) djmModel = "DJM";
         g.setFont(juce::Font(juce::FontOptions(10.0f, juce::Font::bold)));
         g.setColour(textMid);
         g.drawText(djmModel, headerRow, juce::Justification::centred);
         inner.removeFromTop(4);
 
-        if (!proDJLink.hasMixerFaderData())
+        if (!mx.hasFaderData)
         {
             g.setColour(textDim);
             g.setFont(juce::Font(juce::FontOptions(9.0f)));
@@ -2019,7 +2140,7 @@ private:
         inner.removeFromBottom(juce::jmin(4, inner.getHeight()));
 
         // --- Channel strips: columns filling the remaining height ---
-        int numCh = proDJLink.getMixerChannelCount();
+        int numCh = mx.getChannelCount();
         int gap = 3;
         int totalW = inner.getWidth() - gap * (numCh - 1);
 
@@ -2029,14 +2150,14 @@ private:
             auto col = inner.removeFromLeft(colW);
             if (ch < numCh) inner.removeFromLeft(gap);
 
-            paintChannelStrip(g, col, ch);
+            paintChannelStrip(g, col, ch, pdl);
         }
 
         // --- Crossfader ---
         if (bottomSection.getHeight() > 30)
         {
             auto xfRow = bottomSection.removeFromTop(28);
-            paintCrossfader(g, xfRow.toFloat(), proDJLink.getCrossfader());
+            paintCrossfader(g, xfRow.toFloat(), mx.crossfader);
             bottomSection.removeFromTop(4);
         }
 
@@ -2053,7 +2174,7 @@ private:
             auto barArea = mstRow.removeFromTop(8).reduced(4, 0);
             g.setColour(juce::Colour(0xFF1A1D23));
             g.fillRoundedRectangle(barArea.toFloat(), 2.0f);
-            float mstPct = proDJLink.getMasterFader() / 255.0f;
+            float mstPct = mx.masterFader / 255.0f;
             auto fillBar = barArea.toFloat().withWidth(barArea.getWidth() * mstPct);
             g.setColour(accentAmber.withAlpha(0.7f));
             g.fillRoundedRectangle(fillBar, 2.0f);
@@ -2071,8 +2192,8 @@ private:
             auto infoRow = mstRow.removeFromTop(10);
             g.setFont(juce::Font(juce::FontOptions(7.0f)));
             g.setColour(textDim);
-            int boothPct = (int)std::round(proDJLink.getBoothLevel() / 255.0f * 100.0f);
-            int hpPct    = (int)std::round(proDJLink.getHpLevel() / 255.0f * 100.0f);
+            int boothPct = (int)std::round(mx.booth / 255.0f * 100.0f);
+            int hpPct    = (int)std::round(mx.hpLevel / 255.0f * 100.0f);
             g.drawText("BOOTH " + juce::String(boothPct) + "%  HP " + juce::String(hpPct) + "%",
                         infoRow, juce::Justification::centred);
 
@@ -2093,12 +2214,12 @@ private:
                 "SHIMMER","FLANGER","PHASER","FILTER","TRANS","ROLL",
                 "PITCH","V.BRAKE"
             };
-            DjmModel djmG = djmModelFromString(proDJLink.getDJMModel());
+            DjmModel djmG = djmModelFromString(juce::String(mx.djmModel));
             const char** fxNames = (djmG == DjmModel::V10Only) ? fxNamesV10
                                  : (djmG == DjmModel::A9Plus)  ? fxNamesA9
                                                                 : fxNames900;
-            int fxSel = proDJLink.getBeatFxSelect();
-            bool fxOn = proDJLink.getBeatFxOn() != 0;
+            int fxSel = mx.beatFxSelect;
+            bool fxOn = mx.beatFxOn != 0;
             juce::String fxStr = (fxSel >= 0 && fxSel < 14)
                 ? juce::String(fxNames[fxSel]) : "FX";
             g.setColour(fxOn ? accentCyan : textDim);
@@ -2110,10 +2231,13 @@ private:
     //==========================================================================
     // Single channel strip (vertical: label, trim, EQ, color, CUE, fader+VU, XF)
     //==========================================================================
-    void paintChannelStrip(juce::Graphics& g, juce::Rectangle<int> area, int ch)
+    void paintChannelStrip(juce::Graphics& g, juce::Rectangle<int> area, int ch,
+                           const ProDJLinkDisplaySnapshot& pdl)
     {
-        bool onAir = proDJLink.isPlayerOnAir(ch);
-        DjmModel djm = djmModelFromString(proDJLink.getDJMModel());
+        const auto& mx = pdl.mixer;
+        const int idx = ch - 1;
+        bool onAir = pdl.players[idx].onAir;
+        DjmModel djm = djmModelFromString(juce::String(mx.djmModel));
         bool isV10 = (djm == DjmModel::V10Only);
         bool hasDualCue = (djm >= DjmModel::A9Plus);  // A9 and V10 have CUE A/B
         juce::Colour chCol = onAir ? accentGreen : accentCyan;
@@ -2126,45 +2250,45 @@ private:
         area.removeFromTop(2);
 
         // --- Trim (small horizontal bar) ---
-        paintParamBar(g, area.removeFromTop(6), proDJLink.getChannelTrim(ch), textMid, "T");
+        paintParamBar(g, area.removeFromTop(6), mx.trim[idx], textMid, "T");
         area.removeFromTop(2);
 
         // --- Compressor (V10 only) ---
         if (isV10)
         {
-            paintParamBar(g, area.removeFromTop(6), proDJLink.getChannelComp(ch), accentCyan, "K");
+            paintParamBar(g, area.removeFromTop(6), mx.comp[idx], accentCyan, "K");
             area.removeFromTop(1);
         }
 
         // --- EQ HI / MID / LO (center-referenced bars) ---
         // V10 has 4-band EQ: Hi, Hi-Mid, Lo-Mid, Lo
-        paintEqBar(g, area.removeFromTop(6), proDJLink.getChannelEqHi(ch), accentAmber, "H");
+        paintEqBar(g, area.removeFromTop(6), mx.eqHi[idx], accentAmber, "H");
         area.removeFromTop(1);
-        paintEqBar(g, area.removeFromTop(6), proDJLink.getChannelEqMid(ch), accentAmber, isV10 ? "h" : "M");
+        paintEqBar(g, area.removeFromTop(6), mx.eqMid[idx], accentAmber, isV10 ? "h" : "M");
         area.removeFromTop(1);
         if (isV10)
         {
-            paintEqBar(g, area.removeFromTop(6), proDJLink.getChannelEqLoMid(ch), accentAmber, "l");
+            paintEqBar(g, area.removeFromTop(6), mx.eqLoMid[idx], accentAmber, "l");
             area.removeFromTop(1);
         }
-        paintEqBar(g, area.removeFromTop(6), proDJLink.getChannelEqLo(ch), accentAmber, "L");
+        paintEqBar(g, area.removeFromTop(6), mx.eqLo[idx], accentAmber, "L");
         area.removeFromTop(2);
 
         // --- Color knob (horizontal bar) ---
-        paintEqBar(g, area.removeFromTop(6), proDJLink.getChannelColor(ch), accentCyan, "C");
+        paintEqBar(g, area.removeFromTop(6), mx.color[idx], accentCyan, "C");
         area.removeFromTop(2);
 
         // --- Send knob (V10 only) ---
         if (isV10)
         {
-            paintParamBar(g, area.removeFromTop(6), proDJLink.getChannelSend(ch), accentGreen, "S");
+            paintParamBar(g, area.removeFromTop(6), mx.send[idx], accentGreen, "S");
             area.removeFromTop(2);
         }
 
         // --- CUE button(s) ---
         {
-            bool cue = proDJLink.getChannelCue(ch) != 0;
-            bool cueB = hasDualCue && proDJLink.getChannelCueB(ch) != 0;
+            bool cue = mx.cue[idx] != 0;
+            bool cueB = hasDualCue && mx.cueB[idx] != 0;
             auto cueRow = area.removeFromTop(10);
 
             if (hasDualCue)
@@ -2204,7 +2328,7 @@ private:
         if (area.getHeight() > 24)
         {
             auto xfRow = area.removeFromBottom(10);
-            uint8_t xfAssign = proDJLink.getChannelXfAssign(ch);
+            uint8_t xfAssign = mx.xfAssign[idx];
             {
                 juce::String xfLabel = (xfAssign == 1) ? "A" : (xfAssign == 2) ? "B" : "-";
                 juce::Colour xfCol = (xfAssign == 1) ? accentCyan
@@ -2219,7 +2343,7 @@ private:
         // --- Fader + VU (fills remaining height, skip if too small) ---
         if (area.getHeight() > 4)
         {
-            paintFader(g, area.toFloat(), proDJLink.getChannelFader(ch),
+            paintFader(g, area.toFloat(), mx.fader[idx],
                        "", chCol, vuSmoothed[ch - 1]);
         }
     }
@@ -2577,10 +2701,9 @@ public:
         setVisible(true);
         toFront(true);
 
-        // OpenGL context removed: see MainComponent constructor for rationale.
-        // With timerCallback() writing juce::String members (artist, title,
-        // playState, key...) on the message thread and paint() reading them on
-        // the GL thread, the concurrent access corrupts String refcounts.
+        // No OpenGL context by default: see MainComponent constructor.
+        // enableGpuCompositing() opts into GpuCompositor, which never paints
+        // on the GL thread.
     }
 
     ~ProDJLinkViewWindow() override = default;
@@ -2590,7 +2713,7 @@ public:
         // Save bounds before hiding
         if (onBoundsCapture) onBoundsCapture();
         if (auto* content = dynamic_cast<ProDJLinkViewComponent*>(getContentComponent()))
-            content->stopTimer();
+            content->stopUpdates();
         setVisible(false);
     }
 
@@ -2666,6 +2789,15 @@ public:
         return true;
     }
 
+    /// Composite the view through OpenGL (falls back to software on its own).
+    void enableGpuCompositing()
+    {
+        if (gpuCompositor == nullptr && getContentComponent() != nullptr)
+            gpuCompositor = std::make_unique<GpuCompositor>(*getContentComponent());
+    }
+
 private:
+    std::unique_ptr<GpuCompositor> gpuCompositor;   // destroyed before the content
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProDJLinkViewWindow)
 };
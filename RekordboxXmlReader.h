@@ -0,0 +1,390 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// RekordboxXmlReader -- Single-pass streaming reader for rekordbox XML.
+//
+// juce::XmlDocument builds a DOM of the whole DJ_PLAYLISTS export, which
+// for a large collection is hundreds of MB and seconds of parsing, even
+// when only one playlist is wanted.  This reader scans the file in fixed
+// 64 KB chunks and keeps only what the TrackMap import needs:
+//
+//   tracks    : COLLECTION/TRACK -- artist, title, duration, in file order
+//   trackById : TrackID -> index into tracks (compact id table)
+//   playlists : every playlist with entries, by folder path ("Shows /
+//               Saturday", ROOT omitted), with its TRACK Key list
+//
+// COLLECTION and PLAYLISTS are read in the same pass, in either order;
+// playlist keys are resolved against the id table afterwards.
+//
+// Tolerates what rekordbox writes: XML declaration, comments, single or
+// double quoted attributes, the five named entities and numeric character
+// references, UTF-8 text.  Not a validating parser -- anything it cannot
+// make sense of is skipped.
+//
+// Thread-safe in the sense of having no shared state: run it on any thread.
+
+#pragma once
+#include <JuceHeader.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdlib>
+#include <cstring>
+
+struct RekordboxLibrary
+{
+    struct Track
+    {
+        juce::String artist, title;
+        int durationSec = 0;
+    };
+
+    struct Playlist
+    {
+        juce::String path;             // "Folder / Playlist", ROOT omitted
+        std::vector<int32_t> trackIds; // TRACK Key attributes, playlist order
+    };
+
+    bool ok = false;                   // false: unreadable or not DJ_PLAYLISTS
+    std::vector<Track> tracks;
+    std::unordered_map<int32_t, uint32_t> trackById;
+    std::vector<Playlist> playlists;
+
+    juce::StringArray getPlaylistNames() const
+    {
+        juce::StringArray names;
+        for (auto& p : playlists) names.add(p.path);
+        return names;
+    }
+
+    int findPlaylist(const juce::String& path) const
+    {
+        for (int i = 0; i < (int)playlists.size(); ++i)
+            if (playlists[(size_t)i].path == path) return i;
+        return -1;
+    }
+
+    const Track* findTrack(int32_t id) const
+    {
+        auto it = trackById.find(id);
+        return it != trackById.end() ? &tracks[it->second] : nullptr;
+    }
+};
+
+class RekordboxXmlReader
+{
+public:
+    /// Progress 0-1 by bytes read; return false to cancel (result !ok).
+    using ProgressFn = std::function<bool(float)>;
+
+    static RekordboxLibrary read(const juce::File& file, ProgressFn progress = {})
+    {
+        RekordboxXmlReader reader;
+        juce::FileInputStream in(file);
+        if (!in.openedOk()) return {};
+
+        const double total = juce::jmax((juce::int64)1, in.getTotalLength());
+        juce::HeapBlock<char> chunk(kChunkSize);
+        juce::int64 done = 0;
+
+        while (!in.isExhausted())
+        {
+            const int n = in.read(chunk.get(), kChunkSize);
+            if (n <= 0) break;
+            if (!reader.feed(chunk.get(), n)) return {};
+            done += n;
+            if (progress && !progress((float)(done / total)))
+                return {};
+        }
+
+        if (!reader.sawRoot) return {};
+        reader.lib.ok = true;
+        return std::move(reader.lib);
+    }
+
+private:
+    static constexpr int kChunkSize = 64 * 1024;
+
+    enum class Kind : uint8_t { Other, Root, Collection, Playlists, Node, Track };
+
+    struct NodeFrame
+    {
+        juce::String name;
+        bool isFolder = false;
+        bool skipInPath = false;        // ROOT
+        int  playlistIndex = -1;        // collecting into lib.playlists[i]
+    };
+
+    //==========================================================================
+    // Tokenizer -- splits the byte stream into tags; text content is ignored
+    //==========================================================================
+    bool feed(const char* data, int size)
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            const char c = data[i];
+            if (!inTag)
+            {
+                if (c == '<') { inTag = true; tag.clear(); quote = 0; }
+                continue;
+            }
+
+            if (quote != 0)
+            {
+                if (c == quote) quote = 0;
+                tag.push_back(c);
+                continue;
+            }
+
+            if (c == '>')
+            {
+                // Comments / CDATA may contain '>': wait for their terminator
+                if (startsWith("!--") && !endsWith("--")) { tag.push_back(c); continue; }
+                if (startsWith("![CDATA[") && !endsWith("]]")) { tag.push_back(c); continue; }
+
+                inTag = false;
+                if (!handleTag()) return false;
+                continue;
+            }
+
+            if ((c == '"' || c == '\'') && !startsWith("!")) quote = c;
+            tag.push_back(c);
+        }
+        return true;
+    }
+
+    bool startsWith(const char* s) const { return tag.compare(0, std::strlen(s), s) == 0; }
+
+    bool endsWith(const char* s) const
+    {
+        const size_t n = std::strlen(s);
+        return tag.size() >= n && tag.compare(tag.size() - n, n, s) == 0;
+    }
+
+    //==========================================================================
+    // Elements
+    //==========================================================================
+    bool handleTag()
+    {
+        if (tag.empty() || tag[0] == '?' || tag[0] == '!') return true;
+
+        if (tag[0] == '/')
+        {
+            closeElement();
+            return true;
+        }
+
+        size_t nameEnd = 0;
+        while (nameEnd < tag.size() && !isSpace(tag[nameEnd]) && tag[nameEnd] != '/') ++nameEnd;
+        const bool selfClosing = tag.back() == '/';
+        const std::string name = tag.substr(0, nameEnd);
+
+        const Kind parent = stack.empty() ? Kind::Other : stack.back();
+        Kind kind = Kind::Other;
+
+        if (stack.empty())
+        {
+            if (name != "DJ_PLAYLISTS") return false;   // not a rekordbox export
+            sawRoot = true;
+            kind = Kind::Root;
+        }
+        else if (name == "COLLECTION" && parent == Kind::Root) kind = Kind::Collection;
+        else if (name == "PLAYLISTS"  && parent == Kind::Root) kind = Kind::Playlists;
+        else if (name == "TRACK" && parent == Kind::Collection)
+        {
+            kind = Kind::Track;
+            readCollectionTrack(nameEnd);
+        }
+        else if (name == "TRACK" && parent == Kind::Node)
+        {
+            kind = Kind::Track;
+            const int playlist = nodes.empty() ? -1 : nodes.back().playlistIndex;
+            if (playlist >= 0)
+            {
+                parseAttributes(nameEnd);
+                if (auto* key = attr("Key"))
+                    lib.playlists[(size_t)playlist].trackIds.push_back((int32_t)std::atoi(key->c_str()));
+            }
+        }
+        else if (name == "NODE" && (parent == Kind::Playlists || parent == Kind::Node))
+        {
+            kind = Kind::Node;
+            openNode(nameEnd);
+        }
+
+        if (selfClosing)
+        {
+            if (kind == Kind::Node) nodes.pop_back();
+        }
+        else
+        {
+            stack.push_back(kind);
+        }
+        return true;
+    }
+
+    void closeElement()
+    {
+        if (stack.empty()) return;
+        if (stack.back() == Kind::Node && !nodes.empty())
+            nodes.pop_back();
+        stack.pop_back();
+    }
+
+    void readCollectionTrack(size_t from)
+    {
+        parseAttributes(from);
+        auto* idStr = attr("TrackID");
+        auto* name  = attr("Name");
+        const int32_t id = idStr != nullptr ? (int32_t)std::atoi(idStr->c_str()) : 0;
+        if (id <= 0 || name == nullptr) return;
+
+        RekordboxLibrary::Track t;
+        t.title = juce::String::fromUTF8(name->data(), (int)name->size()).trim();
+        if (t.title.isEmpty()) return;
+        if (auto* artist = attr("Artist"))
+            t.artist = juce::String::fromUTF8(artist->data(), (int)artist->size()).trim();
+        if (auto* total = attr("TotalTime"))
+            t.durationSec = std::atoi(total->c_str());
+
+        auto [it, inserted] = lib.trackById.emplace(id, (uint32_t)lib.tracks.size());
+        if (inserted)
+            lib.tracks.push_back(std::move(t));
+        else
+            lib.tracks[it->second] = std::move(t);   // duplicate id: last one wins
+    }
+
+    void openNode(size_t from)
+    {
+        parseAttributes(from);
+        NodeFrame f;
+        if (auto* n = attr("Name"))
+            f.name = juce::String::fromUTF8(n->data(), (int)n->size());
+        const int type = attr("Type") != nullptr ? std::atoi(attr("Type")->c_str()) : -1;
+        f.isFolder = (type == 0);
+        f.skipInPath = f.isFolder && f.name.equalsIgnoreCase("ROOT");
+
+        if (type == 1)
+        {
+            const int entries = attr("Entries") != nullptr ? std::atoi(attr("Entries")->c_str()) : 0;
+            if (entries > 0)
+            {
+                RekordboxLibrary::Playlist p;
+                p.path = currentFolderPath();
+                p.path = p.path.isEmpty() ? f.name : p.path + " / " + f.name;
+                p.trackIds.reserve((size_t)entries);
+                f.playlistIndex = (int)lib.playlists.size();
+                lib.playlists.push_back(std::move(p));
+            }
+        }
+        nodes.push_back(std::move(f));
+    }
+
+    juce::String currentFolderPath() const
+    {
+        juce::String path;
+        for (auto& n : nodes)
+        {
+            if (!n.isFolder || n.skipInPath) continue;
+            path = path.isEmpty() ? n.name : path + " / " + n.name;
+        }
+        return path;
+    }
+
+    //==========================================================================
+    // Attributes -- name="value" pairs of the current tag, entity-decoded
+    //==========================================================================
+    void parseAttributes(size_t pos)
+    {
+        attrs.clear();
+        const size_t n = tag.size();
+        while (pos < n)
+        {
+            while (pos < n && (isSpace(tag[pos]) || tag[pos] == '/')) ++pos;
+            const size_t nameStart = pos;
+            while (pos < n && tag[pos] != '=' && !isSpace(tag[pos])) ++pos;
+            const size_t nameEnd = pos;
+            while (pos < n && isSpace(tag[pos])) ++pos;
+            if (pos >= n || tag[pos] != '=') break;
+            ++pos;
+            while (pos < n && isSpace(tag[pos])) ++pos;
+            if (pos >= n || (tag[pos] != '"' && tag[pos] != '\'')) break;
+            const char q = tag[pos++];
+            const size_t valueStart = pos;
+            while (pos < n && tag[pos] != q) ++pos;
+            attrs.emplace_back(tag.substr(nameStart, nameEnd - nameStart),
+                               decodeEntities(tag.substr(valueStart, pos - valueStart)));
+            ++pos;
+        }
+    }
+
+    const std::string* attr(const char* name) const
+    {
+        for (auto& [k, v] : attrs)
+            if (k == name) return &v;
+        return nullptr;
+    }
+
+    static std::string decodeEntities(std::string s)
+    {
+        if (s.find('&') == std::string::npos) return s;
+
+        std::string out;
+        out.reserve(s.size());
+        for (size_t i = 0; i < s.size(); ++i)
+        {
+            if (s[i] != '&') { out.push_back(s[i]); continue; }
+            const size_t semi = s.find(';', i);
+            if (semi == std::string::npos || semi - i > 10) { out.push_back(s[i]); continue; }
+
+            const std::string ent = s.substr(i + 1, semi - i - 1);
+            if      (ent == "amp")  out.push_back('&');
+            else if (ent == "lt")   out.push_back('<');
+            else if (ent == "gt")   out.push_back('>');
+            else if (ent == "quot") out.push_back('"');
+            else if (ent == "apos") out.push_back('\'');
+            else if (!ent.empty() && ent[0] == '#')
+            {
+                const bool hex = ent.size() > 1 && (ent[1] == 'x' || ent[1] == 'X');
+                const auto cp = (uint32_t)std::strtoul(ent.c_str() + (hex ? 2 : 1), nullptr, hex ? 16 : 10);
+                appendUtf8(out, cp);
+            }
+            else
+            {
+                out.append(s, i, semi - i + 1);   // unknown entity: keep as is
+            }
+            i = semi;
+        }
+        return out;
+    }
+
+    static void appendUtf8(std::string& out, uint32_t cp)
+    {
+        if (cp < 0x80)         { out.push_back((char)cp); }
+        else if (cp < 0x800)   { out.push_back((char)(0xC0 | (cp >> 6)));
+                                 out.push_back((char)(0x80 | (cp & 0x3F))); }
+        else if (cp < 0x10000) { out.push_back((char)(0xE0 | (cp >> 12)));
+                                 out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+                                 out.push_back((char)(0x80 | (cp & 0x3F))); }
+        else if (cp < 0x110000){ out.push_back((char)(0xF0 | (cp >> 18)));
+                                 out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+                                 out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+                                 out.push_back((char)(0x80 | (cp & 0x3F))); }
+    }
+
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    //==========================================================================
+    RekordboxLibrary lib;
+    bool sawRoot = false;
+
+    bool inTag = false;
+    char quote = 0;
+    std::string tag;                   // current tag text between '<' and '>'
+    std::vector<std::pair<std::string, std::string>> attrs;
+
+    std::vector<Kind> stack;           // open elements
+    std::vector<NodeFrame> nodes;      // open PLAYLISTS NODEs
+};
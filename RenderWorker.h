@@ -0,0 +1,177 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// RenderWorker -- Background thread for UI rasterisation.
+//
+// The message thread also drives the engines' 60Hz tick, so anything slow
+// in paint() (waveform tiles, pyramid builds, high-quality artwork scaling)
+// delays timecode output and input handling.  Work posted here runs on one
+// shared background thread; the result is handed back on the message
+// thread, where the caller only stores it and composites.
+//
+// Users hold a juce::SharedResourcePointer<RenderWorker>, so the thread
+// lives while any renderer exists and stops with the last one.
+//
+// Work must only touch immutable data it owns (snapshots held by
+// shared_ptr, juce::Image copies).  Callers tag requests with a generation
+// number and drop results that come back for an older one.
+//
+// Images produced here are SoftwareImageType so they can be drawn into on
+// any thread.
+//
+// ScaledImageCache: one pre-scaled variant of an image at the exact
+// physical size it's drawn at, rescaled on the worker with high-quality
+// resampling.  paint() blits the variant 1:1 once ready and draws the
+// source scaled (as before) until then.
+
+#pragma once
+#include <JuceHeader.h>
+#include <deque>
+#include <memory>
+#include <functional>
+
+class RenderWorker : private juce::Thread
+{
+public:
+    RenderWorker() : Thread("Render Worker") { startThread(); }
+
+    ~RenderWorker() override
+    {
+        signalThreadShouldExit();
+        wake.signal();
+        stopThread(2000);
+    }
+
+    /// Run `work` on the worker, then `done` with its result on the message
+    /// thread.  Any thread may post.
+    template <typename Result>
+    void post(std::function<Result()> work, std::function<void(Result)> done)
+    {
+        enqueue([work = std::move(work), done = std::move(done)]() mutable
+        {
+            auto result = work();
+            juce::MessageManager::callAsync([done = std::move(done), result = std::move(result)]() mutable
+            {
+                if (done) done(std::move(result));
+            });
+        });
+    }
+
+    /// Software image that is safe to render into off the message thread.
+    static juce::Image createImage(int w, int h)
+    {
+        return juce::Image(juce::Image::ARGB, juce::jmax(1, w), juce::jmax(1, h), true,
+                           juce::SoftwareImageType());
+    }
+
+private:
+    void enqueue(std::function<void()> job)
+    {
+        {
+            const juce::ScopedLock sl(queueLock);
+            jobs.push_back(std::move(job));
+        }
+        wake.signal();
+    }
+
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            std::function<void()> job;
+            {
+                const juce::ScopedLock sl(queueLock);
+                if (!jobs.empty())
+                {
+                    job = std::move(jobs.front());
+                    jobs.pop_front();
+                }
+            }
+
+            if (job)
+                job();
+            else
+                wake.wait(500);
+        }
+    }
+
+    juce::CriticalSection queueLock;
+    std::deque<std::function<void()>> jobs;
+    juce::WaitableEvent wake;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderWorker)
+};
+
+//==============================================================================
+class ScaledImageCache
+{
+public:
+    ScaledImageCache() = default;
+
+    /// Called on the message thread when a new variant is ready (repaint).
+    std::function<void()> onReady;
+
+    /// The variant of `source` at w x h physical pixels if ready, otherwise
+    /// queues the rescale and returns `source` itself.  Message thread only.
+    juce::Image get(const juce::Image& source, int w, int h)
+    {
+        if (!source.isValid() || w <= 0 || h <= 0)
+            return source;
+
+        if (state->source == source && state->width == w && state->height == h)
+            return state->variant.isValid() ? state->variant : source;
+
+        state->source  = source;
+        state->width   = w;
+        state->height  = h;
+        state->variant = {};
+        const uint32_t gen = ++state->generation;
+
+        // Decoded artwork is a NativeImageType (Direct2D / CoreGraphics), which
+        // must not be read off the message thread while paint() uses it: hand
+        // the worker a software copy (no copy when it already is one).
+        auto pixels = juce::SoftwareImageType().convert(source);
+
+        std::weak_ptr<State> weak = state;
+        renderWorker->post<juce::Image>(
+            [pixels, w, h]
+            {
+                auto out = RenderWorker::createImage(w, h);
+                juce::Graphics g(out);
+                g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
+                g.drawImage(pixels, 0, 0, w, h, 0, 0, pixels.getWidth(), pixels.getHeight());
+                return out;
+            },
+            [weak, gen, this](juce::Image img)
+            {
+                // The State dies with this cache, so a live State means a
+                // live `this` (both only touched on the message thread)
+                auto s = weak.lock();
+                if (s == nullptr || s->generation != gen) return;
+                s->variant = std::move(img);
+                if (onReady) onReady();
+            });
+        return source;
+    }
+
+    void clear()
+    {
+        state->source = {};
+        state->variant = {};
+        state->width = state->height = 0;
+        ++state->generation;
+    }
+
+private:
+    struct State
+    {
+        juce::Image source, variant;
+        int width = 0, height = 0;
+        uint32_t generation = 0;
+    };
+    std::shared_ptr<State> state = std::make_shared<State>();
+    juce::SharedResourcePointer<RenderWorker> renderWorker;
+
+    JUCE_DECLARE_NON_COPYABLE(ScaledImageCache)
+};
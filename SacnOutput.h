@@ -0,0 +1,383 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+
+#pragma once
+#include <JuceHeader.h>
+#include "NetworkUtils.h"
+#include <array>
+#include <atomic>
+#include <map>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+#endif
+
+//==============================================================================
+// SacnOutput -- streaming ACN (ANSI E1.31) DMX output.
+//
+// Counterpart of ArtnetOutput::sendDmxFrame() for sACN-native consoles and
+// fixtures.  The engine feeds both from the same DMX buffers and the same
+// Art-Net port-address; sACN universe = port-address + 1 (Art-Net 0:0:0 is
+// sACN universe 1, the usual console convention).
+//
+// Each universe goes to its own multicast group 239.255.<hi>.<lo> on port
+// 5568, so only receivers that joined the group see the traffic -- unlike
+// Art-Net subnet broadcast.  Per-universe sequence numbers, configurable
+// priority (0-200, default 100) and optional universe synchronisation: when
+// a sync universe is set, data packets carry its address and receivers
+// hold the new look until the sync packet endFrame() sends once per tick,
+// after every universe of that tick.
+//
+// Receivers drop a source after 2.5s without data (E1.31 6.7.1), so
+// endFrame() also resends the last frame of every universe that has been
+// idle for kKeepAliveMs (the 800-1000ms rate 6.6.2 allows for unchanged
+// data) -- trigger universes only change when a trigger fires.
+//
+// stop() sends the three Stream_Terminated packets per active universe
+// (E1.31 6.2.6) so receivers release the source immediately instead of
+// waiting for the 2.5s data-loss timeout.
+//
+// Message thread only (called from the engine tick, like sendDmxFrame).
+//==============================================================================
+class SacnOutput
+{
+public:
+    static constexpr int kPort            = 5568;
+    static constexpr int kMinUniverse     = 1;
+    static constexpr int kMaxUniverse     = 63999;
+    static constexpr int kDefaultPriority = 100;
+    static constexpr int kMaxPriority     = 200;
+    static constexpr double kKeepAliveMs  = 800.0;
+
+    SacnOutput()
+    {
+        refreshNetworkInterfaces();
+        setSourceName("Super Timecode Converter");
+    }
+
+    ~SacnOutput() { stop(); }
+
+    //==============================================================================
+    void refreshNetworkInterfaces()
+    {
+        availableInterfaces = ::getNetworkInterfaces();
+    }
+
+    /// Art-Net port-address (0-32767) -> sACN universe (1-63999).
+    static int universeFromArtnet(int portAddress)
+    {
+        return juce::jlimit(kMinUniverse, kMaxUniverse, portAddress + 1);
+    }
+
+    /// Multicast group of a universe: 239.255.<hi>.<lo>
+    static juce::String multicastAddress(int universe)
+    {
+        return "239.255." + juce::String((universe >> 8) & 0xFF) + "." + juce::String(universe & 0xFF);
+    }
+
+    //==============================================================================
+    /// interfaceIndex: -1 = let the OS route multicast, 0+ = specific NIC.
+    bool start(int interfaceIndex = -1)
+    {
+        stop();
+
+        if (interfaceIndex >= 0 && interfaceIndex < availableInterfaces.size())
+        {
+            selectedInterface = interfaceIndex;
+            bindIp = availableInterfaces[interfaceIndex].ip;
+        }
+        else
+        {
+            selectedInterface = -1;
+            bindIp = "0.0.0.0";
+        }
+
+        socket = std::make_unique<juce::DatagramSocket>(false);
+
+        if (!socket->bindToPort(0, bindIp))
+        {
+            if (!socket->bindToPort(0))
+            {
+                socket = nullptr;
+                return false;
+            }
+        }
+
+        // Loopback so a visualiser on the same machine sees the stream
+        socket->setMulticastLoopbackEnabled(true);
+
+        auto rawSock = socket->getRawSocketHandle();
+        if (rawSock >= 0)
+        {
+            int ttl = kMulticastTtl;
+#ifdef _WIN32
+            setsockopt(rawSock, IPPROTO_IP, IP_MULTICAST_TTL, (const char*)&ttl, sizeof(ttl));
+#else
+            setsockopt(rawSock, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+#endif
+            // Pin multicast egress to the selected NIC; otherwise the OS
+            // picks the default route, which is rarely the lighting network.
+            if (selectedInterface >= 0)
+            {
+                in_addr ifAddr {};
+                if (inet_pton(AF_INET, bindIp.toRawUTF8(), &ifAddr) == 1)
+                {
+#ifdef _WIN32
+                    setsockopt(rawSock, IPPROTO_IP, IP_MULTICAST_IF, (const char*)&ifAddr, sizeof(ifAddr));
+#else
+                    setsockopt(rawSock, IPPROTO_IP, IP_MULTICAST_IF, &ifAddr, sizeof(ifAddr));
+#endif
+                }
+            }
+        }
+
+        universes.clear();
+        syncSequence = 0;
+        syncPending = false;
+        sendErrors.store(0, std::memory_order_relaxed);
+        isRunningFlag.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    void stop()
+    {
+        if (socket != nullptr && isRunningFlag.load(std::memory_order_relaxed))
+            sendStreamTerminated();
+
+        isRunningFlag.store(false, std::memory_order_relaxed);
+        universes.clear();
+
+        if (socket != nullptr)
+        {
+            socket->shutdown();
+            socket = nullptr;
+        }
+    }
+
+    bool getIsRunning() const { return isRunningFlag.load(std::memory_order_relaxed); }
+    int getSelectedInterface() const { return selectedInterface; }
+    juce::String getBindIp() const { return bindIp; }
+    uint32_t getSendErrors() const { return sendErrors.load(std::memory_order_relaxed); }
+    uint32_t getPacketsSent() const { return packetsSent.load(std::memory_order_relaxed); }
+
+    //==============================================================================
+    void setPriority(int p) { priority = (uint8_t)juce::jlimit(0, kMaxPriority, p); }
+    int  getPriority() const { return priority; }
+
+    /// 0 = no synchronisation, 1-63999 = sync universe.
+    void setSyncUniverse(int u) { syncUniverse = (u <= 0) ? 0 : juce::jlimit(kMinUniverse, kMaxUniverse, u); }
+    int  getSyncUniverse() const { return syncUniverse; }
+
+    /// Source name shown by consoles/analysers.  The CID (component
+    /// identifier) is derived from it and the computer name so it stays
+    /// stable across restarts -- receivers track sources by CID.
+    void setSourceName(const juce::String& name)
+    {
+        std::memset(sourceName, 0, sizeof(sourceName));
+        auto utf8 = name.toRawUTF8();
+        std::memcpy(sourceName, utf8, juce::jmin(std::strlen(utf8), sizeof(sourceName) - 1));
+
+        auto seed = "STC/sACN/" + juce::SystemStats::getComputerName() + "/" + name;
+        auto digest = juce::MD5(seed.toUTF8()).getRawChecksumData();
+        std::memcpy(cid, digest.getData(), juce::jmin(sizeof(cid), digest.getSize()));
+        cid[6] = (uint8_t)((cid[6] & 0x0F) | 0x30);   // RFC 4122 version 3 (name-based, MD5)
+        cid[8] = (uint8_t)((cid[8] & 0x3F) | 0x80);   // RFC 4122 variant
+    }
+
+    //==============================================================================
+    /// Send one DMX512 frame (start code 0) to `universe` (1-63999).
+    /// dmxData: channel 1 at index 0; numChannels 1-512.
+    void sendDmxFrame(const uint8_t* dmxData, int numChannels, int universe)
+    {
+        if (!isRunningFlag.load(std::memory_order_relaxed) || socket == nullptr)
+            return;
+
+        numChannels = juce::jlimit(1, 512, numChannels);
+        universe = juce::jlimit(kMinUniverse, kMaxUniverse, universe);
+
+        auto& u = universes[universe];
+        u.lastLength = numChannels;
+        if (dmxData != nullptr)
+            std::memcpy(u.data.data(), dmxData, (size_t)numChannels);
+        else
+            std::memset(u.data.data(), 0, (size_t)numChannels);
+        sendData(universe, u);
+    }
+
+    /// Call once per engine tick, after every sendDmxFrame() of the tick:
+    /// resends idle universes (keep-alive), then one sync packet covering
+    /// everything sent since the last call.
+    void endFrame()
+    {
+        if (!isRunningFlag.load(std::memory_order_relaxed) || socket == nullptr)
+            return;
+
+        const double now = juce::Time::getMillisecondCounterHiRes();
+        for (auto& [universe, u] : universes)
+            if (now - u.lastSendMs >= kKeepAliveMs)
+                sendData(universe, u);
+
+        if (syncUniverse > 0 && syncPending)
+            sendSync();
+        syncPending = false;
+    }
+
+private:
+    static constexpr int kDataHeaderSize = 126;
+    static constexpr int kSyncPacketSize = 49;
+    static constexpr int kMulticastTtl   = 8;
+
+    static constexpr uint8_t kOptionTerminated = 0x40;
+
+    struct UniverseState
+    {
+        uint8_t sequence   = 0;
+        int     lastLength = 0;
+        double  lastSendMs = 0.0;
+        std::array<uint8_t, 512> data {};   // last frame, for keep-alive resends
+    };
+
+    void sendData(int universe, UniverseState& u)
+    {
+        uint8_t packet[kDataHeaderSize + 512];
+        const int len = buildDataPacket(packet, u.data.data(), u.lastLength, universe, u.sequence++, 0);
+        write(multicastAddress(universe), packet, len);
+        u.lastSendMs = juce::Time::getMillisecondCounterHiRes();
+        syncPending = true;
+    }
+
+    //==============================================================================
+    /// E1.31 data packet: root layer (0-37), framing layer (38-114),
+    /// DMP layer (115-125), then start code + slots.  Returns the length.
+    int buildDataPacket(uint8_t* p, const uint8_t* dmxData, int numChannels,
+                        int universe, uint8_t sequence, uint8_t options) const
+    {
+        const int total = kDataHeaderSize + numChannels;
+        std::memset(p, 0, (size_t)kDataHeaderSize);
+
+        writeRootLayer(p, total, kVectorRootData);
+
+        // Framing layer
+        writeFlagsLength(p + 38, total - 38);
+        writeBE32(p + 40, kVectorFramingData);
+        std::memcpy(p + 44, sourceName, sizeof(sourceName));
+        p[108] = priority;
+        writeBE16(p + 109, (uint16_t)syncUniverse);
+        p[111] = sequence;
+        p[112] = options;
+        writeBE16(p + 113, (uint16_t)universe);
+
+        // DMP layer
+        writeFlagsLength(p + 115, total - 115);
+        p[117] = 0x02;                                  // VECTOR_DMP_SET_PROPERTY
+        p[118] = 0xA1;                                  // address & data type
+        writeBE16(p + 119, 0);                          // first property address
+        writeBE16(p + 121, 1);                          // address increment
+        writeBE16(p + 123, (uint16_t)(numChannels + 1));// property count incl. start code
+        p[125] = 0;                                     // DMX512 start code
+
+        if (dmxData != nullptr)
+            std::memcpy(p + kDataHeaderSize, dmxData, (size_t)numChannels);
+        else
+            std::memset(p + kDataHeaderSize, 0, (size_t)numChannels);
+
+        return total;
+    }
+
+    void sendSync()
+    {
+        uint8_t p[kSyncPacketSize] = {};
+        writeRootLayer(p, kSyncPacketSize, kVectorRootExtended);
+        writeFlagsLength(p + 38, kSyncPacketSize - 38);
+        writeBE32(p + 40, kVectorExtendedSync);
+        p[44] = syncSequence++;
+        writeBE16(p + 45, (uint16_t)syncUniverse);
+        // 47-48 reserved
+
+        write(multicastAddress(syncUniverse), p, kSyncPacketSize);
+    }
+
+    void sendStreamTerminated()
+    {
+        uint8_t packet[kDataHeaderSize + 512];
+        for (auto& [universe, u] : universes)
+        {
+            const int n = juce::jmax(1, u.lastLength);
+            for (int i = 0; i < 3; ++i)
+            {
+                const int len = buildDataPacket(packet, nullptr, n, universe, u.sequence++, kOptionTerminated);
+                write(multicastAddress(universe), packet, len);
+            }
+        }
+    }
+
+    void writeRootLayer(uint8_t* p, int total, uint32_t vector) const
+    {
+        writeBE16(p + 0, 0x0010);                       // preamble size
+        writeBE16(p + 2, 0x0000);                       // postamble size
+        std::memcpy(p + 4, "ASC-E1.17\0\0\0", 12);      // ACN packet identifier
+        writeFlagsLength(p + 16, total - 16);
+        writeBE32(p + 18, vector);
+        std::memcpy(p + 22, cid, sizeof(cid));
+    }
+
+    void write(const juce::String& ip, const uint8_t* data, int len)
+    {
+        int written = socket->write(ip, kPort, data, len);
+        if (written < 0)
+            sendErrors.fetch_add(1, std::memory_order_relaxed);
+        else
+            packetsSent.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void writeFlagsLength(uint8_t* p, int length)
+    {
+        writeBE16(p, (uint16_t)(0x7000 | (length & 0x0FFF)));
+    }
+
+    static void writeBE16(uint8_t* p, uint16_t v)
+    {
+        p[0] = (uint8_t)(v >> 8);
+        p[1] = (uint8_t)(v & 0xFF);
+    }
+
+    static void writeBE32(uint8_t* p, uint32_t v)
+    {
+        p[0] = (uint8_t)((v >> 24) & 0xFF);
+        p[1] = (uint8_t)((v >> 16) & 0xFF);
+        p[2] = (uint8_t)((v >> 8)  & 0xFF);
+        p[3] = (uint8_t)(v & 0xFF);
+    }
+
+    static constexpr uint32_t kVectorRootData     = 0x00000004;
+    static constexpr uint32_t kVectorRootExtended = 0x00000008;
+    static constexpr uint32_t kVectorFramingData  = 0x00000002;
+    static constexpr uint32_t kVectorExtendedSync = 0x00000001;
+
+    //==============================================================================
+    std::unique_ptr<juce::DatagramSocket> socket;
+    juce::String bindIp = "0.0.0.0";
+    int selectedInterface = -1;
+    std::atomic<bool> isRunningFlag { false };
+    std::atomic<uint32_t> sendErrors { 0 };
+    std::atomic<uint32_t> packetsSent { 0 };
+
+    juce::Array<NetworkInterface> availableInterfaces;
+
+    std::map<int, UniverseState> universes;   // active universes (sequence, last frame)
+    uint8_t  priority     = (uint8_t)kDefaultPriority;
+    int      syncUniverse = 0;
+    uint8_t  syncSequence = 0;
+    bool     syncPending = false;              // data sent since the last sync
+    char     sourceName[64] {};
+    uint8_t  cid[16] {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SacnOutput)
+};
@@ -0,0 +1,147 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// SettingsWriter -- Writes JSON settings files on a background thread.
+//
+// MainComponent already coalesces saveSettings() calls (kSaveDelayTicks),
+// but the flush itself used to run juce::JSON::toString and a synchronous
+// file replace on the message thread, i.e. during a show.  Now the message
+// thread only builds the juce::var tree and hands it over:
+//
+//   writer->write(file, snapshot);   // returns immediately
+//
+// One pending snapshot per file: a newer write replaces one that has not
+// been written yet, so a burst of saves costs one write.  The worker
+// serialises it and replaces the file atomically (temporary file, flush to
+// disk, rename), so a crash leaves either the old or the new file.
+//
+// The var tree must not be touched after write() -- build a fresh one per
+// save (AppSettings::save does).  flush() blocks until everything queued
+// has been written; the destructor flushes too, so nothing is lost at
+// shutdown.  suspend() / resume() bracket a restore that replaces the
+// files on disk: writes in between are dropped, since they would carry
+// the state the restore is replacing.
+//
+// Held through juce::SharedResourcePointer<SettingsWriter>.
+
+#pragma once
+#include <JuceHeader.h>
+#include <map>
+
+class SettingsWriter : private juce::Thread
+{
+public:
+    SettingsWriter() : Thread("Settings Writer") { startThread(); }
+
+    ~SettingsWriter() override
+    {
+        flush();
+        signalThreadShouldExit();
+        wake.signal();
+        stopThread(5000);
+    }
+
+    /// Queue `snapshot` to be written to `file` as JSON.  Any thread.
+    void write(const juce::File& file, juce::var snapshot)
+    {
+        {
+            const juce::ScopedLock sl(lock);
+            if (suspendCount > 0) return;
+            pending[file.getFullPathName()] = { file, std::move(snapshot) };
+        }
+        wake.signal();
+    }
+
+    /// Blocks until every queued snapshot has been written.
+    void flush()
+    {
+        for (;;)
+        {
+            {
+                const juce::ScopedLock sl(lock);
+                if (pending.empty() && !writing) return;
+            }
+            wake.signal();
+            idle.wait(50);
+        }
+    }
+
+    /// Drops every write() until resume(); returns once the writes queued
+    /// before the call are on disk.
+    void suspend()
+    {
+        {
+            const juce::ScopedLock sl(lock);
+            ++suspendCount;
+        }
+        flush();
+    }
+
+    void resume()
+    {
+        const juce::ScopedLock sl(lock);
+        suspendCount = juce::jmax(0, suspendCount - 1);
+    }
+
+    /// Atomic JSON file replace: temporary file, flushed to disk, renamed.
+    static bool writeJsonFile(const juce::File& file, const juce::var& snapshot)
+    {
+        juce::TemporaryFile temp(file);
+        {
+            juce::FileOutputStream out(temp.getFile());
+            if (!out.openedOk()) return false;
+            out << juce::JSON::toString(snapshot);
+            out.flush();
+            if (!out.getStatus().wasOk()) return false;
+        }
+        return temp.overwriteTargetFileWithTemporary();
+    }
+
+private:
+    struct Job
+    {
+        juce::File file;
+        juce::var snapshot;
+    };
+
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            Job job;
+            bool have = false;
+            {
+                const juce::ScopedLock sl(lock);
+                if (!pending.empty())
+                {
+                    job = std::move(pending.begin()->second);
+                    pending.erase(pending.begin());
+                    writing = have = true;
+                }
+            }
+
+            if (!have)
+            {
+                idle.signal();
+                wake.wait(-1);
+                continue;
+            }
+
+            if (!writeJsonFile(job.file, job.snapshot))
+                DBG("SettingsWriter: failed to write " << job.file.getFullPathName());
+
+            const juce::ScopedLock sl(lock);
+            writing = false;
+        }
+        idle.signal();
+    }
+
+    juce::CriticalSection lock;
+    std::map<juce::String, Job> pending;   // by full path
+    bool writing = false;
+    int suspendCount = 0;
+    juce::WaitableEvent wake, idle;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SettingsWriter)
+};
@@ -0,0 +1,460 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// ShowPackage -- Streamed zip archive for moving a whole show between
+// machines: configuration files plus the cached waveforms / artwork /
+// ANLZ data of the mapped tracks (see AppSettings::collectShowPackage).
+//
+// The file is a plain zip (stored or raw-deflate entries, no zip64), so
+// any unzip tool can inspect it and juce::ZipFile reads it back.
+//
+// Writing (ShowPackageWriter):
+//   - File entries are read and compressed on a thread pool; the calling
+//     thread writes finished entries in the order they were added.  At most
+//     kMaxBytesInFlight of source data (and 4 entries per worker) are
+//     pending, so memory stays bounded however many files are packed.
+//   - JSON entries are serialised straight into the deflate stream on the
+//     calling thread (sizes and CRC follow in a data descriptor).
+//   - Everything goes to a temporary file that only replaces the target
+//     in finish(); a cancelled or failed export leaves no partial package.
+//
+// Reading (ShowPackageReader):
+//   - juce::ZipFile keeps just the central directory in memory; entries
+//     are streamed out one buffer at a time.
+//   - extractAll() unpacks a directory of entries in parallel (every entry
+//     stream opens its own file handle) -- used to pre-warm the waveform
+//     cache on restore.
+//
+// ShowPackageJob runs either side under a progress window.
+
+#pragma once
+#include <JuceHeader.h>
+#include <deque>
+#include <array>
+#include <memory>
+#include <atomic>
+#include <functional>
+
+/// Progress 0..1; return false to cancel
+using ShowPackageProgressFn = std::function<bool(float)>;
+
+//==============================================================================
+class ShowPackageWriter
+{
+public:
+    static constexpr size_t kMaxBytesInFlight = 64 * 1024 * 1024;
+
+    explicit ShowPackageWriter(const juce::File& targetFile)
+        : temp(std::make_unique<juce::TemporaryFile>(targetFile)),
+          out(std::make_unique<juce::FileOutputStream>(temp->getFile())),
+          pool(juce::jlimit(1, 8, juce::SystemStats::getNumCpus() - 1))
+    {
+        ok = out->openedOk();
+    }
+
+    ~ShowPackageWriter()
+    {
+        pool.removeAllJobs(true, 10000);
+    }
+
+    bool isOk() const { return ok; }
+
+    /// Queues `source` to be packed as `name`.  Already-compressed formats
+    /// (PNG, JPEG) are stored, everything else deflated.
+    void addFile(const juce::String& name, const juce::File& source)
+    {
+        if (!ok) return;
+
+        auto job = std::make_shared<FileJob>();
+        job->name = name;
+        job->source = source;
+        job->deflate = !source.hasFileExtension("png;jpg;jpeg");
+        job->sourceBytes = (size_t)juce::jmax((juce::int64)0, source.getSize());
+
+        bytesInFlight += job->sourceBytes;
+        pending.push_back(job);
+        pool.addJob([job] { job->run(); });
+
+        const size_t maxJobs = (size_t)pool.getNumThreads() * 4;
+        while (!pending.empty() && (bytesInFlight > kMaxBytesInFlight || pending.size() > maxJobs))
+            writeOldest();
+    }
+
+    /// Writes `json` as `name`, serialised straight into the archive.
+    void addJson(const juce::String& name, const juce::var& json)
+    {
+        drain();   // keep entries in the order they were added
+        if (!ok) return;
+
+        Entry e = beginEntry(name, 8, true);
+        CrcCountingStream raw(*out);
+        {
+            juce::GZIPCompressorOutputStream deflater(raw, 6, juce::GZIPCompressorOutputStream::windowBitsRaw);
+            CrcCountingStream plain(deflater);
+            juce::JSON::writeToStream(plain, json);
+            plain.flush();
+            e.crc = plain.getCrc();
+            e.rawSize = plain.getCount();
+        }
+        e.storedSize = raw.getCount();
+
+        // Data descriptor
+        out->writeInt((int)0x08074b50);
+        out->writeInt((int)e.crc);
+        out->writeInt((int)e.storedSize);
+        out->writeInt((int)e.rawSize);
+        finishEntry(std::move(e));
+    }
+
+    /// Writes the remaining entries and the central directory, then moves
+    /// the archive into place.  False if anything failed.
+    bool finish()
+    {
+        drain();
+        if (!ok) return false;
+
+        const auto dirStart = (uint64_t)out->getPosition();
+        for (auto& e : entries)
+        {
+            out->writeInt((int)0x02014b50);
+            out->writeShort(20);                     // version made by
+            out->writeShort(20);                     // version needed
+            out->writeShort((short)e.flags);
+            out->writeShort((short)e.method);
+            writeDosTime();
+            out->writeInt((int)e.crc);
+            out->writeInt((int)e.storedSize);
+            out->writeInt((int)e.rawSize);
+            out->writeShort((short)e.name.getNumBytesAsUTF8());
+            out->writeShort(0);                      // extra
+            out->writeShort(0);                      // comment
+            out->writeShort(0);                      // disk
+            out->writeShort(0);                      // internal attributes
+            out->writeInt(0);                        // external attributes
+            out->writeInt((int)e.headerOffset);
+            out->write(e.name.toRawUTF8(), e.name.getNumBytesAsUTF8());
+        }
+        const auto dirSize = (uint64_t)out->getPosition() - dirStart;
+
+        out->writeInt((int)0x06054b50);
+        out->writeShort(0);
+        out->writeShort(0);
+        out->writeShort((short)entries.size());
+        out->writeShort((short)entries.size());
+        out->writeInt((int)dirSize);
+        out->writeInt((int)dirStart);
+        out->writeShort(0);
+
+        if (entries.size() > 0xFFFF || (uint64_t)out->getPosition() > 0xFFFFFFFFull)
+            ok = false;   // would need zip64
+
+        out->flush();
+        ok = ok && out->getStatus().wasOk();
+        out.reset();   // closed before the rename
+        return ok && temp->overwriteTargetFileWithTemporary();
+    }
+
+    int getNumEntries() const { return (int)entries.size(); }
+
+    static uint32_t crc32(uint32_t crc, const void* data, size_t size)
+    {
+        static const auto table = []
+        {
+            std::array<uint32_t, 256> t {};
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k)
+                    c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+                t[i] = c;
+            }
+            return t;
+        }();
+
+        const auto* p = static_cast<const uint8_t*>(data);
+        crc = ~crc;
+        for (size_t i = 0; i < size; ++i)
+            crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+private:
+    struct Entry
+    {
+        juce::String name;
+        int method = 0;            // 0 = stored, 8 = deflate
+        int flags = 0;
+        uint32_t crc = 0;
+        uint64_t rawSize = 0, storedSize = 0, headerOffset = 0;
+    };
+
+    /// One file read + compressed on the pool
+    struct FileJob
+    {
+        juce::String name;
+        juce::File source;
+        bool deflate = true;
+        size_t sourceBytes = 0;
+
+        juce::MemoryBlock data;    // stored bytes (compressed if deflate)
+        uint32_t crc = 0;
+        uint64_t rawSize = 0;
+        bool readOk = false;
+        juce::WaitableEvent done { true };
+
+        void run()
+        {
+            juce::MemoryBlock raw;
+            if (source.loadFileAsData(raw))
+            {
+                rawSize = raw.getSize();
+                crc = crc32(0, raw.getData(), raw.getSize());
+                if (deflate)
+                {
+                    juce::MemoryOutputStream compressed(data, false);
+                    juce::GZIPCompressorOutputStream z(compressed, 6, juce::GZIPCompressorOutputStream::windowBitsRaw);
+                    z.write(raw.getData(), raw.getSize());
+                    z.flush();
+                }
+                else
+                {
+                    data = std::move(raw);
+                }
+                readOk = true;
+            }
+            done.signal();
+        }
+    };
+
+    /// Pass-through stream that counts bytes and CRCs them
+    class CrcCountingStream : public juce::OutputStream
+    {
+    public:
+        explicit CrcCountingStream(juce::OutputStream& d) : dest(d) {}
+        void flush() override                 { dest.flush(); }
+        bool setPosition(juce::int64) override { return false; }
+        juce::int64 getPosition() override    { return (juce::int64)count; }
+        bool write(const void* data, size_t size) override
+        {
+            crc = crc32(crc, data, size);
+            count += size;
+            return dest.write(data, size);
+        }
+        uint32_t getCrc() const  { return crc; }
+        uint64_t getCount() const { return count; }
+
+    private:
+        juce::OutputStream& dest;
+        uint32_t crc = 0;
+        uint64_t count = 0;
+    };
+
+    void writeOldest()
+    {
+        auto job = pending.front();
+        pending.pop_front();
+        job->done.wait(-1);
+        bytesInFlight -= job->sourceBytes;
+
+        if (!ok) return;
+        if (!job->readOk)
+        {
+            DBG("ShowPackage: skipped unreadable " << job->source.getFullPathName());
+            return;
+        }
+
+        Entry e = beginEntry(job->name, job->deflate ? 8 : 0, false, job->crc,
+                             job->rawSize, job->data.getSize());
+        out->write(job->data.getData(), job->data.getSize());
+        finishEntry(std::move(e));
+    }
+
+    void drain()
+    {
+        while (!pending.empty())
+            writeOldest();
+    }
+
+    /// Writes a local header; sizes/CRC are zero (and follow in a data
+    /// descriptor) when `streamed`
+    Entry beginEntry(const juce::String& name, int method, bool streamed,
+                     uint32_t crc = 0, uint64_t rawSize = 0, uint64_t storedSize = 0)
+    {
+        Entry e;
+        e.name = name;
+        e.method = method;
+        e.flags = streamed ? 0x0008 : 0;
+        e.crc = crc;
+        e.rawSize = rawSize;
+        e.storedSize = storedSize;
+        e.headerOffset = (uint64_t)out->getPosition();
+
+        out->writeInt((int)0x04034b50);
+        out->writeShort(20);
+        out->writeShort((short)e.flags);
+        out->writeShort((short)method);
+        writeDosTime();
+        out->writeInt((int)crc);
+        out->writeInt((int)storedSize);
+        out->writeInt((int)rawSize);
+        out->writeShort((short)name.getNumBytesAsUTF8());
+        out->writeShort(0);
+        out->write(name.toRawUTF8(), name.getNumBytesAsUTF8());
+        return e;
+    }
+
+    void finishEntry(Entry e)
+    {
+        if (!out->getStatus().wasOk()) ok = false;
+        entries.push_back(std::move(e));
+    }
+
+    void writeDosTime()
+    {
+        const auto t = created;
+        out->writeShort((short)((t.getSeconds() >> 1) | (t.getMinutes() << 5) | (t.getHours() << 11)));
+        out->writeShort((short)(t.getDayOfMonth() | ((t.getMonth() + 1) << 5) | ((t.getYear() - 1980) << 9)));
+    }
+
+    std::unique_ptr<juce::TemporaryFile> temp;
+    std::unique_ptr<juce::FileOutputStream> out;
+    juce::ThreadPool pool;
+    std::deque<std::shared_ptr<FileJob>> pending;
+    size_t bytesInFlight = 0;
+    std::vector<Entry> entries;
+    juce::Time created = juce::Time::getCurrentTime();
+    bool ok = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ShowPackageWriter)
+};
+
+//==============================================================================
+class ShowPackageReader
+{
+public:
+    explicit ShowPackageReader(const juce::File& packageFile)
+        : zip(packageFile) {}
+
+    bool hasEntry(const juce::String& name) const
+    {
+        return zip.getIndexOfFileName(name) >= 0;
+    }
+
+    int getNumEntries() const { return zip.getNumEntries(); }
+
+    /// Parses a JSON entry (void if missing or invalid)
+    juce::var readJson(const juce::String& name)
+    {
+        const int index = zip.getIndexOfFileName(name);
+        if (index < 0) return {};
+        std::unique_ptr<juce::InputStream> in(zip.createStreamForEntry(index));
+        if (in == nullptr) return {};
+        return juce::JSON::parse(*in);
+    }
+
+    /// Streams an entry to `dest` (temporary file + rename)
+    bool extract(const juce::String& name, const juce::File& dest)
+    {
+        const int index = zip.getIndexOfFileName(name);
+        return index >= 0 && extractIndex(index, dest);
+    }
+
+    /// Extracts every entry under `prefix` ("dir/") into `destDir` in
+    /// parallel.  Returns the number written, -1 if cancelled.
+    int extractAll(const juce::String& prefix, const juce::File& destDir,
+                   const ShowPackageProgressFn& progress = nullptr)
+    {
+        juce::Array<int> indices;
+        for (int i = 0; i < zip.getNumEntries(); ++i)
+        {
+            // Flat directories only: nothing may land outside destDir
+            const auto* e = zip.getEntry(i);
+            if (e == nullptr || e->isSymbolicLink || !e->filename.startsWith(prefix)) continue;
+            const auto rest = e->filename.substring(prefix.length());
+            if (rest.isNotEmpty() && !rest.containsAnyOf("/\\:") && rest != "..")
+                indices.add(i);
+        }
+        if (indices.isEmpty()) return 0;
+        destDir.createDirectory();
+
+        juce::ThreadPool pool(juce::jlimit(1, 8, juce::SystemStats::getNumCpus() - 1));
+        std::atomic<int> written { 0 }, finished { 0 };
+        std::atomic<bool> cancelled { false };
+        for (int index : indices)
+        {
+            pool.addJob([this, index, &destDir, &prefix, &written, &finished, &cancelled]
+            {
+                if (!cancelled.load())
+                {
+                    const auto name = zip.getEntry(index)->filename.substring(prefix.length());
+                    if (extractIndex(index, destDir.getChildFile(name)))
+                        ++written;
+                }
+                ++finished;
+            });
+        }
+
+        while (finished.load() < indices.size())
+        {
+            if (progress && !progress((float)finished.load() / (float)indices.size()))
+                cancelled = true;
+            juce::Thread::sleep(20);
+        }
+        pool.removeAllJobs(true, -1);
+        return cancelled.load() ? -1 : written.load();
+    }
+
+private:
+    bool extractIndex(int index, const juce::File& dest)
+    {
+        std::unique_ptr<juce::InputStream> in(zip.createStreamForEntry(index));
+        if (in == nullptr) return false;
+
+        juce::TemporaryFile temp(dest);
+        {
+            juce::FileOutputStream out(temp.getFile());
+            if (!out.openedOk()) return false;
+            out.writeFromInputStream(*in, -1);
+            out.flush();
+            if (!out.getStatus().wasOk()) return false;
+        }
+        return temp.overwriteTargetFileWithTemporary();
+    }
+
+    juce::ZipFile zip;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ShowPackageReader)
+};
+
+//==============================================================================
+/// Runs an export or restore under a modal progress window.
+class ShowPackageJob : public juce::ThreadWithProgressWindow
+{
+public:
+    using Work = std::function<bool(const ShowPackageProgressFn&)>;
+    using Completion = std::function<void(bool ok, bool cancelled)>;
+
+    ShowPackageJob(const juce::String& title, Work workFn, Completion done)
+        : juce::ThreadWithProgressWindow(title, true, true, 10000, "Cancel"),
+          work(std::move(workFn)), onDone(std::move(done)) {}
+
+    void run() override
+    {
+        ok = work([this](float p)
+        {
+            setProgress(p);
+            return !threadShouldExit();
+        });
+    }
+
+    void threadComplete(bool userPressedCancel) override
+    {
+        if (onDone) onDone(ok && !userPressedCancel, userPressedCancel);
+    }
+
+private:
+    Work work;
+    Completion onDone;
+    bool ok = false;
+};
@@ -28,6 +28,7 @@
 #include <JuceHeader.h>
 #include "TimecodeCore.h"
 #include "NetworkUtils.h"
+#include "DisplaySnapshot.h"
 #include <atomic>
 #include <array>
 #include <cstring>
@@ -581,6 +582,21 @@ namespace StageLinQ
     {
         return wallClockToTimecode(double(playheadMs), fps);
     }
+
+    //==========================================================================
+    // Track/CurrentKeyIndex (0-23) to key name; nullptr when out of range
+    //==========================================================================
+    inline const char* keyIndexToString(int keyIdx)
+    {
+        if (keyIdx < 0 || keyIdx > 23) return nullptr;
+        static const char* const keys[] = {
+            "C",  "Am",  "G",   "Em",   "D",   "Bm",
+            "A",  "F#m", "E",   "Dbm",  "B",   "Abm",
+            "F#", "Ebm", "Db",  "Bbm",  "Ab",  "Fm",
+            "Eb", "Cm",  "Bb",  "Gm",   "F",   "Dm"
+        };
+        return keys[keyIdx];
+    }
 }
 
 //==============================================================================
@@ -647,6 +663,7 @@ struct StageLinQDeckState
     // Timing
     std::atomic<double>   lastUpdateTime { 0.0 };     // juce hiRes ms
     std::atomic<uint32_t> trackVersion { 0 };          // incremented on track change
+    std::atomic<uint32_t> metaVersion { 0 };           // incremented when artist, title or network path change
 
     // Derived playhead in ms (computed from beatInfo timeline or speed+time)
     std::atomic<uint32_t> playheadMs { 0 };
@@ -705,6 +722,7 @@ struct StageLinQDeckState
         channelAssignment.store(0);
         lastUpdateTime.store(0.0);
         trackVersion.store(0);
+        metaVersion.fetch_add(1);   // never reset: views compare against their last copy
         playheadMs.store(0);
     }
 };
@@ -743,6 +761,51 @@ struct StageLinQDeviceInfo
     bool          connected = false;
 };
 
+//==============================================================================
+// Display snapshot -- the per-frame deck and mixer state the views show,
+// published as one unit by the main StageLinQ thread (see DisplaySnapshot.h).
+// Same units and defaults as the matching StageLinQInput getters.  Track
+// text is not copied: `metaVersion` changes with artist, title or network
+// path, and views re-read those (getTrackInfo / getTrackNetworkPath) only
+// then.
+//==============================================================================
+struct StageLinQDisplaySnapshot
+{
+    uint32_t version = 0;
+    double   publishedMs = 0.0;    // juce::Time::getMillisecondCounterHiRes()
+
+    struct Deck
+    {
+        bool     active = false, playing = false, songLoaded = false;
+        char     model[32] {};
+        double   bpm = 0.0, speed = 0.0, faderPos = 0.0;
+        uint8_t  beatInBar = 1;
+        uint32_t playheadMs = 0, trackVersion = 0, metaVersion = 0;
+        double   trackLength = 0.0;        // seconds
+        int      keyIndex = -1, syncMode = 0;
+        bool     keyLock = false, bleep = false, jogTouch = false;
+        bool     loopEnabled = false;
+        double   loopInSamples = -1.0, loopOutSamples = -1.0, loopSizeBeats = 0.0;
+        double   sampleRate = 44100.0;
+
+        uint32_t getTrackLengthSec() const { return (uint32_t)trackLength; }
+
+        float getPlayPositionRatio() const
+        {
+            if (trackLength <= 0.0) return 0.0f;
+            return juce::jlimit(0.0f, 1.0f, (float)((double)playheadMs / (trackLength * 1000.0)));
+        }
+
+        const char* getPlayStateString() const
+        {
+            return playing ? "PLAYING" : songLoaded ? "PAUSED" : "NO TRACK";
+        }
+    } decks[StageLinQ::kMaxDecks];
+
+    double crossfader = 0.0;
+    bool   hasMixerData = false;
+};
+
 //==============================================================================
 // StageLinQInput -- main network handler
 //==============================================================================
@@ -969,15 +1032,8 @@ public:
 
     juce::String getCurrentKeyString(int deckNum) const
     {
-        int keyIdx = getCurrentKeyIndex(deckNum);
-        if (keyIdx < 0 || keyIdx > 23) return {};
-        static const char* const keys[] = {
-            "C",  "Am",  "G",   "Em",   "D",   "Bm",
-            "A",  "F#m", "E",   "Dbm",  "B",   "Abm",
-            "F#", "Ebm", "Db",  "Bbm",  "Ab",  "Fm",
-            "Eb", "Cm",  "Bb",  "Gm",   "F",   "Dm"
-        };
-        return keys[keyIdx];
+        auto* key = StageLinQ::keyIndexToString(getCurrentKeyIndex(deckNum));
+        return key != nullptr ? juce::String(key) : juce::String();
     }
 
     bool getKeyLock(int deckNum) const
@@ -1223,6 +1279,13 @@ public:
         return (uint8_t)juce::jlimit(1, 4, beatInBar);
     }
 
+    //==========================================================================
+    // Display snapshot -- one consistent copy of all deck and mixer state,
+    // republished by the main thread on every loop (about 100 Hz).
+    // Message thread only (see DisplaySnapshot.h); compare `version` to skip work.
+    //==========================================================================
+    const StageLinQDisplaySnapshot& getDisplaySnapshot() { return displaySnapshots.read(); }
+
     // Set track length from TrackMap (same pattern as ProDJLinkInput)
     void setTrackLengthSec(int deckNum, uint32_t seconds)
     {
@@ -1281,8 +1344,13 @@ private:
             // --- Compute derived state (playhead) ---
             updateDerivedState();
 
-            // Small sleep to avoid busy-wait -- discovery socket read has timeout
-            juce::Thread::sleep(10);
+            // --- One display snapshot per loop ---
+            publishDisplaySnapshot();
+
+            // Small sleep to avoid busy-wait -- discovery socket read has a
+            // short timeout too; together they pace the loop (and the display
+            // snapshots) at about 100 Hz
+            juce::Thread::sleep(5);
         }
 
         // Send exit announcement
@@ -1372,8 +1440,9 @@ private:
         juce::String senderIp;
         int senderPort = 0;
 
-        // Non-blocking read with short wait
-        if (!discoverySocket->waitUntilReady(true, 50))
+        // Non-blocking read with short wait (announcements arrive about once
+        // a second per device, so a short wait misses nothing)
+        if (!discoverySocket->waitUntilReady(true, 5))
             return;
 
         int bytesRead = discoverySocket->read(buf, sizeof(buf), false, senderIp, senderPort);
@@ -1624,6 +1693,57 @@ private:
         }
     }
 
+    //==========================================================================
+    // Display snapshot (main thread -- the only producer)
+    //==========================================================================
+    void publishDisplaySnapshot()
+    {
+        auto& s = displaySnapshots.beginWrite();
+        s.publishedMs = juce::Time::getMillisecondCounterHiRes();
+
+        char model[sizeof(s.decks[0].model)] {};
+        {
+            std::lock_guard<std::mutex> lock(devicesMutex);
+            const auto name = discoveredDevices.empty() ? juce::String("Denon")
+                                                        : discoveredDevices.begin()->second.deviceName;
+            name.copyToUTF8(model, sizeof(model));
+        }
+
+        for (int i = 0; i < StageLinQ::kMaxDecks; ++i)
+        {
+            const int dn = i + 1;
+            const auto& dk = decks[i];
+            auto& d = s.decks[i];
+            d.active      = dk.active.load(std::memory_order_acquire);
+            std::memcpy(d.model, d.active ? model : "", d.active ? sizeof(d.model) : 1);
+            d.playing     = dk.isPlaying.load(std::memory_order_relaxed);
+            d.songLoaded  = dk.songLoaded.load(std::memory_order_relaxed);
+            d.bpm         = getBPM(dn);
+            d.speed       = getActualSpeed(dn);
+            d.faderPos    = dk.faderPosition.load(std::memory_order_relaxed);
+            d.beatInBar   = getBeatInBar(dn);
+            d.playheadMs  = dk.playheadMs.load(std::memory_order_relaxed);
+            d.trackLength = dk.trackLength.load(std::memory_order_relaxed);
+            d.trackVersion = dk.trackVersion.load(std::memory_order_relaxed);
+            d.metaVersion  = dk.metaVersion.load(std::memory_order_relaxed);
+            d.keyIndex    = dk.currentKeyIndex.load(std::memory_order_relaxed);
+            d.syncMode    = dk.syncMode.load(std::memory_order_relaxed);
+            d.keyLock     = dk.keyLock.load(std::memory_order_relaxed);
+            d.bleep       = dk.bleep.load(std::memory_order_relaxed);
+            d.jogTouch    = dk.scratchWheelTouch.load(std::memory_order_relaxed);
+            d.loopEnabled = dk.loopEnabled.load(std::memory_order_relaxed);
+            d.loopInSamples  = dk.loopInPosition.load(std::memory_order_relaxed);
+            d.loopOutSamples = dk.loopOutPosition.load(std::memory_order_relaxed);
+            d.loopSizeBeats  = dk.loopSizeInBeats.load(std::memory_order_relaxed);
+            d.sampleRate  = dk.sampleRate.load(std::memory_order_relaxed);
+        }
+
+        s.crossfader   = mixerState.crossfaderPosition.load(std::memory_order_relaxed);
+        s.hasMixerData = hasMixerData();
+
+        displaySnapshots.publish();
+    }
+
     //==========================================================================
     // Handle a StateMap value update from a device
     //==========================================================================
@@ -1680,6 +1800,7 @@ private:
                 {
                     dk.artistName = newArtist;
                     dk.trackVersion.fetch_add(1, std::memory_order_relaxed);
+                    dk.metaVersion.fetch_add(1, std::memory_order_relaxed);
                 }
             }
             else if (sub == "Track/SongName")
@@ -1690,6 +1811,7 @@ private:
                 {
                     dk.songName = newTitle;
                     dk.trackVersion.fetch_add(1, std::memory_order_relaxed);
+                    dk.metaVersion.fetch_add(1, std::memory_order_relaxed);
                 }
             }
             else if (sub == "Track/TrackLength")
@@ -1719,6 +1841,7 @@ private:
                 if (netPath != dk.trackNetworkPath)
                 {
                     dk.trackNetworkPath = netPath;
+                    dk.metaVersion.fetch_add(1, std::memory_order_relaxed);
                     // Trigger database metadata request (artwork, extended info)
                     if (onMetadataRequest && !netPath.isEmpty())
                         onMetadataRequest(netPath);
@@ -2683,6 +2806,8 @@ private:
     // Mixer state
     StageLinQMixerState mixerState;
 
+    SnapshotTripleBuffer<StageLinQDisplaySnapshot> displaySnapshots;
+
     // Unknown path logging (debug aid -- logs each unknown path once)
 #if JUCE_DEBUG
     std::set<std::string> loggedUnknownPaths;
@@ -13,8 +13,10 @@
 //   - Engine assignment (which STC engine is monitoring this deck)
 //   - Channel fader + crossfader visualization
 //
-// Architecture: Owns its own 30Hz Timer, reads data from shared objects
-// (StageLinQInput, TrackMap, engines) via const getters.
+// Architecture: Framed by UiFrameScheduler (up to 30Hz, less when hidden,
+// covered or idle), reads data from shared objects (StageLinQInput,
+// TrackMap, engines) via const getters.  Decks repaint only when what they
+// show changed.
 // No artwork or waveform (requires FileTransfer service, planned for future).
 
 #pragma once
@@ -24,6 +26,11 @@
 #include "TimecodeEngine.h"
 #include "AppSettings.h"
 #include "CustomLookAndFeel.h"
+#include "WaveformPyramid.h"
+#include "RenderWorker.h"
+#include "UiFrameScheduler.h"
+#include "ChromeCache.h"
+#include "GpuCompositor.h"
 #include <vector>
 #include <memory>
 
@@ -31,7 +38,7 @@
 // StageLinQViewComponent -- Main content: 4 deck panels + mixer strip
 //==============================================================================
 class StageLinQViewComponent : public juce::Component,
-                                public juce::Timer
+                                private UiFrameScheduler::Client
 {
 public:
     StageLinQViewComponent(StageLinQInput& slq,
@@ -57,10 +64,17 @@ public:
             if (onLayoutChanged) onLayoutChanged();
         };
 
-        startTimerHz(30);
+        // Pre-scaled artwork and waveform pyramids land asynchronously
+        for (int d = 0; d < StageLinQ::kMaxDecks; ++d)
+            deckState[(size_t)d].scaledArtwork.onReady = [this, d] { deckState[(size_t)d].paintedHash = 0; };
+
+        frameScheduler->addClient(this, 30);
     }
 
-    ~StageLinQViewComponent() override { stopTimer(); }
+    ~StageLinQViewComponent() override { stopUpdates(); }
+
+    /// No more frames (window closed; it is recreated on reopen).
+    void stopUpdates() { frameScheduler->removeClient(this); }
 
     // --- Layout state ---
     bool getLayoutHorizontal() const { return layoutHorizontal; }
@@ -98,7 +112,7 @@ private:
     const juce::Colour accentRed   { 0xFFFF5252 };
 
     //--------------------------------------------------------------------------
-    // Per-deck cached state (read in timerCallback, used in paint)
+    // Per-deck cached state (read in uiFrame, used in paint)
     //--------------------------------------------------------------------------
     struct DeckState
     {
@@ -122,6 +136,8 @@ private:
         bool trackMapped = false;
         juce::String offset;
         Timecode offsetTimecode;
+        TrackKey tmKey;                        // rebuilt only when artist/title change
+        juce::String tmKeyArtist, tmKeyTitle;  // what tmKey was built from
 
         // Engine assignment
         juce::StringArray engineNames;
@@ -130,11 +146,16 @@ private:
 
         // Artwork (from StageLinQDbClient)
         juce::Image artwork;
+        ScaledImageCache scaledArtwork;  // artwork at its drawn size (RenderWorker)
+        juce::String networkPath;      // current, re-read when metaVersion changes
+        uint32_t metaVersion = ~0u;    // snapshot metaVersion of artist/title/networkPath
         juce::String lastNetworkPath;  // to detect changes
 
         // Waveform (from StageLinQDbClient)
         DenonWaveformData waveform;
         bool waveformLoaded = false;
+        std::shared_ptr<const WaveformPyramid> waveformPyramid;   // built off-thread
+        uint32_t pyramidGeneration = 0;
 
         // Performance data (from StageLinQDbClient)
         DenonPerformanceData perfData;
@@ -150,41 +171,58 @@ private:
         bool bleepMode = false;
         bool jogTouch = false;
         int syncMode = 0;
+
+        uint64_t paintedHash = 0;   // paintHash() when last repainted (0 = force)
     };
 
     std::array<DeckState, StageLinQ::kMaxDecks> deckState;
+    juce::SharedResourcePointer<RenderWorker> renderWorker;
+    juce::SharedResourcePointer<UiFrameScheduler> frameScheduler;
     double crossfaderPos = 0.0;
+    double paintedCrossfaderPos = -1.0;
 
     //==========================================================================
-    // Timer: fetch data from StageLinQInput at 30Hz
+    // UI frame: fetch data from StageLinQInput, repaint what changed
     //==========================================================================
-    void timerCallback() override
+    juce::Component& getFrameComponent() override { return *this; }
+
+    bool uiFrame(double) override
     {
+        // One consistent copy of all deck/mixer state for this frame
+        const auto& slq = stageLinQ.getDisplaySnapshot();
+
         for (int deck = 0; deck < StageLinQ::kMaxDecks; ++deck)
         {
             int dn = deck + 1;
             auto& ds = deckState[deck];
-
-            ds.active      = stageLinQ.isDeckActive(dn);
-            ds.model       = stageLinQ.getPlayerModel(dn);
-            ds.playState   = stageLinQ.getPlayStateString(dn);
-            ds.bpm         = stageLinQ.getBPM(dn);
-            ds.speed       = stageLinQ.getActualSpeed(dn);
-            ds.isPlaying   = stageLinQ.isPlayerPlaying(dn);
-            ds.beatInBar   = stageLinQ.getBeatInBar(dn);
-            ds.playheadMs  = stageLinQ.getPlayheadMs(dn);
-            ds.trackLenSec = stageLinQ.getTrackLengthSec(dn);
-            ds.posRatio    = stageLinQ.getPlayPositionRatio(dn);
-            ds.faderPos    = stageLinQ.getFaderPosition(dn);
-
-            auto tinfo     = stageLinQ.getTrackInfo(dn);
-            ds.artist      = tinfo.artist;
-            ds.title       = tinfo.title;
+            const auto& dk = slq.decks[deck];
+
+            ds.active      = dk.active;
+            if (ds.model != dk.model) ds.model = dk.model;
+            ds.playState   = dk.getPlayStateString();
+            ds.bpm         = dk.bpm;
+            ds.speed       = dk.speed;
+            ds.isPlaying   = dk.playing;
+            ds.beatInBar   = dk.beatInBar;
+            ds.playheadMs  = dk.playheadMs;
+            ds.trackLenSec = dk.getTrackLengthSec();
+            ds.posRatio    = dk.getPlayPositionRatio();
+            ds.faderPos    = dk.faderPos;
+
+            // Track text only when the input reports a change
+            if (dk.metaVersion != ds.metaVersion)
+            {
+                ds.metaVersion = dk.metaVersion;
+                auto tinfo     = stageLinQ.getTrackInfo(dn);
+                ds.artist      = tinfo.artist;
+                ds.title       = tinfo.title;
+                ds.networkPath = stageLinQ.getTrackNetworkPath(dn);
+            }
 
             // Artwork + waveform from database (if available)
             if (dbClient.isDatabaseReady())
             {
-                auto netPath = stageLinQ.getTrackNetworkPath(dn);
+                const auto& netPath = ds.networkPath;
                 if (netPath.isNotEmpty() && netPath != ds.lastNetworkPath)
                 {
                     // Try to fetch from cache -- DB thread may not have
@@ -203,6 +241,23 @@ private:
                         ds.artwork = art;
                         ds.waveform = wf;
                         ds.waveformLoaded = wf.valid;
+                        ds.waveformPyramid = nullptr;
+                        const uint32_t gen = ++ds.pyramidGeneration;
+                        if (wf.valid && wf.entryCount > 0)
+                        {
+                            juce::Component::SafePointer<StageLinQViewComponent> safe(this);
+                            WaveformPyramidBuilder::buildAsync(*renderWorker, wf.data, wf.entryCount, 3,
+                                [safe, deck, gen](std::shared_ptr<const WaveformPyramid> p)
+                                {
+                                    if (safe == nullptr) return;
+                                    auto& d = safe->deckState[(size_t)deck];
+                                    if (d.pyramidGeneration == gen)
+                                    {
+                                        d.waveformPyramid = std::move(p);
+                                        d.paintedHash = 0;
+                                    }
+                                });
+                        }
                         ds.perfData = perf;
                         ds.keyStr = dbMeta.key;
                     }
@@ -210,22 +265,22 @@ private:
             }
 
             // Live key from StateMap (overrides DB key when available -- updates with key shift)
-            auto liveKey = stageLinQ.getCurrentKeyString(dn);
-            if (liveKey.isNotEmpty())
-                ds.keyStr = liveKey;
+            if (auto* liveKey = StageLinQ::keyIndexToString(dk.keyIndex))
+                if (ds.keyStr != liveKey)
+                    ds.keyStr = liveKey;
 
             // Live loop state from StateMap (real-time active loop, not stored in DB)
-            ds.loopEnabled    = stageLinQ.isLoopEnabled(dn);
-            ds.loopInSamples  = stageLinQ.getLoopInPosition(dn);
-            ds.loopOutSamples = stageLinQ.getLoopOutPosition(dn);
-            ds.loopSizeBeats  = stageLinQ.getLoopSizeInBeats(dn);
-            ds.sampleRate     = stageLinQ.getSampleRate(dn);
+            ds.loopEnabled    = dk.loopEnabled;
+            ds.loopInSamples  = dk.loopInSamples;
+            ds.loopOutSamples = dk.loopOutSamples;
+            ds.loopSizeBeats  = dk.loopSizeBeats;
+            ds.sampleRate     = dk.sampleRate;
 
             // Live deck state badges
-            ds.keyLock   = stageLinQ.getKeyLock(dn);
-            ds.bleepMode = stageLinQ.isBleep(dn);
-            ds.jogTouch  = stageLinQ.isScratchWheelTouched(dn);
-            ds.syncMode  = stageLinQ.getSyncMode(dn);
+            ds.keyLock   = dk.keyLock;
+            ds.bleepMode = dk.bleep;
+            ds.jogTouch  = dk.jogTouch;
+            ds.syncMode  = dk.syncMode;
 
             // Timecode from playhead
             FrameRate fps = FrameRate::FPS_30;  // default -- StageLinQ has no fps detection
@@ -239,11 +294,14 @@ private:
             ds.offsetTimecode = {};
             if (ds.title.isNotEmpty())
             {
-                tmEntry = trackMap.find(ds.artist, ds.title, (int)ds.trackLenSec);
-                if (!tmEntry && ds.trackLenSec > 0)
-                    tmEntry = trackMap.find(ds.artist, ds.title, 0);
-                if (!tmEntry)
-                    tmEntry = trackMap.findIgnoringDuration(ds.artist, ds.title);
+                if (ds.tmKey.isEmpty() || ds.tmKeyArtist != ds.artist || ds.tmKeyTitle != ds.title)
+                {
+                    ds.tmKey = TrackKey::make(ds.artist, ds.title);
+                    ds.tmKeyArtist = ds.artist;
+                    ds.tmKeyTitle  = ds.title;
+                }
+                ds.tmKey.durationSec = (int)ds.trackLenSec;
+                tmEntry = std::as_const(trackMap).findBestMatchFuzzy(ds.tmKey);
                 if (tmEntry != nullptr)
                 {
                     ds.trackMapped = true;
@@ -272,9 +330,58 @@ private:
             }
         }
 
-        crossfaderPos = stageLinQ.getCrossfaderPosition();
+        crossfaderPos = slq.crossfader;
+
+        bool live = false;
+        for (int i = 0; i < StageLinQ::kMaxDecks; ++i)
+        {
+            auto& ds = deckState[(size_t)i];
+            const uint64_t h = paintHash(ds);
+            if (h != ds.paintedHash)
+            {
+                ds.paintedHash = h;
+                repaint(deckBounds[(size_t)i]);
+                live = true;
+            }
+        }
+        if (std::abs(crossfaderPos - paintedCrossfaderPos) > 0.001)
+        {
+            paintedCrossfaderPos = crossfaderPos;
+            repaint(xfBounds);
+            live = true;
+        }
+        return live;
+    }
 
-        repaint();
+    /// Everything paintDeck() draws from, folded into one value for the
+    /// dirty check.  Never 0 (0 forces a repaint).
+    static uint64_t paintHash(const DeckState& ds)
+    {
+        uint64_t h = 1469598103934665603ull;
+        auto mix = [&h](uint64_t v) { h = (h ^ v) * 1099511628211ull; };
+        auto mixD = [&mix](double v, double scale) { mix((uint64_t)std::llround(v * scale)); };
+
+        mix(ds.active); mix(ds.isPlaying); mix(ds.beatInBar);
+        mix(ds.playheadMs); mix(ds.trackLenSec);
+        mixD(ds.bpm, 100.0); mixD(ds.speed, 10000.0); mixD(ds.faderPos, 1000.0);
+        mixD(ds.posRatio, 10000.0);
+        mix((uint64_t)ds.model.hashCode64()); mix((uint64_t)ds.playState.hashCode64());
+        mix((uint64_t)ds.artist.hashCode64()); mix((uint64_t)ds.title.hashCode64());
+        mix((uint64_t)ds.fpsStr.hashCode64()); mix((uint64_t)ds.keyStr.hashCode64());
+        mix((uint64_t)ds.offset.hashCode64()); mix((uint64_t)ds.lastNetworkPath.hashCode64());
+        for (auto* tc : { &ds.timecode, &ds.offsetTimecode })
+        {
+            mix((uint64_t)tc->hours); mix((uint64_t)tc->minutes);
+            mix((uint64_t)tc->seconds); mix((uint64_t)tc->frames);
+        }
+        mix(ds.trackMapped);
+        for (auto& n : ds.engineNames) mix((uint64_t)n.hashCode64());
+        mix((uint64_t)ds.bpmSessionOverride); mix((uint64_t)ds.bpmTrackMapValue);
+        mix(ds.waveformLoaded); mix(ds.waveformPyramid != nullptr);
+        mix(ds.loopEnabled); mixD(ds.loopInSamples, 1.0); mixD(ds.loopOutSamples, 1.0);
+        mixD(ds.loopSizeBeats, 100.0);
+        mix(ds.keyLock); mix(ds.bleepMode); mix(ds.jogTouch); mix((uint64_t)ds.syncMode);
+        return h != 0 ? h : 1;
     }
 
     //==========================================================================
@@ -282,6 +389,7 @@ private:
     //==========================================================================
     void paint(juce::Graphics& g) override
     {
+        frameScheduler->beginPaint(this);   // closed in paintOverChildren
         g.fillAll(bgMain);
     }
 
@@ -326,16 +434,21 @@ private:
 
     void paintOverChildren(juce::Graphics& g) override
     {
-        // Paint decks
+        // Paint decks (only those inside the repainted region)
         for (int i = 0; i < StageLinQ::kMaxDecks; ++i)
-            paintDeck(g, deckBounds[i], i);
+            if (g.clipRegionIntersects(deckBounds[i]))
+                paintDeck(g, deckBounds[i], i);
 
         // Paint crossfader
-        paintCrossfader(g, xfBounds);
+        if (g.clipRegionIntersects(xfBounds))
+            paintCrossfader(g, xfBounds);
+
+        frameScheduler->endPaint(this);
     }
 
     std::array<juce::Rectangle<int>, StageLinQ::kMaxDecks> deckBounds;
     juce::Rectangle<int> xfBounds;
+    ChromeCache deckChrome { 4 };   // deck panel background + border
 
     //==========================================================================
     // Deck painting
@@ -346,11 +459,14 @@ private:
         int dn = deckIndex + 1;
         auto af = area.toFloat();
 
-        // Background
-        g.setColour(bgDeck);
-        g.fillRoundedRectangle(af, 4.0f);
-        g.setColour(borderCol);
-        g.drawRoundedRectangle(af, 4.0f, 1.0f);
+        // Background (cached per deck size)
+        deckChrome.draw(g, af, 0, [this](juce::Graphics& cg, juce::Rectangle<float> r)
+        {
+            cg.setColour(bgDeck);
+            cg.fillRoundedRectangle(r, 4.0f);
+            cg.setColour(borderCol);
+            cg.drawRoundedRectangle(r, 4.0f, 1.0f);
+        });
 
         auto inner = area.reduced(6);
         if (inner.getWidth() < 30 || inner.getHeight() < 30) return;
@@ -445,8 +561,14 @@ private:
         // Draw artwork square (if reserved above)
         if (ds.artwork.isValid() && artSize > 0)
         {
-            g.drawImage(ds.artwork, artBounds,
-                        juce::RectanglePlacement::centred | juce::RectanglePlacement::onlyReduceInSize);
+            // Blit a pre-scaled variant 1:1 (rescaled on the RenderWorker)
+            auto dest = juce::RectanglePlacement(juce::RectanglePlacement::centred
+                                                 | juce::RectanglePlacement::onlyReduceInSize)
+                            .appliedTo(ds.artwork.getBounds().toFloat(), artBounds);
+            const float px = g.getInternalContext().getPhysicalPixelScaleFactor();
+            auto art = ds.scaledArtwork.get(ds.artwork, juce::roundToInt(dest.getWidth() * px),
+                                            juce::roundToInt(dest.getHeight() * px));
+            g.drawImage(art, dest);
             g.setColour(borderCol);
             g.drawRoundedRectangle(artBounds, 2.0f, 1.0f);
         }
@@ -572,10 +694,10 @@ private:
             g.setColour(bgMain);
             g.fillRoundedRectangle(wfArea.toFloat(), 2.0f);
 
-            if (ds.waveformLoaded && ds.waveform.entryCount > 0)
+            if (ds.waveformLoaded && ds.waveformPyramid != nullptr)
             {
                 // Paint 3-band waveform (same rendering as WaveformDisplay::renderThreeBandBars)
-                paintWaveform(g, wfArea.toFloat(), ds.waveform, ratio);
+                paintWaveform(g, wfArea.toFloat(), *ds.waveformPyramid, ratio);
 
                 // Paint cue markers and loop regions on top of waveform
                 if (ds.perfData.valid && ds.perfData.totalSamples > 0.0)
@@ -678,25 +800,19 @@ private:
     // Waveform painting (3-band overview, same colors as Pioneer ThreeBand)
     //==========================================================================
     void paintWaveform(juce::Graphics& g, juce::Rectangle<float> area,
-                       const DenonWaveformData& wf, float playRatio)
+                       const WaveformPyramid& wf, float playRatio)
     {
         float w = area.getWidth();
         float h = area.getHeight();
         float midY = area.getY() + h * 0.5f;
         float halfH = h * 0.5f;
-        int numEntries = wf.entryCount;
-        if (numEntries <= 0 || wf.data.size() < (size_t)(numEntries * 3)) return;
+        int numEntries = wf.getSourceEntries();
+        if (numEntries <= 0 || wf.getChannels() < 3) return;
 
-        const uint8_t* data = wf.data.data();
         float entriesPerPx = (float)numEntries / w;
 
-        // Find global peak for normalization
-        uint8_t globalPeak = 1;
-        for (int i = 0; i < numEntries; ++i)
-        {
-            int off = i * 3;
-            globalPeak = std::max({ globalPeak, data[off], data[off + 1], data[off + 2] });
-        }
+        // Global peak for normalization (precomputed in the pyramid)
+        uint8_t globalPeak = juce::jmax((uint8_t)1, wf.getPeakOfFirst(3));
         float hScale = halfH / (float)globalPeak;
 
         // Colors: low=red, mid=green, high=blue (standard 3-band)
@@ -704,26 +820,17 @@ private:
         const juce::Colour colMid  { 0xFF33CC33 };
         const juce::Colour colHigh { 0xFF3366CC };
 
+        WaveformPyramid::Column col;
         for (int px = 0; px < (int)w; ++px)
         {
             int eStart = juce::jlimit(0, numEntries - 1, (int)(px * entriesPerPx));
             int eEnd   = juce::jlimit(0, numEntries - 1, (int)((px + 1) * entriesPerPx));
             if (eEnd < eStart) eEnd = eStart;
+            if (!wf.sample(eStart, eEnd + 1, col)) continue;
 
-            float sumMid = 0, sumHigh = 0, sumLow = 0;
-            int count = 0;
-            for (int e = eStart; e <= eEnd; ++e)
-            {
-                int off = e * 3;
-                sumMid  += data[off];      // mid (reordered at decode)
-                sumHigh += data[off + 1];  // high
-                sumLow  += data[off + 2];  // low
-                count++;
-            }
-            if (count == 0) continue;
-            float avgMid  = sumMid / count;
-            float avgHigh = sumHigh / count;
-            float avgLow  = sumLow / count;
+            float avgMid  = col.avg[0];   // mid (reordered at decode)
+            float avgHigh = col.avg[1];   // high
+            float avgLow  = col.avg[2];   // low
 
             float x = area.getX() + px;
 
@@ -913,7 +1020,7 @@ public:
     {
         if (onBoundsCapture) onBoundsCapture();
         if (auto* content = dynamic_cast<StageLinQViewComponent*>(getContentComponent()))
-            content->stopTimer();
+            content->stopUpdates();
         setVisible(false);
     }
 
@@ -960,6 +1067,15 @@ public:
         return false;
     }
 
+    /// Composite the view through OpenGL (falls back to software on its own).
+    void enableGpuCompositing()
+    {
+        if (gpuCompositor == nullptr && getContentComponent() != nullptr)
+            gpuCompositor = std::make_unique<GpuCompositor>(*getContentComponent());
+    }
+
 private:
+    std::unique_ptr<GpuCompositor> gpuCompositor;   // destroyed before the content
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StageLinQViewWindow)
 };
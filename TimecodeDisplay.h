@@ -6,6 +6,8 @@
 #include <JuceHeader.h>
 #include "TimecodeCore.h"
 #include "CustomLookAndFeel.h"  // getMonoFontName(), measureStringWidth()
+#include "TimecodeGlyphAtlas.h"
+#include <cstdio>
 
 class TimecodeDisplay : public juce::Component
 {
@@ -17,14 +19,9 @@ public:
 
     void setTimecode(const Timecode& tc)
     {
-        if (currentTimecode.hours   != tc.hours   ||
-            currentTimecode.minutes != tc.minutes  ||
-            currentTimecode.seconds != tc.seconds  ||
-            currentTimecode.frames  != tc.frames)
-        {
-            currentTimecode = tc;
-            repaint();
-        }
+        // Only the cells of fields that changed are repainted
+        repaintChangedFields(currentTimecode, tc, 0);
+        currentTimecode = tc;
     }
 
     void setFrameRate(FrameRate fps)
@@ -32,7 +29,8 @@ public:
         if (currentFps != fps)
         {
             currentFps = fps;
-            repaint();
+            updateInfoLayout();
+            repaint(infoArea);
         }
     }
 
@@ -41,7 +39,8 @@ public:
         if (sourceName != name)
         {
             sourceName = name;
-            repaint();
+            updateInfoLayout();
+            repaint(infoArea);
         }
     }
 
@@ -50,7 +49,7 @@ public:
         if (running != isRunning)
         {
             running = isRunning;
-            repaint();
+            repaint();   // every colour changes
         }
     }
 
@@ -60,20 +59,16 @@ public:
         if (fpsConvertActive != enabled)
         {
             fpsConvertActive = enabled;
+            updateLayout();
             repaint();
         }
     }
 
     void setOutputTimecode(const Timecode& tc)
     {
-        if (outTimecode.hours   != tc.hours   ||
-            outTimecode.minutes != tc.minutes  ||
-            outTimecode.seconds != tc.seconds  ||
-            outTimecode.frames  != tc.frames)
-        {
-            outTimecode = tc;
-            if (fpsConvertActive) repaint();
-        }
+        if (outTimecode.frames != tc.frames && fpsConvertActive)
+            repaintCells(12, 2);
+        outTimecode = tc;
     }
 
     void setOutputFrameRate(FrameRate fps)
@@ -81,211 +76,247 @@ public:
         if (outFps != fps)
         {
             outFps = fps;
-            if (fpsConvertActive) repaint();
+            if (fpsConvertActive)
+            {
+                updateInfoLayout();
+                repaint(infoArea);
+            }
         }
     }
 
-    void paint(juce::Graphics& g) override
+    void resized() override
     {
-        auto bounds = getLocalBounds().toFloat();
-
-        // --- Status indicator colour ---
-        auto statusColour = running ? juce::Colour(0xFF2E7D32) : juce::Colour(0xFF37474F);
-
-        // --- Main timecode display ---
-        juce::String tcText = currentTimecode.toDisplayString(currentFps);
-
-        // Scale font to fit available width
-        // When FPS convert is active, we need room for "/FF" suffix (~14 chars total)
-        float maxFontSize = 72.0f;
-        float availW = bounds.getWidth() - 20.0f;
-        float totalChars = fpsConvertActive ? 14.0f : 11.0f;
-
-        // Compute character width ratio dynamically from the actual font metrics
-        // (avoids hardcoded values that only match a single platform's monospace font)
-        auto measureFont = juce::Font(juce::FontOptions(getMonoFontName(), maxFontSize, juce::Font::bold));
-        float charWidthRatio = measureStringWidth(measureFont, "0") / maxFontSize;
-        if (charWidthRatio <= 0.0f) charWidthRatio = 0.6f;  // safe fallback
-
-        float fittedSize = availW / (totalChars * charWidthRatio);
-        float fontSize = juce::jmin(maxFontSize, juce::jmax(24.0f, fittedSize));
-
-        float tcHeight = fontSize * 1.25f;
-        float labelSize = juce::jmin(9.0f, fontSize * 0.14f);
-        float labelH = 14.0f;
-        float statusH = 14.0f;
-        float gap1 = 8.0f;   // status -> tc
-        float gap2 = 4.0f;   // tc -> labels
-
-        // Total content block height
-        float contentH = statusH + gap1 + tcHeight + gap2 + labelH;
+        updateLayout();
+    }
 
-        // Center vertically, but leave room for bottom info
-        float usableH = bounds.getHeight() - 50.0f;  // reserve 50px for source/fps info
-        float contentY = bounds.getY() + (usableH - contentH) / 2.0f;
-        contentY = juce::jmax(bounds.getY() + 10.0f, contentY);  // don't go above top
+    //==========================================================================
+    // paint() only blits rasters from the atlas -- fonts, measuring and text
+    // layout happen in updateLayout() / updateInfoLayout() on resize or
+    // when the info line changes.
+    void paint(juce::Graphics& g) override
+    {
+        atlas.setScale(g.getInternalContext().getPhysicalPixelScaleFactor());
+        atlas.prepareGlyphs(layout.fontSize, layout.charW, layout.tcHeight);
 
         // --- Status indicator (dot + label, centred as a unit) ---
-        float statusY = contentY;
-
-        juce::String statusText = running ? "RUNNING" : "STOPPED";
-        juce::Font statusFont(juce::FontOptions(getMonoFontName(), 11.0f, juce::Font::plain));
-        float dotSize   = 6.0f;
-        float dotGap    = 6.0f;
-        float textW     = measureStringWidth(statusFont, statusText);
-        float groupW    = dotSize + dotGap + textW;
-        float groupX    = bounds.getCentreX() - groupW / 2.0f;
-
-        g.setColour(statusColour);
-        float textMidY = statusY + statusH / 2.0f;
-        g.fillEllipse(groupX, textMidY - dotSize / 2.0f - 1.0f, dotSize, dotSize);
-
-        g.setColour(running ? juce::Colour(0xFF66BB6A) : juce::Colour(0xFF546E7A));
-        g.setFont(statusFont);
-        g.drawText(statusText,
-                   juce::Rectangle<float>(groupX + dotSize + dotGap, statusY, textW + 4.0f, statusH),
-                   juce::Justification::centredLeft);
-
-        // --- Timecode text ---
-        float tcY = statusY + statusH + gap1;
-        juce::Font tcFont(juce::FontOptions(getMonoFontName(), fontSize, juce::Font::bold));
-        g.setFont(tcFont);
+        if (g.clipRegionIntersects(statusArea))
+        {
+            auto statusColour = running ? juce::Colour(0xFF2E7D32) : juce::Colour(0xFF37474F);
+            const float textW = layout.statusTextW[running ? 1 : 0];
+            const float groupW = kDotSize + kDotGap + textW;
+            const float groupX = layout.centreX - groupW / 2.0f;
+            const float textMidY = layout.statusY + kStatusH / 2.0f;
+
+            g.setColour(statusColour);
+            g.fillEllipse(groupX, textMidY - kDotSize / 2.0f - 1.0f, kDotSize, kDotSize);
+
+            g.setColour(running ? juce::Colour(0xFF66BB6A) : juce::Colour(0xFF546E7A));
+            atlas.drawText(g, running ? "RUNNING" : "STOPPED", 11.0f, false,
+                           { groupX + kDotSize + kDotGap, layout.statusY, textW + 4.0f, kStatusH },
+                           juce::Justification::centredLeft);
+        }
 
+        // --- Timecode digits ---
         // Timecode colour: bright green when running, muted gray when stopped
-        auto tcColour = running ? juce::Colour(0xFF00E676) : juce::Colour(0xFF546E7A);
+        char tcText[16];
+        formatTimecode(tcText, sizeof(tcText), currentTimecode);
+        g.setColour(running ? juce::Colour(0xFF00E676) : juce::Colour(0xFF546E7A));
+        atlas.drawGlyphs(g, tcText, layout.startX, layout.tcY);
 
         if (fpsConvertActive)
         {
-            // Split rendering: main TC in running colour, "/FF" suffix in cyan/dimmed
-            juce::String outFrameStr = juce::String::formatted("%02d",
-                juce::jlimit(0, 29, outTimecode.frames));
-            juce::String fullText = tcText + "/" + outFrameStr;
-
-            // Measure widths to position both parts
-            float fullW = measureStringWidth(tcFont, fullText);
-            float mainW = measureStringWidth(tcFont, tcText);
-            float suffixW = fullW - mainW;
-            float textStartX = bounds.getCentreX() - fullW / 2.0f;
-
-            // Draw main TC (input)
-            g.setColour(tcColour);
-            g.drawText(tcText,
-                       juce::Rectangle<float>(textStartX, tcY, mainW, tcHeight),
-                       juce::Justification::centredLeft);
-
-            // Draw "/FF" suffix -- cyan when running, dimmer when stopped
+            // "/FF" suffix -- cyan when running, dimmer when stopped
+            char suffix[8];
+            std::snprintf(suffix, sizeof(suffix), "/%02d", juce::jlimit(0, 29, outTimecode.frames));
             g.setColour(running ? juce::Colour(0xFF00ACC1) : juce::Colour(0xFF37474F));
-            g.drawText("/" + outFrameStr,
-                       juce::Rectangle<float>(textStartX + mainW, tcY, suffixW, tcHeight),
-                       juce::Justification::centredLeft);
-        }
-        else
-        {
-            // Standard display
-            g.setColour(tcColour);
-            g.drawText(tcText,
-                       juce::Rectangle<float>(bounds.getX(), tcY, bounds.getWidth(), tcHeight),
-                       juce::Justification::centred);
+            atlas.drawGlyphs(g, suffix, layout.startX + 11.0f * layout.charW, layout.tcY);
         }
 
         // --- Labels under each pair ---
-        float labelY = tcY + tcHeight + gap2;
-        g.setFont(juce::Font(juce::FontOptions(getMonoFontName(), juce::jmax(7.0f, labelSize), juce::Font::plain)));
+        if (g.clipRegionIntersects(labelArea))
+        {
+            const float labelSize = juce::jmax(7.0f, layout.labelSize);
+            const float charW = layout.charW;
+            const float x0 = layout.startX;
 
-        // Compute label positions based on the full displayed text width
-        float centerX = bounds.getCentreX();
-        float displayChars = fpsConvertActive ? 14.0f : 11.0f;
-        float tcWidth = fontSize * displayChars * charWidthRatio;
-        float startX = centerX - tcWidth / 2.0f;
+            if (fpsConvertActive)
+            {
+                // Character layout: HH:MM:SS.FF/FF = 14 chars
+                // Positions:         01 2 34 5 67 8 9A B CD
+                // Centre of each group:
+                //   HRS = chars 0-1  -> centre at char 1.0
+                //   MIN = chars 3-4  -> centre at char 3.5
+                //   SEC = chars 6-7  -> centre at char 6.5
+                //   FRM = chars 9-10 -> centre at char 9.5
+                //   OUT = chars 12-13-> centre at char 12.5
+                const float centres[] = { 1.0f, 3.5f, 6.5f, 9.5f };
+                const char* labels[] = { "HRS", "MIN", "SEC", "FRM" };
+
+                g.setColour(juce::Colour(0xFF546E7A));
+                for (int i = 0; i < 4; ++i)
+                    atlas.drawText(g, labels[i], labelSize, false,
+                                   { x0 + centres[i] * charW - 15.0f, layout.labelY, 30.0f, 14.0f },
+                                   juce::Justification::centred);
+
+                // "OUT" label in cyan under the converted frame digits
+                g.setColour(juce::Colour(0xFF00838F));
+                atlas.drawText(g, "OUT", labelSize, false,
+                               { x0 + 12.5f * charW - 15.0f, layout.labelY, 30.0f, 14.0f },
+                               juce::Justification::centred);
+            }
+            else
+            {
+                const float segW = charW * 11.0f / 4.0f;
+                const char* labels[] = { "HRS", "MIN", "SEC", "FRM" };
+
+                g.setColour(juce::Colour(0xFF546E7A));
+                for (int i = 0; i < 4; i++)
+                    atlas.drawText(g, labels[i], labelSize, false,
+                                   { x0 + segW * ((float)i + 0.5f) - 15.0f, layout.labelY, 60.0f, 14.0f },
+                                   juce::Justification::centred);
+            }
+        }
 
-        if (fpsConvertActive)
+        // --- Source + FPS info ---
+        if (g.clipRegionIntersects(infoArea))
         {
-            // Character layout: HH:MM:SS.FF/FF = 14 chars
-            // Positions:         01 2 34 5 67 8 9A B CD
-            // Centre of each group:
-            //   HRS = chars 0-1  -> centre at char 1.0
-            //   MIN = chars 3-4  -> centre at char 3.5
-            //   SEC = chars 6-7  -> centre at char 6.5
-            //   FRM = chars 9-10 -> centre at char 9.5
-            //   OUT = chars 12-13-> centre at char 12.5
-            float charW = tcWidth / displayChars;
-            float posHrs = startX + 1.0f  * charW;
-            float posMn  = startX + 3.5f  * charW;
-            float posSec = startX + 6.5f  * charW;
-            float posFrm = startX + 9.5f  * charW;
-            float posOut = startX + 12.5f * charW;
-
-            g.setColour(juce::Colour(0xFF546E7A));
-            g.drawText("HRS", juce::Rectangle<float>(posHrs - 15.0f, labelY, 30.0f, 14.0f), juce::Justification::centred);
-            g.drawText("MIN", juce::Rectangle<float>(posMn  - 15.0f, labelY, 30.0f, 14.0f), juce::Justification::centred);
-            g.drawText("SEC", juce::Rectangle<float>(posSec - 15.0f, labelY, 30.0f, 14.0f), juce::Justification::centred);
-            g.drawText("FRM", juce::Rectangle<float>(posFrm - 15.0f, labelY, 30.0f, 14.0f), juce::Justification::centred);
-
-            // "OUT" label in cyan under the converted frame digits
-            g.setColour(juce::Colour(0xFF00838F));
-            g.drawText("OUT", juce::Rectangle<float>(posOut - 15.0f, labelY, 30.0f, 14.0f), juce::Justification::centred);
+            const float infoY = layout.infoY;
+            if (fpsConvertActive)
+            {
+                // Input and output rates with arrow, centred as one string
+                g.setColour(juce::Colour(0xFF37474F));
+                atlas.drawText(g, info.inLabel, 10.0f, false,
+                               { info.x, infoY, info.inW, 14.0f }, juce::Justification::centredLeft);
+
+                g.setColour(juce::Colour(0xFF546E7A));
+                atlas.drawText(g, info.arrow, 10.0f, false,
+                               { info.x + info.inW, infoY, info.arW, 14.0f }, juce::Justification::centredLeft);
+
+                g.setColour(juce::Colour(0xFF00ACC1));
+                atlas.drawText(g, info.outLabel, 10.0f, false,
+                               { info.x + info.inW + info.arW, infoY, info.outW, 14.0f },
+                               juce::Justification::centredLeft);
+            }
+            else
+            {
+                g.setColour(juce::Colour(0xFF37474F));
+                atlas.drawText(g, info.inLabel, 10.0f, false,
+                               { 0.0f, infoY, (float)getWidth(), 14.0f }, juce::Justification::centred);
+            }
         }
-        else
+    }
+
+private:
+    static constexpr float kStatusH = 14.0f;
+    static constexpr float kDotSize = 6.0f;
+    static constexpr float kDotGap  = 6.0f;
+
+    //==========================================================================
+    /// "HH:MM:SS.FF" -- same text as Timecode::toDisplayString(), no String.
+    static void formatTimecode(char* out, size_t size, const Timecode& tc)
+    {
+        std::snprintf(out, size, "%02d:%02d:%02d.%02d",
+                      juce::jlimit(0, 23, tc.hours),   juce::jlimit(0, 59, tc.minutes),
+                      juce::jlimit(0, 59, tc.seconds), juce::jlimit(0, 29, tc.frames));
+    }
+
+    /// Text geometry for the current size and mode.  Font sizing follows the
+    /// available width: room for "HH:MM:SS.FF" (11 chars) or, with FPS
+    /// convert, "HH:MM:SS.FF/FF" (14 chars).
+    void updateLayout()
+    {
+        auto bounds = getLocalBounds().toFloat();
+        const float totalChars = fpsConvertActive ? 14.0f : 11.0f;
+
+        // Character width ratio from the actual font metrics (avoids
+        // hardcoded values that only match a single platform's monospace font)
+        constexpr float maxFontSize = 72.0f;
+        if (charWidthRatio <= 0.0f)
         {
-            float segW = tcWidth / 4.0f;
-            float positions[] = { startX + segW * 0.5f, startX + segW * 1.5f,
-                                  startX + segW * 2.5f, startX + segW * 3.5f };
-            const char* labels[] = { "HRS", "MIN", "SEC", "FRM" };
+            auto measureFont = juce::Font(juce::FontOptions(getMonoFontName(), maxFontSize, juce::Font::bold));
+            charWidthRatio = measureStringWidth(measureFont, "0") / maxFontSize;
+            if (charWidthRatio <= 0.0f) charWidthRatio = 0.6f;  // safe fallback
 
-            g.setColour(juce::Colour(0xFF546E7A));
-            for (int i = 0; i < 4; i++)
-            {
-                g.drawText(labels[i],
-                           juce::Rectangle<float>(positions[i] - 15.0f, labelY, 60.0f, 14.0f),
-                           juce::Justification::centred);
-            }
+            juce::Font statusFont(juce::FontOptions(getMonoFontName(), 11.0f, juce::Font::plain));
+            layout.statusTextW[0] = measureStringWidth(statusFont, "STOPPED");
+            layout.statusTextW[1] = measureStringWidth(statusFont, "RUNNING");
         }
 
-        // --- Source + FPS info ---
-        float infoY = bounds.getBottom() - 40.0f;
-        g.setFont(juce::Font(juce::FontOptions(getMonoFontName(), 10.0f, juce::Font::plain)));
+        const float availW = bounds.getWidth() - 20.0f;
+        const float fittedSize = availW / (totalChars * charWidthRatio);
+        layout.fontSize = juce::jmin(maxFontSize, juce::jmax(24.0f, fittedSize));
+        layout.charW = layout.fontSize * charWidthRatio;
+        layout.tcHeight = layout.fontSize * 1.25f;
+        layout.labelSize = juce::jmin(9.0f, layout.fontSize * 0.14f);
+
+        const float labelH = 14.0f;
+        const float gap1 = 8.0f;   // status -> tc
+        const float gap2 = 4.0f;   // tc -> labels
+
+        // Total content block height, centred vertically above the
+        // 50px reserved for source/fps info
+        const float contentH = kStatusH + gap1 + layout.tcHeight + gap2 + labelH;
+        const float usableH = bounds.getHeight() - 50.0f;
+        float contentY = bounds.getY() + (usableH - contentH) / 2.0f;
+        contentY = juce::jmax(bounds.getY() + 10.0f, contentY);  // don't go above top
+
+        layout.centreX = bounds.getCentreX();
+        layout.statusY = contentY;
+        layout.tcY = layout.statusY + kStatusH + gap1;
+        layout.labelY = layout.tcY + layout.tcHeight + gap2;
+        layout.infoY = bounds.getBottom() - 40.0f;
+        layout.startX = layout.centreX - totalChars * layout.charW / 2.0f;
+
+        statusArea = juce::Rectangle<float>(0.0f, layout.statusY, bounds.getWidth(), kStatusH + 2.0f)
+                         .getSmallestIntegerContainer();
+        labelArea = juce::Rectangle<float>(0.0f, layout.labelY, bounds.getWidth(), labelH)
+                        .getSmallestIntegerContainer();
+        infoArea = juce::Rectangle<float>(0.0f, layout.infoY, bounds.getWidth(), 14.0f)
+                       .getSmallestIntegerContainer();
+
+        updateInfoLayout();
+    }
 
+    /// Source / FPS line: strings and widths, measured only when they change.
+    void updateInfoLayout()
+    {
         if (fpsConvertActive)
         {
-            // Show both input and output rates with arrow
-            juce::String inLabel  = "SOURCE: " + sourceName + "  |  "
-                                  + frameRateToString(currentFps);
-            juce::String arrow    = " -> ";
-            juce::String outLabel = frameRateToString(outFps) + " FPS";
+            info.inLabel  = "SOURCE: " + sourceName + "  |  " + frameRateToString(currentFps);
+            info.arrow    = " -> ";
+            info.outLabel = frameRateToString(outFps) + " FPS";
 
-            // Measure to centre the full composite string
             juce::Font infoFont(juce::FontOptions(getMonoFontName(), 10.0f, juce::Font::plain));
-            g.setFont(infoFont);
-            float inW  = measureStringWidth(infoFont, inLabel);
-            float arW  = measureStringWidth(infoFont, arrow);
-            float outW = measureStringWidth(infoFont, outLabel);
-            float totW = inW + arW + outW;
-            float sx   = bounds.getCentreX() - totW / 2.0f;
-
-            g.setColour(juce::Colour(0xFF37474F));
-            g.drawText(inLabel, juce::Rectangle<float>(sx, infoY, inW, 14.0f),
-                       juce::Justification::centredLeft);
-
-            g.setColour(juce::Colour(0xFF546E7A));
-            g.drawText(arrow, juce::Rectangle<float>(sx + inW, infoY, arW, 14.0f),
-                       juce::Justification::centredLeft);
-
-            g.setColour(juce::Colour(0xFF00ACC1));
-            g.drawText(outLabel, juce::Rectangle<float>(sx + inW + arW, infoY, outW, 14.0f),
-                       juce::Justification::centredLeft);
+            info.inW  = measureStringWidth(infoFont, info.inLabel);
+            info.arW  = measureStringWidth(infoFont, info.arrow);
+            info.outW = measureStringWidth(infoFont, info.outLabel);
+            info.x    = layout.centreX - (info.inW + info.arW + info.outW) / 2.0f;
         }
         else
         {
-            g.setColour(juce::Colour(0xFF37474F));
-            juce::String infoText = "SOURCE: " + sourceName + "  |  "
-                                  + frameRateToString(currentFps) + " FPS";
-            g.drawText(infoText,
-                       juce::Rectangle<float>(0.0f, infoY, bounds.getWidth(), 14.0f),
-                       juce::Justification::centred);
+            info.inLabel = "SOURCE: " + sourceName + "  |  " + frameRateToString(currentFps) + " FPS";
         }
     }
 
-private:
+    /// Repaints the two-digit cells of each field that differs.  Cell 0 is
+    /// the first character of the display (hours tens).
+    void repaintChangedFields(const Timecode& a, const Timecode& b, int firstCell)
+    {
+        if (a.hours   != b.hours)   repaintCells(firstCell + 0, 2);
+        if (a.minutes != b.minutes) repaintCells(firstCell + 3, 2);
+        if (a.seconds != b.seconds) repaintCells(firstCell + 6, 2);
+        if (a.frames  != b.frames)  repaintCells(firstCell + 9, 2);
+    }
+
+    void repaintCells(int first, int count)
+    {
+        if (layout.charW <= 0.0f) { repaint(); return; }
+        juce::Rectangle<float> r(layout.startX + (float)first * layout.charW, layout.tcY,
+                                 (float)count * layout.charW, layout.tcHeight);
+        repaint(r.getSmallestIntegerContainer().expanded(1));
+    }
+
+    //==========================================================================
     Timecode currentTimecode;
     FrameRate currentFps = FrameRate::FPS_30;
     juce::String sourceName = "SYSTEM";
@@ -296,5 +327,24 @@ private:
     Timecode outTimecode;
     FrameRate outFps = FrameRate::FPS_30;
 
+    // Layout (updateLayout)
+    struct Layout
+    {
+        float fontSize = 24.0f, charW = 0.0f, tcHeight = 30.0f, labelSize = 7.0f;
+        float centreX = 0.0f, startX = 0.0f;
+        float statusY = 0.0f, tcY = 0.0f, labelY = 0.0f, infoY = 0.0f;
+        float statusTextW[2] {};   // STOPPED, RUNNING
+    } layout;
+    float charWidthRatio = 0.0f;   // measured once
+    juce::Rectangle<int> statusArea, labelArea, infoArea;
+
+    struct InfoLine
+    {
+        juce::String inLabel, arrow, outLabel;
+        float inW = 0.0f, arW = 0.0f, outW = 0.0f, x = 0.0f;
+    } info;
+
+    TimecodeGlyphAtlas atlas;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TimecodeDisplay)
 };
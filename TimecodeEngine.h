@@ -9,12 +9,14 @@
 #include "MtcOutput.h"
 #include "ArtnetInput.h"
 #include "ArtnetOutput.h"
+#include "SacnOutput.h"
 #include "LtcInput.h"
 #include "LtcOutput.h"
 #include "ProDJLinkInput.h"
 #include "StageLinQInput.h"
 #include "HippotizerInput.h"
 #include "HippotizerOutput.h"
+#include "OscTimecodeOutput.h"
 #include "DbServerClient.h"
 #include "TriggerOutput.h"
 #include "LinkBridge.h"
@@ -22,6 +24,8 @@
 #include "AudioBpmInput.h"
 #include "AppSettings.h"
 #include "MixerMap.h"
+#include "TrackEventTimeline.h"
+#include "DisplaySnapshot.h"
 #include <memory>
 
 //==============================================================================
@@ -40,6 +44,7 @@ class TimecodeEngine
 {
 public:
     enum class InputSource { MTC, ArtNet, SystemTime, LTC, ProDJLink, StageLinQ, Hippotizer };
+    enum class DmxProtocol { ArtNet = 0, Sacn, Both };
 
     //--------------------------------------------------------------------------
     explicit TimecodeEngine(int index, const juce::String& name = {})
@@ -63,8 +68,10 @@ public:
         // Shutdown order: outputs first, then inputs
         stopMtcOutput();
         stopArtnetOutput();
+        stopSacnOutput();
         stopLtcOutput();
         stopHippotizerOutput();
+        stopOscTimecodeOutput();
         stopThruOutput();
         stopMtcInput();
         stopArtnetInput();
@@ -258,6 +265,8 @@ public:
     bool isOutputTcnetEnabled() const   { return outputTcnetEnabled; }
     void setOutputHippoEnabled(bool e)  { outputHippoEnabled = e; }
     bool isOutputHippoEnabled() const   { return outputHippoEnabled; }
+    void setOutputOscTcEnabled(bool e)  { outputOscTcEnabled = e; }
+    bool isOutputOscTcEnabled() const   { return outputOscTcEnabled; }
     void setTcnetLayer(int l)           { tcnetLayer = juce::jlimit(0, 3, l); }
     int  getTcnetLayer() const          { return tcnetLayer; }
 
@@ -305,6 +314,8 @@ public:
     MtcOutput&    getMtcOutput()    { return mtcOutput; }
     ArtnetInput&  getArtnetInput()  { return artnetInput; }
     ArtnetOutput& getArtnetOutput() { return artnetOutput; }
+    SacnOutput&   getSacnOutput()   { return sacnOutput; }
+    void setArtnetDiscovery(ArtnetDiscovery* d) { artnetOutput.setDiscovery(d); artnetInput.setDiscovery(d); }
     LtcInput&     getLtcInput()     { return ltcInput; }
     LtcOutput&    getLtcOutput()    { return ltcOutput; }
     ProDJLinkInput& getProDJLinkInput()   { jassert(sharedProDJLink != nullptr); return *sharedProDJLink; }
@@ -436,8 +447,7 @@ public:
         cachedTrackArtist.clear();
         cachedTrackTitle.clear();
         cachedTrackDurationSec = 0;
-        armedCues.clear();
-        lastCueCheckMs = 0;
+        timeline.clear();
         pll.reset(); clearBeatGrid(); pdlTcFrozen = false; pdlLastPlayheadMs = 0; pdlLastAbsPosTs = 0.0;
         pdlSnapMs = 0.0; pdlSnapTime = 0.0; pdlSnapSpeed = 1.0;
         ltcOutput.setPitchMultiplier(1.0);
@@ -537,6 +547,7 @@ public:
     //==========================================================================
     HippotizerInput& getHippotizerInput() { return hippotizerInput; }
     HippotizerOutput& getHippotizerOutput() { return hippotizerOutput; }
+    OscTimecodeOutput& getOscTimecodeOutput() { return oscTcOutput; }
 
     bool startHippotizerInput(int interfaceIndex = 0, int port = 6091)
     {
@@ -573,6 +584,15 @@ public:
         }
     }
 
+    /// Set the TrackBindings pointer (owned by AppSettings).  Lets a track
+    /// change apply its TrackMap entry before the metadata query returns.
+    void setTrackBindings(TrackBindings* bindings)
+    {
+        trackBindingsPtr = bindings;
+        trackFromBinding = false;
+        cachedBindingSource.clear();
+    }
+
     void setMixerMap(MixerMap* map)
     {
         mixerMapPtr = map;
@@ -716,23 +736,14 @@ public:
     NextCueInfo getNextCueInfo() const
     {
         NextCueInfo info;
-        if (armedCues.empty()) return info;
-
-        uint32_t playhead = lastCueCheckMs;  // last known playhead position
-
-        // armedCues is sorted by positionMs -- find the first unfired cue
-        for (const auto& ac : armedCues)
+        if (const auto* cue = timeline.getNextCue())
         {
-            if (!ac.fired)
-            {
-                info.valid       = true;
-                info.name        = ac.cue.name;
-                info.positionMs  = ac.cue.positionMs;
-                info.remainingMs = (int32_t)ac.cue.positionMs - (int32_t)playhead;
-                return info;
-            }
+            info.valid       = true;
+            info.name        = cue->name;
+            info.positionMs  = cue->positionMs;
+            info.remainingMs = (int32_t)cue->positionMs - (int32_t)timeline.getPositionMs();
         }
-        return info;  // all cues fired
+        return info;  // invalid = no cues or all passed
     }
 
     /// Force a re-lookup of the current track (e.g., after editing TrackMap)
@@ -741,16 +752,9 @@ public:
         if (!trackMapPtr || cachedTrackTitle.isEmpty()) return;
         const auto* entry = lookupTrackInMap();
         // Reload cue points (user may have added/edited/deleted cues).
-        // Preserve playhead position so cues behind the current playhead
-        // are marked as already fired (don't re-trigger on edit).
-        uint32_t savedPlayhead = lastCueCheckMs;
-        loadCuePointsForTrack(entry);
-        if (savedPlayhead > 0)
-        {
-            for (auto& ac : armedCues)
-                ac.fired = (ac.cue.positionMs < savedPlayhead);
-            lastCueCheckMs = savedPlayhead;
-        }
+        // The timeline keeps its playhead, so cues behind it count as
+        // already passed (don't re-trigger on edit).
+        loadCuePointsForTrack(entry, true);
     }
 
     /// Re-request metadata for the current track (used when waveform data
@@ -811,6 +815,25 @@ public:
 
     void stopArtnetOutput() { artnetOutput.stop(); artnetOutStatusText = ""; }
 
+    /// sACN (E1.31) DMX sender for triggers / mixer forward.  Independent of
+    /// the Art-Net timecode output; interfaceIndex as for startArtnetOutput.
+    bool startSacnOutput(int interfaceIndex)
+    {
+        stopSacnOutput();
+        sacnOutput.refreshNetworkInterfaces();
+        sacnOutput.setSourceName("Super Timecode Converter - " + engineName);
+        if (sacnOutput.start(interfaceIndex))
+        {
+            sacnOutStatusText = "sACN TX: multicast:" + juce::String(SacnOutput::kPort)
+                + " (priority " + juce::String(sacnOutput.getPriority()) + ")";
+            return true;
+        }
+        sacnOutStatusText = "sACN FAILED TO BIND";
+        return false;
+    }
+
+    void stopSacnOutput() { sacnOutput.stop(); sacnOutStatusText = ""; }
+
     bool startLtcOutput(const juce::String& typeName, const juce::String& devName,
                         int channel, double sampleRate = 0, int bufferSize = 0)
     {
@@ -855,6 +878,37 @@ public:
 
     void stopHippotizerOutput() { hippotizerOutput.stop(); hippoOutStatusText = ""; }
 
+    /// OSC timecode stream.  Address is /stc/<engine number>/tc so several
+    /// engines can share one receiver port.  Destination and rate are kept
+    /// here (persisted per engine) and applied on the next start.
+    void setOscTcConfig(const juce::String& ip, int port, int rateHz, bool timetags)
+    {
+        oscTcDestIp   = ip.isNotEmpty() ? ip : juce::String("127.0.0.1");
+        oscTcDestPort = juce::jlimit(1, 65535, port);
+        oscTcOutput.setRateHz(rateHz);
+        oscTcOutput.setTimetagsEnabled(timetags);
+    }
+    juce::String getOscTcDestIp() const { return oscTcDestIp; }
+    int  getOscTcDestPort() const       { return oscTcDestPort; }
+    int  getOscTcRateHz() const         { return oscTcOutput.getRateHz(); }
+    bool isOscTcTimetagsEnabled() const { return oscTcOutput.isTimetagsEnabled(); }
+
+    bool startOscTimecodeOutput()
+    {
+        stopOscTimecodeOutput();
+        oscTcOutput.setAddress("/stc/" + juce::String(engineIndex + 1) + "/tc");
+        if (oscTcOutput.start(oscTcDestIp, oscTcDestPort))
+        {
+            oscTcOutStatusText = "TX: " + oscTcOutput.getDestination()
+                               + " @ " + juce::String(oscTcOutput.getRateHz()) + " Hz";
+            return true;
+        }
+        oscTcOutStatusText = "FAILED TO BIND";
+        return false;
+    }
+
+    void stopOscTimecodeOutput() { oscTcOutput.stop(); oscTcOutStatusText = ""; }
+
     bool startThruOutput(const juce::String& typeName, const juce::String& devName,
                          int channel, double sampleRate = 0, int bufferSize = 0)
     {
@@ -1032,8 +1086,8 @@ public:
                     );
 
                     // Beat grid micro-correction: nudge PLL toward nearest beat
-                    if (!pdlBeatGrid.empty())
-                        pll.beatGridCorrect(pdlBeatGrid);
+                    if (timeline.hasBeats())
+                        pll.beatGridCorrect(timeline);
 
                     // Smooth timecode display using interpolation between CDJ packets.
                     uint32_t rawPlayheadMs = sharedProDJLink->getPlayheadMs(ep);
@@ -1045,11 +1099,11 @@ public:
                     // beat grid.  This handles variable-BPM tracks and non-zero
                     // first-beat offsets that the simple formula misses.
                     // CDJ-3000 already provides precise ms via abspos packets.
-                    if (!hasAbs && !pdlBeatGrid.empty())
+                    if (!hasAbs && timeline.hasBeats())
                     {
                         uint32_t bc = sharedProDJLink->getBeatCount(ep);
-                        if (bc > 0 && bc <= (uint32_t)pdlBeatGrid.size())
-                            rawPlayheadMs = pdlBeatGrid[(size_t)(bc - 1)].timeMs;
+                        if (bc > 0 && bc <= (uint32_t)timeline.getNumBeats())
+                            rawPlayheadMs = timeline.getBeat(bc - 1).timeMs;
                     }
 
                     // Detect new data from the CDJ.
@@ -1198,6 +1252,13 @@ public:
                             cachedTrackTitle  = tinfo.title;
                             cachedTrackDurationSec = (int)sharedProDJLink->getTrackLengthSec(ep);
 
+                            // Known track reference: use the metadata resolved
+                            // last time until dbserver confirms it (below)
+                            cachedBindingSource = proDJLinkBindingSource(ep, newId);
+                            trackFromBinding = false;
+                            if (cachedTrackTitle.startsWith("Track #"))
+                                applyTrackBinding();
+
                             DBG("TimecodeEngine: track changed -- "
                                 + cachedTrackArtist + " - " + cachedTrackTitle
                                 + " (cdj_id=" + juce::String(newId) + ")"
@@ -1225,13 +1286,28 @@ public:
                     // When "Track #12345" resolves to real artist/title, update cache
                     // and re-run TrackMap lookup (the first attempt on track change would
                     // have failed because we didn't have real metadata yet).
+                    // A track applied from its binding is verified the same way.
                     if (dbClient != nullptr && cachedTrackId != 0
-                        && cachedTrackTitle.startsWith("Track #"))
+                        && (cachedTrackTitle.startsWith("Track #") || trackFromBinding))
                     {
                         auto meta = dbClient->getCachedMetadataLightById(cachedTrackId);
                         if (meta.isValid() && meta.title.isNotEmpty())
                         {
-                            if (meta.artist.isNotEmpty()) cachedTrackArtist = meta.artist;
+                            // Keep the artist only across a "Track #" placeholder; a
+                            // binding's artist belongs to the guess being verified
+                            const bool placeholder = cachedTrackTitle.startsWith("Track #");
+                            const auto newArtist = (meta.artist.isEmpty() && placeholder)
+                                                       ? cachedTrackArtist : meta.artist;
+                            const bool confirmed = trackFromBinding
+                                && TrackMapEntry::makeKey(newArtist, meta.title)
+                                   == TrackMapEntry::makeKey(cachedTrackArtist, cachedTrackTitle);
+
+                            // Another stick in the same slot reuses the IDs
+                            if (trackFromBinding && !confirmed && trackBindingsPtr != nullptr)
+                                trackBindingsPtr->forgetPrefix(cachedBindingSource.upToLastOccurrenceOf("|", true, false));
+                            trackFromBinding = false;
+
+                            cachedTrackArtist = newArtist;
                             cachedTrackTitle  = meta.title;
                             if (meta.durationSeconds > 0)
                             {
@@ -1240,11 +1316,16 @@ public:
                                     sharedProDJLink->setTrackLengthSec(ep,
                                         (uint32_t)meta.durationSeconds);
                             }
+                            learnTrackBinding();
 
                             // NOW we have real artist+title -- do the TrackMap lookup
-                            const auto* entry = lookupTrackInMap();
-                            fireTrackTrigger(entry);
-                            loadCuePointsForTrack(entry);
+                            // (already done on the first packet if the binding held)
+                            if (!confirmed)
+                            {
+                                const auto* entry = lookupTrackInMap();
+                                fireTrackTrigger(entry);
+                                loadCuePointsForTrack(entry);
+                            }
                         }
                     }
 
@@ -1275,14 +1356,7 @@ public:
                         {
                             cachedTrackDurationSec = nowDur;
                             const auto* entry = lookupTrackInMap();
-                            uint32_t savedPlayhead = lastCueCheckMs;
-                            loadCuePointsForTrack(entry);
-                            if (savedPlayhead > 0)
-                            {
-                                for (auto& ac : armedCues)
-                                    ac.fired = (ac.cue.positionMs < savedPlayhead);
-                                lastCueCheckMs = savedPlayhead;
-                            }
+                            loadCuePointsForTrack(entry, true);
                         }
                     }
 
@@ -1303,7 +1377,7 @@ public:
                     if (sharedProDJLink->isPlayerPlaying(ep))
                         tickCuePoints(rawPlayheadMs);
                     else
-                        lastCueCheckMs = rawPlayheadMs;  // track position so seek detection stays correct
+                        timeline.moveTo(rawPlayheadMs);  // track position so seek detection stays correct
 
                     bool pdlRx = sharedProDJLink->isReceiving();
                     if (statusTextVisible)
@@ -1500,13 +1574,64 @@ public:
                     ltcOutput.setPitchMultiplier(pll.pitch);
 
                     // --- Track change detection ---
+                    // TrackNetworkPath can arrive before the names; a known
+                    // path applies its binding without waiting for them.
                     uint32_t slqTrackVer = sharedStageLinQ->getTrackVersion(ep);
-                    if (slqTrackVer != lastSeenTrackVersion)
+                    const auto slqSource = TrackBindings::stageLinQSource(
+                        sharedStageLinQ->getTrackNetworkPath(ep));
+                    const bool slqVersionChanged = slqTrackVer != lastSeenTrackVersion;
+                    const bool slqPathChanged = slqSource.isNotEmpty() && slqSource != cachedBindingSource;
+                    if (slqSource.isEmpty())
+                        cachedBindingSource.clear();   // deck unloaded
+
+                    if (slqVersionChanged || slqPathChanged)
                     {
                         lastSeenTrackVersion = slqTrackVer;
+                        if (slqPathChanged) cachedBindingSource = slqSource;
+                        slqBindingLearnMs = juce::Time::getMillisecondCounterHiRes() + kSlqBindingSettleMs;
+
                         auto tinfo = sharedStageLinQ->getTrackInfo(ep);
-                        if (tinfo.artist.isNotEmpty() || tinfo.title.isNotEmpty())
+                        const auto* bound = (slqPathChanged && trackBindingsPtr != nullptr)
+                                                ? trackBindingsPtr->find(slqSource) : nullptr;
+
+                        if (trackFromBinding && tinfo.title.isNotEmpty()
+                            && TrackMapEntry::makeKey(tinfo.artist, tinfo.title)
+                               == TrackMapEntry::makeKey(cachedTrackArtist, cachedTrackTitle))
+                        {
+                            // The names confirm the binding already applied
+                            trackFromBinding = false;
+                        }
+                        else if (bound != nullptr
+                                 && (!slqVersionChanged || (tinfo.artist.isEmpty() && tinfo.title.isEmpty()))
+                                 && TrackMapEntry::makeKey(bound->artist, bound->title)
+                                    != TrackMapEntry::makeKey(cachedTrackArtist, cachedTrackTitle))
                         {
+                            const int prevDurationSec = cachedTrackDurationSec;
+                            cachedTrackDurationSec = (int)sharedStageLinQ->getTrackLengthSec(ep);
+                            if (applyTrackBinding())
+                            {
+                                cachedTrackId = slqTrackVer;
+
+                                DBG("TimecodeEngine: StageLinQ track bound -- "
+                                    + cachedTrackArtist + " - " + cachedTrackTitle
+                                    + " deck=" + juce::String(ep));
+
+                                const auto* entry = lookupTrackInMap();
+                                bpmPlayerOverride = kBpmNoOverride;
+                                lastSentClockBpm = -1.0f;
+                                lastSentOscBpm   = -1.0f;
+                                fireTrackTrigger(entry);
+                                loadCuePointsForTrack(entry);
+                            }
+                            else
+                            {
+                                cachedTrackDurationSec = prevDurationSec;
+                            }
+                        }
+                        else if (slqVersionChanged
+                                 && (tinfo.artist.isNotEmpty() || tinfo.title.isNotEmpty()))
+                        {
+                            trackFromBinding = false;
                             cachedTrackArtist = tinfo.artist;
                             cachedTrackTitle  = tinfo.title;
                             cachedTrackId = slqTrackVer;  // StageLinQ has no numeric ID; use version
@@ -1525,6 +1650,15 @@ public:
                         }
                     }
 
+                    // Learn the path's names once the StateMap stream has
+                    // settled (path, artist and title arrive in any order)
+                    if (slqBindingLearnMs > 0.0 && !trackFromBinding
+                        && juce::Time::getMillisecondCounterHiRes() >= slqBindingLearnMs)
+                    {
+                        slqBindingLearnMs = 0.0;
+                        learnTrackBinding();
+                    }
+
                     // Persist auto-filled metadata
                     if (trackMapDirty && trackMapPtr != nullptr)
                     {
@@ -1542,14 +1676,7 @@ public:
                         {
                             cachedTrackDurationSec = nowDur;
                             const auto* entry = lookupTrackInMap();
-                            uint32_t savedPlayhead = lastCueCheckMs;
-                            loadCuePointsForTrack(entry);
-                            if (savedPlayhead > 0)
-                            {
-                                for (auto& ac : armedCues)
-                                    ac.fired = (ac.cue.positionMs < savedPlayhead);
-                                lastCueCheckMs = savedPlayhead;
-                            }
+                            loadCuePointsForTrack(entry, true);
                         }
                     }
 
@@ -1567,7 +1694,7 @@ public:
                     if (sharedStageLinQ->isPlayerPlaying(ep))
                         tickCuePoints(rawPlayheadMs);
                     else
-                        lastCueCheckMs = rawPlayheadMs;
+                        timeline.moveTo(rawPlayheadMs);
 
                     bool slqRx = sharedStageLinQ->isReceiving();
                     if (statusTextVisible)
@@ -1753,8 +1880,37 @@ public:
 
         routeTimecodeToOutputs();
         updateVuMeters();
+
+        // sACN: keep idle (trigger) universes alive, one sync for the tick
+        if (dmxUsesSacn())
+            sacnOutput.endFrame();
+
+        publishDisplaySnapshot();
     }
 
+    //==========================================================================
+    // Display snapshot -- the per-frame values the main window shows, taken
+    // at the end of each tick() so a frame never mixes two ticks (see
+    // DisplaySnapshot.h).  Same units as the matching getters.
+    //==========================================================================
+    struct DisplaySnapshot
+    {
+        uint32_t    version = 0;
+        InputSource activeInput = InputSource::SystemTime;
+        bool        sourceActive = false, fpsConvertEnabled = false;
+        Timecode    currentTimecode, outputTimecode;
+        FrameRate   currentFps = FrameRate::FPS_30, outputFps = FrameRate::FPS_30;
+        int         effectivePlayer = 0, effectiveBpmMultiplier = 0;
+        float       playPositionRatio = 0.0f;
+        float       ltcInLevel = 0.0f, thruInLevel = 0.0f, ltcOutLevel = 0.0f, thruOutLevel = 0.0f;
+        bool        audioBpmRunning = false;
+        float       audioBpmPeakLevel = 0.0f;
+        double      audioBpm = 0.0, audioBpmConfidence = 0.0;
+    };
+
+    /// Message thread only (see DisplaySnapshot.h); compare `version` to skip work.
+    const DisplaySnapshot& getDisplaySnapshot() { return displaySnapshots.read(); }
+
     //==========================================================================
     // Status text (read by MainComponent for UI)
     //==========================================================================
@@ -1764,6 +1920,8 @@ public:
     juce::String getLtcOutStatusText() const { return ltcOutStatusText; }
     juce::String getThruOutStatusText() const { return thruOutStatusText; }
     juce::String getHippoOutStatusText() const { return hippoOutStatusText; }
+    juce::String getOscTcOutStatusText() const { return oscTcOutStatusText; }
+    juce::String getSacnOutStatusText() const { return sacnOutStatusText; }
 
     /// Only the currently displayed engine needs to build status text strings.
     /// Call with true for the selected engine, false for background engines.
@@ -1956,6 +2114,9 @@ private:
     bool outputThruEnabled   = false;
     bool outputTcnetEnabled  = false;
     bool outputHippoEnabled  = false;
+    bool outputOscTcEnabled  = false;
+    juce::String oscTcDestIp = "127.0.0.1";
+    int  oscTcDestPort       = OscTimecodeOutput::kDefaultPort;
     int  tcnetLayer          = 0;      // TCNet layer index 0-3
 
     // On-air gate: when enabled, the engine only produces active timecode
@@ -1974,8 +2135,10 @@ private:
     MtcOutput    mtcOutput;
     ArtnetInput  artnetInput;
     ArtnetOutput artnetOutput;
+    SacnOutput   sacnOutput;
     HippotizerInput hippotizerInput;
     HippotizerOutput hippotizerOutput;
+    OscTimecodeOutput oscTcOutput;
     LtcInput     ltcInput;
     LtcOutput    ltcOutput;
     ProDJLinkInput* sharedProDJLink = nullptr;  // shared across engines
@@ -2133,8 +2296,7 @@ private:
         cachedOffH = cachedOffM = cachedOffS = cachedOffF = 0;
         cachedBpmMultiplier = 0;
         lastSeenTrackVersion = 0;
-        armedCues.clear();
-        lastCueCheckMs = 0;
+        timeline.clear();
         lastSentClockBpm = -1.0f;
         lastSentOscBpm   = -1.0f;
         bpmPlayerOverride = kBpmNoOverride;
@@ -2322,30 +2484,12 @@ private:
         /// When a beat grid is available, nudge the PLL position toward the
         /// nearest beat by a small fraction each tick.  This keeps the LTC
         /// output phase-locked to the musical grid without sudden jumps.
-        void beatGridCorrect(const std::vector<TrackMetadata::BeatEntry>& grid)
+        void beatGridCorrect(const TrackEventTimeline& timeline)
         {
-            if (grid.empty() || !playing || positionMs < 1.0) return;
+            if (!timeline.hasBeats() || !playing || positionMs < 1.0) return;
 
-            // Binary search: find nearest beat to current position
-            uint32_t posMs = (uint32_t)positionMs;
-            int lo = 0, hi = (int)grid.size() - 1, best = 0;
-            while (lo <= hi)
-            {
-                int mid = (lo + hi) / 2;
-                if (grid[(size_t)mid].timeMs <= posMs)
-                    { best = mid; lo = mid + 1; }
-                else
-                    hi = mid - 1;
-            }
-
-            // Check both the beat before and after current position
-            double nearestMs = (double)grid[(size_t)best].timeMs;
-            if (best + 1 < (int)grid.size())
-            {
-                double nextMs = (double)grid[(size_t)(best + 1)].timeMs;
-                if (std::abs(nextMs - positionMs) < std::abs(nearestMs - positionMs))
-                    nearestMs = nextMs;
-            }
+            // Nearest beat, walked from the timeline cursor's current beat
+            double nearestMs = timeline.nearestBeatMs(positionMs);
 
             double beatErr = nearestMs - positionMs;
             double absBeatErr = std::abs(beatErr);
@@ -2374,8 +2518,9 @@ private:
     // Between CDJ abspos packets, the PLL interpolates at constant velocity.
     // Small timing errors accumulate.  When a beat grid is available, the PLL
     // applies a gentle nudge toward the nearest beat position, reducing drift.
-    std::vector<TrackMetadata::BeatEntry> pdlBeatGrid;
+    // The grid itself lives in `timeline` alongside cues and phrases.
     uint32_t pdlBeatGridTrackId = 0;  // track ID for which beat grid is loaded
+    uint32_t pdlPhrasesTrackId  = 0;  // track ID for which song structure is loaded
 
     LinkBridge   linkBridge;
     std::unique_ptr<AudioThru> audioThru;  // Only for primary engine
@@ -2387,11 +2532,15 @@ private:
     // Status
     juce::String inputStatusText = "SYSTEM CLOCK";
     juce::String mtcOutStatusText, artnetOutStatusText, ltcOutStatusText, thruOutStatusText, hippoOutStatusText;
+    juce::String sacnOutStatusText;
+    juce::String oscTcOutStatusText;
     bool statusTextVisible = true;  // only build inputStatusText when engine is displayed
 
     // VU meter smoothed state
     float sLtcIn = 0.0f, sThruIn = 0.0f, sLtcOut = 0.0f, sThruOut = 0.0f;
 
+    SnapshotTripleBuffer<DisplaySnapshot> displaySnapshots;   // see publishDisplaySnapshot()
+
     // TrackMap state (track-to-offset mapping)
     TrackMap* trackMapPtr       = nullptr;
     MixerMap* mixerMapPtr       = nullptr;
@@ -2405,6 +2554,15 @@ private:
     int       cachedOffH = 0, cachedOffM = 0, cachedOffS = 0, cachedOffF = 0;
     juce::String cachedTrackArtist, cachedTrackTitle;
     int cachedTrackDurationSec = 0;
+    TrackKey cachedTrackKey;                     // normalised once per artist/title change
+    juce::String cachedKeyArtist, cachedKeyTitle;
+
+    // Track bindings (source reference -> metadata resolved last time)
+    TrackBindings* trackBindingsPtr = nullptr;
+    juce::String cachedBindingSource;            // reference of the current track
+    bool   trackFromBinding  = false;            // cached artist/title not yet confirmed
+    double slqBindingLearnMs = 0.0;              // learn once the StateMap settles
+    static constexpr double kSlqBindingSettleMs = 1000.0;
 
     // Track change triggers
     TriggerOutput triggerOutput;
@@ -2435,18 +2593,14 @@ private:
     int  trigDmxHighWater = 0;
     int  artnetTriggerUniverse = 1;     // default universe 1 (separate from mixer universe 0)
     bool artnetTriggerEnabled = false;  // must be enabled for Art-Net DMX track triggers to fire
-
-    // --- Cue point firing state ---
-    // Armed cue points for the currently loaded track.  Loaded from TrackMap
-    // on track change, sorted by positionMs.  Each has a `fired` flag that is
-    // set when the playhead crosses the cue and reset on track change or seek.
-    struct ArmedCue
-    {
-        CuePoint cue;           // copy of the cue point data (trigger config)
-        bool     fired = false;
-    };
-    std::vector<ArmedCue> armedCues;
-    uint32_t lastCueCheckMs = 0;   // last playhead position used for cue check (seek detection)
+    DmxProtocol dmxProtocol = DmxProtocol::ArtNet;  // transport for trigger + mixer DMX
+
+    // --- Per-track event timeline ---
+    // Cue points (from TrackMap), beat grid and phrase starts (from rekordbox)
+    // for the currently loaded track, compiled into one sorted list with a
+    // playhead cursor.  Cues behind the cursor count as fired; the cursor is
+    // reset on track change and repositioned by binary search on seek.
+    TrackEventTimeline timeline;
     juce::String oscFwdBpmAddr = "/composition/tempocontroller/tempo";
     juce::String oscFwdBpmCmd;  // e.g. "Master 3.x at %BPM%" -- if non-empty, sends string instead of float
     float lastSentOscBpm = -1.0f;      // dedup: last sent OSC value
@@ -2529,15 +2683,29 @@ public:
     /// automatically on track change.
     void setBeatGrid(const std::vector<TrackMetadata::BeatEntry>& grid, uint32_t trackId)
     {
-        if (trackId == pdlBeatGridTrackId && !pdlBeatGrid.empty()) return;
-        pdlBeatGrid = grid;
+        if (trackId == pdlBeatGridTrackId && timeline.hasBeats()) return;
+        timeline.setBeatGrid(grid);
         pdlBeatGridTrackId = trackId;
     }
 
+    /// Set the song structure (phrase analysis).  Phrase starts are resolved
+    /// through the beat grid, so call after setBeatGrid().  Cleared with it.
+    void setSongStructure(const std::vector<TrackMetadata::PhraseEntry>& phrases, uint32_t trackId)
+    {
+        if (trackId == pdlPhrasesTrackId) return;
+        timeline.setPhrases(phrases);
+        pdlPhrasesTrackId = trackId;
+    }
+
+    /// Phrase under the playhead (nullptr if none / no song structure).
+    const TrackMetadata::PhraseEntry* getCurrentPhrase() const { return timeline.getCurrentPhrase(); }
+
     void clearBeatGrid()
     {
-        pdlBeatGrid.clear();
+        timeline.clearBeatGrid();
+        timeline.clearPhrases();
         pdlBeatGridTrackId = 0;
+        pdlPhrasesTrackId = 0;
     }
 
     // Returns the effective multiplier: session override if set, else TrackMap value.
@@ -2627,6 +2795,25 @@ public:
     void setArtnetTriggerEnabled(bool enabled) { artnetTriggerEnabled = enabled; }
     bool isArtnetTriggerEnabled() const        { return artnetTriggerEnabled; }
 
+    // DMX transport for triggers and mixer forward.  Both protocols share the
+    // DMX buffers and the Art-Net port-address (sACN universe = address + 1).
+    void setDmxProtocol(DmxProtocol p) { dmxProtocol = p; lastDmxSendTime = 0.0; }
+    DmxProtocol getDmxProtocol() const { return dmxProtocol; }
+    bool dmxUsesArtnet() const { return dmxProtocol != DmxProtocol::Sacn; }
+    bool dmxUsesSacn()   const { return dmxProtocol != DmxProtocol::ArtNet; }
+
+    void setSacnPriority(int p)      { sacnOutput.setPriority(p); }
+    int  getSacnPriority() const     { return sacnOutput.getPriority(); }
+    void setSacnSyncUniverse(int u)  { sacnOutput.setSyncUniverse(u); }
+    int  getSacnSyncUniverse() const { return sacnOutput.getSyncUniverse(); }
+
+    /// True when at least one selected DMX transport can send.
+    bool isDmxOutputRunning() const
+    {
+        return (dmxUsesArtnet() && artnetOutput.getIsRunning())
+            || (dmxUsesSacn()   && sacnOutput.getIsRunning());
+    }
+
     //----------------------------------------------------------------------
     // Ableton Link -- BPM sync to Link session
     //----------------------------------------------------------------------
@@ -2691,6 +2878,47 @@ private:
         dbClient->requestMetadata(srcIP, slot, 1, trackId, dbCtx, model);
     }
 
+    /// Binding reference for a Pro DJ Link track: the player holding the
+    /// media, its slot and the rekordbox ID (empty if unknown).
+    juce::String proDJLinkBindingSource(int effP, uint32_t trackId) const
+    {
+        if (sharedProDJLink == nullptr || effP < 1 || trackId == 0) return {};
+        int srcPlayer = sharedProDJLink->getLoadedPlayer(effP);
+        if (srcPlayer == 0) srcPlayer = effP;
+        const int slot = sharedProDJLink->getLoadedSlot(effP);
+        if (slot == 0) return {};
+        return TrackBindings::proDJLinkSource(srcPlayer, slot, trackId);
+    }
+
+    /// Takes artist/title/duration from the current track's binding.  A
+    /// binding whose duration contradicts the player's is not used.
+    bool applyTrackBinding()
+    {
+        if (trackBindingsPtr == nullptr) return false;
+        const auto* b = trackBindingsPtr->find(cachedBindingSource);
+        if (b == nullptr) return false;
+        if (cachedTrackDurationSec > 0 && b->durationSec > 0
+            && std::abs(cachedTrackDurationSec - b->durationSec) > 1)
+            return false;
+
+        cachedTrackArtist = b->artist;
+        cachedTrackTitle  = b->title;
+        if (cachedTrackDurationSec == 0) cachedTrackDurationSec = b->durationSec;
+        trackFromBinding = true;
+        return true;
+    }
+
+    /// Records the current (resolved) metadata under the current reference.
+    void learnTrackBinding()
+    {
+        if (trackBindingsPtr == nullptr || cachedBindingSource.isEmpty()
+            || cachedTrackTitle.isEmpty() || cachedTrackTitle.startsWith("Track #"))
+            return;
+        if (trackBindingsPtr->learn(cachedBindingSource, cachedTrackArtist,
+                                    cachedTrackTitle, cachedTrackDurationSec))
+            trackBindingsPtr->save();
+    }
+
     /// Lookup a track in the TrackMap by artist+title and cache the offset values.
     /// Called when a track change is detected or metadata is resolved.
     /// Returns the matched entry pointer (or nullptr if not found/malformed).
@@ -2702,24 +2930,29 @@ private:
             return nullptr;
         }
 
-        auto* entry = trackMapPtr->find(cachedTrackArtist, cachedTrackTitle,
-                                        cachedTrackDurationSec);
-
-        // Duration fallback: when duration resolves late (deferred pickup),
-        // the key changes from "artist|title" to "artist|title|300".  If the
-        // user's entry was saved without duration (legacy or manual add),
-        // the duration-aware lookup misses.  Fall back to duration=0 so we
-        // don't lose the TrackMap match (and its armed cue points).
-        if (!entry && cachedTrackDurationSec > 0)
-            entry = trackMapPtr->find(cachedTrackArtist, cachedTrackTitle, 0);
-
-        // Last resort: ignore duration entirely.  Catches the case where the
-        // entry was saved with a duration that differs from the engine's cached
-        // duration (e.g. PDL View saved with CDJ-reported duration while the
-        // engine's cachedTrackDurationSec was still 0 or stale from an earlier
-        // enrichment pass).
-        if (!entry)
-            entry = trackMapPtr->findIgnoringDuration(cachedTrackArtist, cachedTrackTitle);
+        // Exact duration first, then the duration fallbacks:
+        // - duration resolves late (deferred pickup): the key changes from
+        //   "artist|title" to "artist|title|300".  If the user's entry was
+        //   saved without duration (legacy or manual add), the duration-aware
+        //   lookup misses -- use the duration-less entry so we don't lose the
+        //   TrackMap match (and its armed cue points).
+        // - last resort, any duration: the entry was saved with a duration
+        //   that differs from the engine's cached one (e.g. PDL View saved
+        //   with CDJ-reported duration while cachedTrackDurationSec was still
+        //   0 or stale from an earlier enrichment pass).
+        // - no entry under these tags: the most similar artist+title above
+        //   the auto-match threshold ("feat." credits, punctuation...).
+        // Artist/title are normalised once per track; a late duration only
+        // updates the key's duration.
+        if (cachedTrackKey.isEmpty() || cachedKeyArtist != cachedTrackArtist
+            || cachedKeyTitle != cachedTrackTitle)
+        {
+            cachedTrackKey  = TrackKey::make(cachedTrackArtist, cachedTrackTitle);
+            cachedKeyArtist = cachedTrackArtist;
+            cachedKeyTitle  = cachedTrackTitle;
+        }
+        cachedTrackKey.durationSec = juce::jmax(0, cachedTrackDurationSec);
+        auto* entry = std::as_const(*trackMapPtr).findBestMatchFuzzy(cachedTrackKey);
         if (entry)
         {
             int h, m, s, f;
@@ -2753,6 +2986,16 @@ private:
         }
     }
 
+    /// Send a DMX frame over the selected transport(s).  `universe` is the
+    /// Art-Net port-address (0-32767); sACN sends to universe + 1.
+    void sendDmxFrame(const uint8_t* data, int numChannels, int universe)
+    {
+        if (dmxUsesArtnet())
+            artnetOutput.sendDmxFrame(data, numChannels, universe);
+        if (dmxUsesSacn())
+            sacnOutput.sendDmxFrame(data, numChannels, SacnOutput::universeFromArtnet(universe));
+    }
+
     /// Fire track-change triggers (MIDI/OSC/Art-Net DMX) for a TrackMap entry.
     /// Null-safe: does nothing if entry is nullptr or has no triggers.
     /// Art-Net DMX channel is bounds-checked to [1,512] before buffer access.
@@ -2762,15 +3005,14 @@ private:
 
         triggerOutput.fire(*entry);
 
-        if (artnetTriggerEnabled && entry->hasArtnetTrigger() && artnetOutput.getIsRunning())
+        if (artnetTriggerEnabled && entry->hasArtnetTrigger() && isDmxOutputRunning())
         {
             int ch = entry->artnetCh;
             if (ch > 0 && ch <= 512)
             {
                 trigDmxBuffer[ch - 1] = uint8_t(entry->artnetVal);
                 if (ch > trigDmxHighWater) trigDmxHighWater = ch;
-                artnetOutput.sendDmxFrame(trigDmxBuffer, trigDmxHighWater,
-                                          artnetTriggerUniverse);
+                sendDmxFrame(trigDmxBuffer, trigDmxHighWater, artnetTriggerUniverse);
             }
         }
     }
@@ -2780,80 +3022,59 @@ private:
     //--------------------------------------------------------------------------
 
     /// Load cue points from the TrackMap entry for the current track.
-    /// Called on track change after fireTrackTrigger.  Resets all fired flags.
-    void loadCuePointsForTrack(const TrackMapEntry* entry)
+    /// Called on track change after fireTrackTrigger: the playhead is reset
+    /// so every cue is armed.  With keepPosition (TrackMap edited, deferred
+    /// lookup) the playhead is kept and cues behind it stay passed.
+    void loadCuePointsForTrack(const TrackMapEntry* entry, bool keepPosition = false)
     {
-        armedCues.clear();
-        lastCueCheckMs = 0;
+        if (!keepPosition)
+            timeline.resetPosition();
 
-        if (!entry || entry->cuePoints.empty()) return;
-
-        armedCues.reserve(entry->cuePoints.size());
-        for (auto& cp : entry->cuePoints)
-        {
-            ArmedCue ac;
-            ac.cue = cp;       // copy trigger data
-            ac.fired = false;
-            armedCues.push_back(std::move(ac));
-        }
-        // Guarantee sorted by position
-        std::sort(armedCues.begin(), armedCues.end(),
-                  [](const ArmedCue& a, const ArmedCue& b) {
-                      return a.cue.positionMs < b.cue.positionMs;
-                  });
+        if (entry && !entry->cuePoints.empty())
+            timeline.setCuePoints(entry->cuePoints);
+        else
+            timeline.clearCuePoints();
     }
 
-    /// Check playhead against armed cue points and fire triggers.
-    /// Called from tick() with the current playhead in ms.
-    /// Handles forward playback, seek forward, and seek backward.
+    /// Advance the timeline to the current playhead and fire the triggers of
+    /// cues crossed in forward playback.  Called from tick() while playing.
+    /// Seeks (backward or > 500ms forward) re-position the cursor without
+    /// firing; reverse playback walks it back, re-arming cues it passes.
     void tickCuePoints(uint32_t playheadMs)
     {
-        if (armedCues.empty()) return;
-
-        // Detect seek: playhead jumped backward or jumped forward more than 500ms
-        // beyond what normal playback would produce (60Hz tick = ~17ms advance)
-        bool seekDetected = (playheadMs < lastCueCheckMs)
-                         || (playheadMs > lastCueCheckMs + 500);
-
-        if (seekDetected)
+        if (timeline.isEmpty())
         {
-            // Reset fired flags: un-fire cues that are ahead of new playhead,
-            // mark cues behind new playhead as already fired (don't re-trigger
-            // cues we've passed)
-            for (auto& ac : armedCues)
-                ac.fired = (ac.cue.positionMs < playheadMs);
+            timeline.moveTo(playheadMs);
+            return;
         }
 
-        // Fire cues whose position the playhead has crossed
-        for (auto& ac : armedCues)
-        {
-            if (ac.fired) continue;
-            if (ac.cue.positionMs > playheadMs) break;  // sorted: no more to check
-
-            // Playhead has crossed this cue -- fire it
-            ac.fired = true;
+        timeline.moveTo(playheadMs, timeline.hasCues(),
+            [this, playheadMs](const TrackEventTimeline::Event& ev, TrackEventTimeline::Direction dir)
+            {
+                if (ev.kind != TrackEventTimeline::Kind::Cue
+                    || dir != TrackEventTimeline::Direction::Forward)
+                    return;
 
-            triggerOutput.fireCuePoint(ac.cue);
+                const auto& cue = timeline.getCue(ev.index);
+                triggerOutput.fireCuePoint(cue);
 
-            // Art-Net DMX trigger (same pattern as track change triggers)
-            if (artnetTriggerEnabled && ac.cue.hasArtnetTrigger() && artnetOutput.getIsRunning())
-            {
-                int ch = ac.cue.artnetCh;
-                if (ch > 0 && ch <= 512)
+                // Art-Net DMX trigger (same pattern as track change triggers)
+                if (artnetTriggerEnabled && cue.hasArtnetTrigger() && isDmxOutputRunning())
                 {
-                    trigDmxBuffer[ch - 1] = uint8_t(ac.cue.artnetVal);
-                    if (ch > trigDmxHighWater) trigDmxHighWater = ch;
-                    artnetOutput.sendDmxFrame(trigDmxBuffer, trigDmxHighWater,
-                                              artnetTriggerUniverse);
+                    int ch = cue.artnetCh;
+                    if (ch > 0 && ch <= 512)
+                    {
+                        trigDmxBuffer[ch - 1] = uint8_t(cue.artnetVal);
+                        if (ch > trigDmxHighWater) trigDmxHighWater = ch;
+                        sendDmxFrame(trigDmxBuffer, trigDmxHighWater, artnetTriggerUniverse);
+                    }
                 }
-            }
-
-            DBG("TimecodeEngine: Cue fired '" + ac.cue.name + "' at "
-                + CuePoint::formatPositionMs(ac.cue.positionMs)
-                + " (playhead=" + CuePoint::formatPositionMs(playheadMs) + ")");
-        }
 
-        lastCueCheckMs = playheadMs;
+                DBG("TimecodeEngine: Cue fired '" + cue.name + "' at "
+                    + CuePoint::formatPositionMs(cue.positionMs)
+                    + " (playhead=" + CuePoint::formatPositionMs(playheadMs) + ")");
+                juce::ignoreUnused(playheadMs);
+            });
     }
 
     //--------------------------------------------------------------------------
@@ -2902,7 +3123,7 @@ private:
     {
         if (!sharedProDJLink || !mixerMapPtr) return;
 
-        const bool doArtnet = artnetMixerForwardEnabled && artnetOutput.getIsRunning();
+        const bool doArtnet = artnetMixerForwardEnabled && isDmxOutputRunning();
         bool dmxDirty = false;
 
         // Only iterate mixer values when a new 0x39 packet has arrived.
@@ -2981,7 +3202,7 @@ private:
             double now = juce::Time::getMillisecondCounterHiRes();
             if (dmxDirty || (now - lastDmxSendTime) >= 100.0)
             {
-                artnetOutput.sendDmxFrame(dmxBuffer, dmxHighWaterMark, artnetMixerUniverse);
+                sendDmxFrame(dmxBuffer, dmxHighWaterMark, artnetMixerUniverse);
                 lastDmxSendTime = now;
             }
         }
@@ -3006,7 +3227,7 @@ private:
 
         const bool doOsc    = oscMixerForwardEnabled && triggerOutput.isOscConnected();
         const bool doMidi   = midiMixerForwardEnabled && triggerOutput.isMidiOpen();
-        const bool doArtnet = artnetMixerForwardEnabled && artnetOutput.getIsRunning();
+        const bool doArtnet = artnetMixerForwardEnabled && isDmxOutputRunning();
         if (!doOsc && !doMidi && !doArtnet) return;
 
         bool dmxDirty = false;
@@ -3049,7 +3270,7 @@ private:
             double now = juce::Time::getMillisecondCounterHiRes();
             if (dmxDirty || (now - lastDmxSendTime) >= 100.0)
             {
-                artnetOutput.sendDmxFrame(dmxBuffer, dmxHighWaterMark, artnetMixerUniverse);
+                sendDmxFrame(dmxBuffer, dmxHighWaterMark, artnetMixerUniverse);
                 lastDmxSendTime = now;
             }
         }
@@ -3175,6 +3396,11 @@ private:
         bool wasActive = outputsWereActive;
         outputsWereActive = sourceActive;
 
+        // OSC timecode stream: streams continuously (playing flag carries the
+        // transport state), so it is fed in both branches below.
+        if (outputOscTcEnabled && oscTcOutput.getIsRunning())
+            feedOscTimecodeOutput(baseTc, outRate);
+
         if (sourceActive)
         {
             if (outputMtcEnabled && mtcOutput.getIsRunning())
@@ -3216,6 +3442,8 @@ private:
                     ltcOutput.reseed();
                 if (outputHippoEnabled && hippotizerOutput.getIsRunning())
                     hippotizerOutput.forceResync();
+                if (outputOscTcEnabled && oscTcOutput.getIsRunning())
+                    oscTcOutput.forceResync();
             }
         }
         else
@@ -3245,6 +3473,8 @@ private:
                     hippotizerOutput.setTimecode(baseTc);
                     hippotizerOutput.forceResync();
                 }
+                if (outputOscTcEnabled && oscTcOutput.getIsRunning())
+                    oscTcOutput.forceResync();
             }
 
             // Clear seek flag if it was set during transition to inactive
@@ -3257,6 +3487,42 @@ private:
         }
     }
 
+    /// Position and speed for the OSC stream: DJ sources report the real
+    /// playhead and playback speed, everything else derives ms from the
+    /// timecode at nominal speed.
+    void feedOscTimecodeOutput(const Timecode& tc, FrameRate outRate)
+    {
+        const bool djSource = (activeInput == InputSource::ProDJLink
+                            || activeInput == InputSource::StageLinQ);
+        double posMs = djSource ? (double)getSmoothedPlayheadMs() : timecodeToMs(tc, outRate);
+        double speed = djSource ? pdlSnapSpeed : 1.0;
+        oscTcOutput.setState(tc, outRate, sourceActive, speed, posMs);
+    }
+
+    void publishDisplaySnapshot()
+    {
+        auto& s = displaySnapshots.beginWrite();
+        s.activeInput       = activeInput;
+        s.sourceActive      = sourceActive;
+        s.fpsConvertEnabled = fpsConvertEnabled;
+        s.currentTimecode   = getCurrentTimecode();
+        s.outputTimecode    = outputTimecode;
+        s.currentFps        = currentFps;
+        s.outputFps         = getEffectiveOutputFps();
+        s.effectivePlayer   = getEffectivePlayer();
+        s.effectiveBpmMultiplier = getEffectiveBpmMultiplier();
+        s.playPositionRatio = getSmoothedPlayPositionRatio();
+        s.ltcInLevel   = sLtcIn;
+        s.thruInLevel  = sThruIn;
+        s.ltcOutLevel  = sLtcOut;
+        s.thruOutLevel = sThruOut;
+        s.audioBpmRunning    = isAudioBpmRunning();
+        s.audioBpmPeakLevel  = getAudioBpmPeakLevel();
+        s.audioBpm           = getAudioBpm();
+        s.audioBpmConfidence = getAudioBpmConfidence();
+        displaySnapshots.publish();
+    }
+
     void updateVuMeters()
     {
         auto decayLevel = [](float current, float target, float decay = 0.85f) {
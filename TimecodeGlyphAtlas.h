@@ -0,0 +1,144 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// TimecodeGlyphAtlas -- Pre-rasterised text for the timecode displays.
+//
+// Timecode counters repaint on every frame change (main display plus one
+// mini-strip row per engine).  Drawing them with drawText() creates fonts,
+// shapes glyphs and rasterises outlines on every repaint.  The atlas does
+// that once per font size and display scale:
+//
+//   glyphs : the digits and separators of a bold monospace font, one cell
+//            each in a single alpha-mask image.  drawGlyphs() blits cells.
+//   stamps : any other single-line text (labels, status, info line)
+//            rendered once into an alpha mask exactly as drawText() would
+//            lay it out in a box of the given size.  drawText() blits it.
+//
+// Masks are tinted with the Graphics' current colour when drawn, so one
+// raster serves every colour state.  They are built at physical pixel
+// resolution and drawn 1:1 at device-pixel-snapped positions.
+//
+// Message thread only (paint()).
+
+#pragma once
+#include <JuceHeader.h>
+#include "CustomLookAndFeel.h"   // getMonoFontName(), measureStringWidth()
+#include <map>
+#include <tuple>
+#include <cstring>
+#include <cmath>
+
+class TimecodeGlyphAtlas
+{
+public:
+    /// Characters drawGlyphs() can draw.
+    static constexpr const char* kGlyphs = "0123456789:./-";
+
+    /// Physical pixels per logical pixel of the context about to be drawn
+    /// into (g.getInternalContext().getPhysicalPixelScaleFactor()).
+    /// Drops every raster when it changes (window moved to another display).
+    void setScale(float newScale)
+    {
+        if (newScale <= 0.0f || newScale == scale) return;
+        scale = newScale;
+        glyphFontSize = 0.0f;
+        stamps.clear();
+    }
+
+    /// Bold monospace glyphs of `fontSize`, each centred in a cell of
+    /// cellWidth x cellHeight logical px.  No-op when unchanged.
+    void prepareGlyphs(float fontSize, float cellWidth, float cellHeight)
+    {
+        if (fontSize == glyphFontSize && cellWidth == cellW && cellHeight == cellH)
+            return;
+
+        glyphFontSize = fontSize;
+        cellW = cellWidth;
+        cellH = cellHeight;
+
+        const int pxW = juce::jmax(1, (int)std::ceil(cellW * scale));
+        const int pxH = juce::jmax(1, (int)std::ceil(cellH * scale));
+        const int n = (int)std::strlen(kGlyphs);
+
+        glyphs = juce::Image(juce::Image::SingleChannel, pxW * n, pxH, true);
+        juce::Graphics g(glyphs);
+        g.setColour(juce::Colours::white);
+        g.setFont(juce::Font(juce::FontOptions(getMonoFontName(), fontSize * scale, juce::Font::bold)));
+        for (int i = 0; i < n; ++i)
+        {
+            const juce::Rectangle<int> cell(i * pxW, 0, pxW, pxH);
+            g.drawText(juce::String::charToString((juce::juce_wchar)kGlyphs[i]), cell,
+                       juce::Justification::centred, false);
+            cells[i] = glyphs.getClippedImage(cell);
+        }
+    }
+
+    /// Draws `text` one cell per character from (x, y) in the current
+    /// colour.  Characters outside kGlyphs leave their cell empty.
+    void drawGlyphs(juce::Graphics& g, const char* text, float x, float y) const
+    {
+        if (!glyphs.isValid()) return;
+        const float w = (float)cells[0].getWidth() / scale;
+        const float h = (float)cells[0].getHeight() / scale;
+        y = snap(y);
+        for (; *text != 0; ++text, x += cellW)
+        {
+            const char* p = std::strchr(kGlyphs, *text);
+            if (p == nullptr) continue;
+            g.drawImage(cells[p - kGlyphs], { snap(x), y, w, h },
+                        juce::RectanglePlacement::stretchToFit, true);
+        }
+    }
+
+    /// Same result as g.drawText(text, area, justification) with a mono
+    /// font of `fontSize`, from a cached raster.
+    void drawText(juce::Graphics& g, const juce::String& text, float fontSize, bool bold,
+                  juce::Rectangle<float> area, juce::Justification justification)
+    {
+        if (text.isEmpty() || area.isEmpty()) return;
+
+        const StampKey key { text, fontSize, bold, area.getWidth(), area.getHeight(),
+                             justification.getFlags() };
+        auto it = stamps.find(key);
+        if (it == stamps.end())
+        {
+            if (stamps.size() >= kMaxStamps)
+                stamps.clear();   // source names / labels change rarely; just start over
+
+            const int pxW = juce::jmax(1, (int)std::ceil(area.getWidth()  * scale));
+            const int pxH = juce::jmax(1, (int)std::ceil(area.getHeight() * scale));
+            juce::Image mask(juce::Image::SingleChannel, pxW, pxH, true);
+            juce::Graphics sg(mask);
+            sg.setColour(juce::Colours::white);
+            sg.setFont(juce::Font(juce::FontOptions(getMonoFontName(), fontSize * scale,
+                                                    bold ? juce::Font::bold : juce::Font::plain)));
+            sg.drawText(text, juce::Rectangle<float>(0.0f, 0.0f, area.getWidth() * scale,
+                                                     area.getHeight() * scale),
+                        justification, true);
+            it = stamps.emplace(key, mask).first;
+        }
+
+        const auto& mask = it->second;
+        g.drawImage(mask, { snap(area.getX()), snap(area.getY()),
+                            (float)mask.getWidth() / scale, (float)mask.getHeight() / scale },
+                    juce::RectanglePlacement::stretchToFit, true);
+    }
+
+private:
+    static constexpr size_t kMaxStamps = 96;
+
+    float snap(float v) const { return std::round(v * scale) / scale; }
+
+    using StampKey = std::tuple<juce::String, float, bool, float, float, int>;
+
+    float scale = 1.0f;
+
+    float glyphFontSize = 0.0f, cellW = 0.0f, cellH = 0.0f;
+    juce::Image glyphs;
+    juce::Image cells[14];   // std::strlen(kGlyphs)
+
+    std::map<StampKey, juce::Image> stamps;
+
+    JUCE_LEAK_DETECTOR(TimecodeGlyphAtlas)
+};
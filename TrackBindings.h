@@ -0,0 +1,216 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// TrackBindings -- Remembers which track a player's track reference is.
+//
+// TrackMap entries are keyed by artist + title, which a CDJ only reveals
+// after a dbserver round trip ("Track #12345" until then) -- hundreds of
+// milliseconds to seconds on a cold load, during which the wrong offset
+// (or none) goes out.  The player does report the rekordbox track ID, the
+// slot and the player holding the media in its very first status packet.
+//
+// This table maps such a source reference to the artist / title / duration
+// metadata resolved for it last time:
+//
+//   pdl|<source player>|<slot>|<rekordbox id>   Pro DJ Link
+//   slq|<TrackNetworkPath>                       StageLinQ (Engine DJ)
+//
+// The engine applies a binding as soon as the track changes and keeps
+// polling for the real metadata.  If it confirms the binding nothing else
+// happens; if not (rekordbox IDs are only unique per export, so another
+// USB stick in the same slot reuses them) the engine switches to the real
+// track and forgets every binding of that slot via forgetPrefix().
+//
+// Persisted to trackbindings.json through SettingsWriter.  Least recently
+// confirmed bindings are dropped beyond kMaxBindings.
+//
+// Message thread only.
+
+#pragma once
+#include <JuceHeader.h>
+#include "SettingsWriter.h"
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+class TrackBindings
+{
+public:
+    static constexpr size_t kMaxBindings = 20000;
+
+    struct Binding
+    {
+        juce::String artist;
+        juce::String title;
+        int durationSec = 0;
+        uint32_t lastUsed = 0;   // learn() sequence, for eviction
+    };
+
+    //==========================================================================
+    // Source references
+    //==========================================================================
+
+    static juce::String proDJLinkSource(int sourcePlayer, int slot, uint32_t trackId)
+    {
+        return proDJLinkMedia(sourcePlayer, slot) + juce::String(trackId);
+    }
+
+    /// Prefix shared by every track on the media in a player's slot
+    static juce::String proDJLinkMedia(int sourcePlayer, int slot)
+    {
+        return "pdl|" + juce::String(sourcePlayer) + "|" + juce::String(slot) + "|";
+    }
+
+    static juce::String stageLinQSource(const juce::String& networkPath)
+    {
+        return networkPath.isEmpty() ? juce::String() : "slq|" + networkPath;
+    }
+
+    //==========================================================================
+    // Lookup / learning
+    //==========================================================================
+
+    const Binding* find(const juce::String& source) const
+    {
+        if (source.isEmpty()) return nullptr;
+        auto it = bindings.find(source.toStdString());
+        return it != bindings.end() ? &it->second : nullptr;
+    }
+
+    /// Records the metadata resolved for `source`.  Returns true when the
+    /// table changed and needs saving (a confirmation only refreshes the
+    /// eviction order, which is saved along with the next change).
+    bool learn(const juce::String& source, const juce::String& artist,
+               const juce::String& title, int durationSec)
+    {
+        if (source.isEmpty() || title.isEmpty()) return false;
+
+        auto& b = bindings[source.toStdString()];
+        b.lastUsed = ++useCounter;
+        if (b.artist == artist && b.title == title
+            && (durationSec <= 0 || b.durationSec == durationSec))
+            return false;
+
+        b.artist = artist;
+        b.title  = title;
+        if (durationSec > 0) b.durationSec = durationSec;
+
+        if (bindings.size() > kMaxBindings)
+            evictOldest();
+        return true;
+    }
+
+    /// Drops every binding whose source starts with `prefix`.  Returns the
+    /// number removed.
+    int forgetPrefix(const juce::String& prefix)
+    {
+        if (prefix.isEmpty()) return 0;
+        const auto p = prefix.toStdString();
+        int removed = 0;
+        for (auto it = bindings.begin(); it != bindings.end();)
+        {
+            if (it->first.compare(0, p.size(), p) == 0) { it = bindings.erase(it); ++removed; }
+            else ++it;
+        }
+        return removed;
+    }
+
+    /// Calls fn(const Binding&) for every binding
+    template <typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        for (auto& [source, b] : bindings)
+            fn(b);
+    }
+
+    void clear() { bindings.clear(); }
+    size_t size() const { return bindings.size(); }
+
+    //==========================================================================
+    // Persistence
+    //==========================================================================
+
+    static juce::File getFile()
+    {
+        auto dir = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+                       .getChildFile("SuperTimecodeConverter");
+        dir.createDirectory();
+        return dir.getChildFile("trackbindings.json");
+    }
+
+    void save() const
+    {
+        juce::Array<juce::var> arr;
+        arr.ensureStorageAllocated((int)bindings.size());
+        for (auto& [source, b] : bindings)
+        {
+            auto* o = new juce::DynamicObject();
+            o->setProperty("source", juce::String(source));
+            o->setProperty("artist", b.artist);
+            o->setProperty("title", b.title);
+            if (b.durationSec > 0) o->setProperty("durationSec", b.durationSec);
+            o->setProperty("used", (juce::int64)b.lastUsed);
+            arr.add(juce::var(o));
+        }
+
+        auto* root = new juce::DynamicObject();
+        root->setProperty("version", 1);
+        root->setProperty("bindings", arr);
+        juce::SharedResourcePointer<SettingsWriter>()->write(getFile(), juce::var(root));
+    }
+
+    bool load()
+    {
+        bindings.clear();
+        useCounter = 0;
+
+        auto file = getFile();
+        if (!file.existsAsFile()) return false;
+
+        auto parsed = juce::JSON::parse(file.loadFileAsString());
+        auto* arr = parsed.getProperty("bindings", {}).getArray();
+        if (arr == nullptr) return false;
+
+        for (auto& item : *arr)
+        {
+            const auto source = item.getProperty("source", {}).toString();
+            Binding b;
+            b.artist      = item.getProperty("artist", {}).toString();
+            b.title       = item.getProperty("title", {}).toString();
+            b.durationSec = juce::jmax(0, (int)item.getProperty("durationSec", 0));
+            b.lastUsed    = (uint32_t)(juce::int64)item.getProperty("used", 0);
+            if (source.isEmpty() || b.title.isEmpty()) continue;
+
+            useCounter = juce::jmax(useCounter, b.lastUsed);
+            bindings[source.toStdString()] = std::move(b);
+        }
+        return true;
+    }
+
+private:
+    /// Drops the least recently used tenth of the table
+    void evictOldest()
+    {
+        std::vector<uint32_t> used;
+        used.reserve(bindings.size());
+        for (auto& [source, b] : bindings)
+            used.push_back(b.lastUsed);
+
+        const size_t drop = bindings.size() - kMaxBindings + kMaxBindings / 10;
+        std::nth_element(used.begin(), used.begin() + (std::ptrdiff_t)(drop - 1), used.end());
+        const uint32_t cutoff = used[drop - 1];
+
+        for (auto it = bindings.begin(); it != bindings.end();)
+        {
+            if (it->second.lastUsed <= cutoff) it = bindings.erase(it);
+            else ++it;
+        }
+    }
+
+    std::unordered_map<std::string, Binding> bindings;
+    uint32_t useCounter = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TrackBindings)
+};
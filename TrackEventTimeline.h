@@ -0,0 +1,299 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+
+#pragma once
+#include <JuceHeader.h>
+#include "DbServerClient.h"
+#include "AppSettings.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+//==============================================================================
+// TrackEventTimeline -- every time-based event of the loaded track compiled
+// into one sorted list, walked by a single playhead cursor.
+//
+// Sources (any may be empty, each can be replaced independently):
+//   - Cue points      (TrackMap entry)        -> Kind::Cue
+//   - Beat grid       (rekordbox PQTZ)        -> Kind::Beat
+//   - Phrase starts   (rekordbox PSSI, beat-resolved to ms) -> Kind::Phrase
+//
+// The cursor is the number of events whose time is behind the playhead.
+// moveTo() walks it event-by-event for normal forward or reverse playback
+// (amortised O(1) per tick) and falls back to a binary search when the
+// playhead jumps (seek, hot cue, loop).  Events crossed while walking are
+// reported to the caller with their direction; jumps report nothing, so
+// cues behind a seek target count as already passed and cues ahead are
+// re-armed -- the same semantics as the old per-cue fired flags.
+//
+// Message thread only (owned by TimecodeEngine).
+//==============================================================================
+class TrackEventTimeline
+{
+public:
+    enum class Kind : uint8_t { Beat = 0, Phrase, Cue };   // tie order at equal time
+    enum class Direction : uint8_t { Forward, Reverse };
+
+    struct Event
+    {
+        uint32_t timeMs;
+        Kind     kind;
+        uint32_t index;     // into cues / beats / phrases
+    };
+
+    /// Jumps larger than this (either direction) are treated as seeks.
+    static constexpr uint32_t kMaxWalkMs = 500;
+
+    //--------------------------------------------------------------------------
+    // Sources -- each setter recompiles and restores the cursor position
+    // without reporting events.
+    //--------------------------------------------------------------------------
+    void setCuePoints(const std::vector<CuePoint>& cuePoints)
+    {
+        cues = cuePoints;
+        compile();
+    }
+
+    void setBeatGrid(const std::vector<TrackMetadata::BeatEntry>& grid)
+    {
+        beats = grid;
+        compile();
+    }
+
+    void setPhrases(const std::vector<TrackMetadata::PhraseEntry>& songStructure)
+    {
+        phrases = songStructure;
+        compile();
+    }
+
+    void clearCuePoints()   { if (!cues.empty())    { cues.clear();    compile(); } }
+    void clearBeatGrid()    { if (!beats.empty())   { beats.clear();   compile(); } }
+    void clearPhrases()     { if (!phrases.empty()) { phrases.clear(); compile(); } }
+
+    void clear()
+    {
+        cues.clear(); beats.clear(); phrases.clear();
+        compile();
+        resetPosition();
+    }
+
+    /// Forget the playhead: next moveTo() starts from the track start.
+    void resetPosition()
+    {
+        positionMs = 0;
+        cursor = 0;
+        curBeat = curPhrase = -1;
+    }
+
+    //--------------------------------------------------------------------------
+    // Cursor
+    //--------------------------------------------------------------------------
+
+    /// Move the playhead.  When `report` is true, events crossed by a normal
+    /// playback step are passed to onEvent(const Event&, Direction).
+    template <typename Fn>
+    void moveTo(uint32_t newPosMs, bool report, Fn&& onEvent)
+    {
+        if (newPosMs == positionMs) return;
+
+        const bool forward = newPosMs > positionMs;
+        const uint32_t dist = forward ? newPosMs - positionMs : positionMs - newPosMs;
+        positionMs = newPosMs;
+
+        if (dist > kMaxWalkMs)
+        {
+            seekCursor();
+            return;
+        }
+
+        if (forward)
+        {
+            while (cursor < events.size() && events[cursor].timeMs <= newPosMs)
+            {
+                const auto& ev = events[cursor++];
+                noteCrossed(ev, Direction::Forward);
+                if (report) onEvent(ev, Direction::Forward);
+            }
+        }
+        else
+        {
+            while (cursor > 0 && events[cursor - 1].timeMs > newPosMs)
+            {
+                const auto& ev = events[--cursor];
+                noteCrossed(ev, Direction::Reverse);
+                if (report) onEvent(ev, Direction::Reverse);
+            }
+        }
+    }
+
+    /// Move without reporting (scrub, cue preview, paused).
+    void moveTo(uint32_t newPosMs)
+    {
+        moveTo(newPosMs, false, [](const Event&, Direction) {});
+    }
+
+    /// Jump straight to a position (binary search, nothing reported).
+    void seek(uint32_t newPosMs)
+    {
+        positionMs = newPosMs;
+        seekCursor();
+    }
+
+    uint32_t getPositionMs() const { return positionMs; }
+
+    //--------------------------------------------------------------------------
+    // Queries
+    //--------------------------------------------------------------------------
+    bool hasCues()   const { return !cues.empty(); }
+    bool hasBeats()  const { return !beats.empty(); }
+    bool isEmpty()   const { return events.empty(); }
+
+    const CuePoint& getCue(uint32_t i) const { return cues[i]; }
+    const TrackMetadata::BeatEntry& getBeat(uint32_t i) const { return beats[i]; }
+    const TrackMetadata::PhraseEntry& getPhrase(uint32_t i) const { return phrases[i]; }
+    size_t getNumBeats() const { return beats.size(); }
+
+    /// First cue not yet passed by the cursor, or nullptr.
+    const CuePoint* getNextCue() const
+    {
+        // cueEvents holds the event indices of all cues in time order
+        auto it = std::lower_bound(cueEvents.begin(), cueEvents.end(), (uint32_t)cursor);
+        return it != cueEvents.end() ? &cues[events[*it].index] : nullptr;
+    }
+
+    /// Index of the last beat at or before the playhead (-1 before the first).
+    int getCurrentBeatIndex() const { return curBeat; }
+
+    /// Phrase containing the playhead, or nullptr.
+    const TrackMetadata::PhraseEntry* getCurrentPhrase() const
+    {
+        return curPhrase >= 0 ? &phrases[(size_t)curPhrase] : nullptr;
+    }
+
+    /// Nearest beat to an arbitrary position (e.g. the PLL's interpolated
+    /// playhead, which sits within a few ms of the cursor).  Starts from the
+    /// cursor's beat and walks, so the common case touches 2-3 entries.
+    /// Returns -1 when no beat grid is loaded.
+    double nearestBeatMs(double posMs) const
+    {
+        if (beats.empty()) return -1.0;
+
+        int i = juce::jlimit(0, (int)beats.size() - 1, curBeat);
+        int steps = 0;
+        while (i + 1 < (int)beats.size() && (double)beats[(size_t)(i + 1)].timeMs <= posMs && ++steps < 8) ++i;
+        while (i > 0 && (double)beats[(size_t)i].timeMs > posMs && ++steps < 8) --i;
+        if (steps >= 8)
+            i = juce::jmax(0, beatIndexAtOrBefore((uint32_t)juce::jmax(0.0, posMs)));
+
+        double best = (double)beats[(size_t)i].timeMs;
+        if (i + 1 < (int)beats.size())
+        {
+            double next = (double)beats[(size_t)(i + 1)].timeMs;
+            if (std::abs(next - posMs) < std::abs(best - posMs))
+                best = next;
+        }
+        return best;
+    }
+
+private:
+    //--------------------------------------------------------------------------
+    void compile()
+    {
+        events.clear();
+        cueEvents.clear();
+        events.reserve(cues.size() + beats.size() + phrases.size());
+
+        for (size_t i = 0; i < beats.size(); ++i)
+            events.push_back({ beats[i].timeMs, Kind::Beat, (uint32_t)i });
+
+        // Phrase start = time of its first beat (PSSI stores beat numbers)
+        phraseStarts.clear();
+        for (size_t i = 0; i < phrases.size(); ++i)
+        {
+            const uint16_t bn = phrases[i].beatNumber;
+            if (bn > 0 && bn <= beats.size())
+            {
+                const uint32_t t = beats[(size_t)(bn - 1)].timeMs;
+                events.push_back({ t, Kind::Phrase, (uint32_t)i });
+                phraseStarts.push_back({ t, (uint32_t)i });
+            }
+        }
+
+        for (size_t i = 0; i < cues.size(); ++i)
+            events.push_back({ cues[i].positionMs, Kind::Cue, (uint32_t)i });
+
+        std::stable_sort(events.begin(), events.end(),
+                         [](const Event& a, const Event& b) {
+                             return a.timeMs != b.timeMs ? a.timeMs < b.timeMs
+                                                         : (uint8_t)a.kind < (uint8_t)b.kind;
+                         });
+
+        for (size_t i = 0; i < events.size(); ++i)
+            if (events[i].kind == Kind::Cue)
+                cueEvents.push_back((uint32_t)i);
+
+        seekCursor();
+    }
+
+    /// Position the cursor after every event strictly behind the playhead.
+    /// Events exactly at the playhead stay ahead so a forward step fires them.
+    void seekCursor()
+    {
+        auto it = std::lower_bound(events.begin(), events.end(), positionMs,
+                                   [](const Event& e, uint32_t t) { return e.timeMs < t; });
+        cursor = (size_t)(it - events.begin());
+
+        curBeat = positionMs > 0 ? beatIndexAtOrBefore(positionMs - 1) : -1;
+
+        auto pit = std::lower_bound(phraseStarts.begin(), phraseStarts.end(), positionMs,
+                                    [](const PhraseStart& p, uint32_t t) { return p.timeMs < t; });
+        curPhrase = pit == phraseStarts.begin() ? -1 : (int)std::prev(pit)->index;
+    }
+
+    int beatIndexAtOrBefore(uint32_t t) const
+    {
+        auto it = std::upper_bound(beats.begin(), beats.end(), t,
+                                   [](uint32_t v, const TrackMetadata::BeatEntry& b) { return v < b.timeMs; });
+        return (int)(it - beats.begin()) - 1;
+    }
+
+    void noteCrossed(const Event& ev, Direction dir)
+    {
+        if (ev.kind == Kind::Beat)
+        {
+            curBeat = (dir == Direction::Forward) ? (int)ev.index : (int)ev.index - 1;
+        }
+        else if (ev.kind == Kind::Phrase)
+        {
+            if (dir == Direction::Forward)
+            {
+                curPhrase = (int)ev.index;
+            }
+            else
+            {
+                // Previous phrase that actually made it into the timeline
+                curPhrase = -1;
+                for (size_t i = 0; i < phraseStarts.size() && phraseStarts[i].index < ev.index; ++i)
+                    curPhrase = (int)phraseStarts[i].index;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    std::vector<CuePoint> cues;
+    std::vector<TrackMetadata::BeatEntry> beats;
+    std::vector<TrackMetadata::PhraseEntry> phrases;
+
+    struct PhraseStart { uint32_t timeMs; uint32_t index; };
+
+    std::vector<Event>    events;       // compiled, sorted by (time, kind)
+    std::vector<PhraseStart> phraseStarts;  // resolvable phrases, ascending
+    std::vector<uint32_t> cueEvents;    // event indices of Kind::Cue, ascending
+
+    uint32_t positionMs = 0;
+    size_t   cursor     = 0;            // events[0..cursor) are behind the playhead
+    int      curBeat    = -1;
+    int      curPhrase  = -1;
+};
@@ -9,12 +9,15 @@
 #include "DbServerClient.h"
 #include "CuePointEditor.h"
 #include "CustomLookAndFeel.h"
+#include "TrackMapIndex.h"
 
 //==============================================================================
 // TrackMapEditor -- Table editor for Track ID -> Timecode Offset mapping.
 //
 // Designed to be shown in a DialogWindow from MainComponent.
-// Receives a TrackMap* (owned by AppSettings) and a ProDJLinkInput* (for Learn).
+// Receives a TrackMap* (owned by AppSettings), the TrackMapIndex over it
+// (owned by MainComponent, so it survives the window) and a ProDJLinkInput*
+// (for Learn).
 // Calls onChange() whenever the map is modified so the caller can persist
 // settings and refresh engine lookups.
 //==============================================================================
@@ -25,11 +28,11 @@ public:
     //--------------------------------------------------------------------------
     // Construction
     //--------------------------------------------------------------------------
-    TrackMapEditor(TrackMap& map, ProDJLinkInput* proDJLink = nullptr)
-        : trackMap(map), proDJLinkInput(proDJLink)
+    TrackMapEditor(TrackMap& map, TrackMapIndex& mapIndex, ProDJLinkInput* proDJLink = nullptr)
+        : trackMap(map), index(mapIndex), proDJLinkInput(proDJLink)
     {
         setSize(780, 560);
-        rebuildRows();
+        rebuildRows(true);
 
         // --- Table ---
         addAndMakeVisible(table);
@@ -91,6 +94,24 @@ public:
         cmbLearnLayer.setColour(juce::ComboBox::outlineColourId, borderCol);
         cmbLearnLayer.setEnabled(proDJLinkInput != nullptr);
 
+        // Search: word prefixes of artist / title, filtered as you type
+        addAndMakeVisible(edSearch);
+        edSearch.setFont(juce::Font(juce::FontOptions(getMonoFontName(), 11.0f, juce::Font::plain)));
+        edSearch.setTextToShowWhenEmpty("Search artist / title", textDim);
+        edSearch.setColour(juce::TextEditor::backgroundColourId, bgDarker);
+        edSearch.setColour(juce::TextEditor::textColourId, textBright);
+        edSearch.setColour(juce::TextEditor::outlineColourId, borderCol);
+        edSearch.setColour(juce::TextEditor::focusedOutlineColourId, accentCyan);
+        edSearch.onTextChange = [this]
+        {
+            filterText = edSearch.getText().trim();
+            rebuildRows();
+            table.updateContent();
+            table.repaint();
+            updateStatusText();
+        };
+        edSearch.onEscapeKey = [this] { edSearch.clear(); edSearch.onTextChange(); };
+
         btnLearn.onClick  = [this] { onLearn(); };
         btnAdd.onClick    = [this] { onAdd(); };
         btnDelete.onClick = [this] { onDeleteSelected(); };
@@ -218,9 +239,9 @@ public:
         {
             if (editingRow < 0 || editingRow >= (int)rows.size()) return;
             if (!onOpenCueEditor) return;
-            auto* entry = trackMap.find(rows[(size_t)editingRow]->artist,
-                                         rows[(size_t)editingRow]->title,
-                                         rows[(size_t)editingRow]->durationSec);
+            auto* entry = trackMap.find(rows[(size_t)editingRow]->entry->artist,
+                                         rows[(size_t)editingRow]->entry->title,
+                                         rows[(size_t)editingRow]->entry->durationSec);
             if (entry) onOpenCueEditor(entry);
         };
 
@@ -276,7 +297,7 @@ public:
     //--------------------------------------------------------------------------
     void refresh()
     {
-        rebuildRows();
+        rebuildRows(true);
         table.updateContent();
         table.repaint();
         updateStatusText();
@@ -316,6 +337,10 @@ public:
         btnExport.setBounds(btnRow.removeFromRight(bw));  btnRow.removeFromRight(4);
         btnImport.setBounds(btnRow.removeFromRight(bw));
 
+        btnRow.removeFromLeft(12);
+        btnRow.removeFromRight(12);
+        edSearch.setBounds(btnRow.removeFromLeft(juce::jmin(220, btnRow.getWidth())).reduced(0, 2));
+
         area.removeFromTop(6);
 
         // Status bar
@@ -355,7 +380,7 @@ public:
     {
         if (rowNumber < 0 || rowNumber >= (int)rows.size()) return;
 
-        bool isActive = (!activeTrackKey.empty() && rows[(size_t)rowNumber]->key() == activeTrackKey);
+        bool isActive = (!activeTrackKey.empty() && rows[(size_t)rowNumber]->key == activeTrackKey);
 
         if (isSelected)
             g.fillAll(accentCyan.withAlpha(0.15f));
@@ -370,80 +395,51 @@ public:
     {
         if (rowNumber < 0 || rowNumber >= (int)rows.size()) return;
         jassert(rowsGeneration == trackMap.getGeneration());  // stale pointers!
-        const auto& entry = *rows[(size_t)rowNumber];
+        const auto& row = *rows[(size_t)rowNumber];
 
-        bool isActive = (!activeTrackKey.empty() && entry.key() == activeTrackKey);
+        // Cell text is pre-formatted by the index; nothing is built here
+        bool isActive = (!activeTrackKey.empty() && row.key == activeTrackKey);
         g.setColour(isActive ? accentGreen.brighter(0.3f) : textBright);
-        g.setFont(juce::Font(juce::FontOptions(getMonoFontName(), 11.0f, juce::Font::plain)));
+        g.setFont(cellFont);
 
-        juce::String text;
+        const juce::String* text = nullptr;
         switch (columnId)
         {
             case ColPlaylistPos:
-                // Show playlist position (sortOrder) or "--" if not in a playlist
-                if (entry.sortOrder > 0)
-                    text = juce::String(entry.sortOrder);
-                else
-                {
-                    text = "--";
+                // Playlist position (sortOrder) or "--" if not in a playlist
+                text = &row.posText;
+                if (row.sortOrder <= 0)
                     g.setColour(textBright.withAlpha(0.4f));
-                }
                 break;
-            case ColArtist:  text = entry.artist; break;
-            case ColTitle:   text = entry.title; break;
-            case ColOffset:  text = entry.timecodeOffset; break;
+            case ColArtist:  text = &row.artist; break;
+            case ColTitle:   text = &row.title; break;
+            case ColOffset:  text = &row.offset; break;
             case ColBpm:
-            {
-                // Show compact BPM multiplier indicator
-                switch (entry.bpmMultiplier)
-                {
-                    case  1: text = "x2";  g.setColour(accentCyan.brighter(0.3f)); break;
-                    case  2: text = "x4";  g.setColour(accentCyan.brighter(0.3f)); break;
-                    case -1: text = "/2";  g.setColour(accentCyan.brighter(0.3f)); break;
-                    case -2: text = "/4";  g.setColour(accentCyan.brighter(0.3f)); break;
-                    default: text = "--";  break;
-                }
+                // Compact BPM multiplier indicator
+                text = &row.bpmText;
+                if (row.bpmMultiplier != 0)
+                    g.setColour(accentCyan.brighter(0.3f));
                 break;
-            }
             case ColTrig:
-            {
-                // Show compact trigger indicators: M=MIDI, O=OSC, D=DMX
-                juce::String t;
-                if (entry.hasMidiTrigger())   t += "M";
-                if (entry.hasOscTrigger())    t += "O";
-                if (entry.hasArtnetTrigger()) t += "D";
-                if (t.isNotEmpty())
-                {
-                    g.setColour(juce::Colour(0xFFFFAB00));  // amber accent
-                    g.drawText(t, 4, 0, width - 8, height, juce::Justification::centredLeft, true);
-                }
-                return;
-            }
+                // Compact trigger indicators: M=MIDI, O=OSC, D=DMX
+                if (row.trigText.isEmpty()) return;
+                text = &row.trigText;
+                g.setColour(juce::Colour(0xFFFFAB00));  // amber accent
+                break;
             case ColCues:
-            {
-                int n = (int)entry.cuePoints.size();
-                if (n > 0)
-                {
-                    g.setColour(juce::Colour(0xFF00CC88));  // green-teal accent
-                    g.drawText(juce::String(n), 4, 0, width - 8, height,
-                               juce::Justification::centredLeft, true);
-                }
-                else
-                {
-                    g.setColour(juce::Colour(0xFF555555));
-                    g.drawText("+", 4, 0, width - 8, height,
-                               juce::Justification::centredLeft, true);
-                }
-                return;
-            }
-            case ColNotes:   text = entry.notes; break;
+                text = &row.cuesText;
+                g.setColour(row.cueCount > 0 ? juce::Colour(0xFF00CC88)    // green-teal accent
+                                             : juce::Colour(0xFF555555));
+                break;
+            case ColNotes:   text = &row.notes; break;
+            default:         return;
         }
 
         // Playlist position column reads better centered
         auto justification = (columnId == ColPlaylistPos)
             ? juce::Justification::centred
             : juce::Justification::centredLeft;
-        g.drawText(text, 4, 0, width - 8, height, justification, true);
+        g.drawText(*text, 4, 0, width - 8, height, justification, true);
     }
 
     void cellDoubleClicked(int rowNumber, int /*columnId*/,
@@ -460,9 +456,9 @@ public:
             if (onOpenCueEditor)
             {
                 // Get mutable pointer from the trackMap (rows[] are const pointers)
-                auto* entry = trackMap.find(rows[(size_t)rowNumber]->artist,
-                                             rows[(size_t)rowNumber]->title,
-                                             rows[(size_t)rowNumber]->durationSec);
+                auto* entry = trackMap.find(rows[(size_t)rowNumber]->entry->artist,
+                                             rows[(size_t)rowNumber]->entry->title,
+                                             rows[(size_t)rowNumber]->entry->durationSec);
                 if (entry)
                     onOpenCueEditor(entry);
             }
@@ -480,10 +476,12 @@ private:
     // Data
     //--------------------------------------------------------------------------
     TrackMap& trackMap;
+    TrackMapIndex& index;
     ProDJLinkInput* proDJLinkInput;
     DbServerClient* dbClient = nullptr;  // Phase 2: metadata cache for Learn
 
-    std::vector<const TrackMapEntry*> rows;   // sorted snapshot (ptrs into trackMap) for display
+    std::vector<const TrackMapIndex::Row*> rows;   // sorted, filtered view of the index for display
+    juce::String filterText;                   // search box contents
     int  activeSortColumn = ColPlaylistPos;     // default: playlist order
     bool sortForwards     = true;
     uint64_t rowsGeneration = 0;               // generation at which rows were built
@@ -517,6 +515,8 @@ private:
     juce::TextButton btnLearn, btnAdd, btnDelete, btnClearAll, btnImport, btnExport;
     juce::Label lblLearnLayer;
     juce::ComboBox cmbLearnLayer;
+    juce::TextEditor edSearch;
+    juce::Font cellFont { juce::FontOptions(getMonoFontName(), 11.0f, juce::Font::plain) };
 
     // Edit form
     juce::Component formPanel;
@@ -553,67 +553,31 @@ private:
     //--------------------------------------------------------------------------
     // Helpers
     //--------------------------------------------------------------------------
-    void rebuildRows()
+    /// `syncAll` rescans every entry even if the TrackMap generation is
+    /// unchanged -- after edits made in place (cue points, in-row fields).
+    void rebuildRows(bool syncAll = false)
     {
-        // Default view (or any unknown column): playlist order ascending.
-        // This also covers the case where JUCE reports no sort (columnId==0).
-        if (activeSortColumn <= 0
-            || (activeSortColumn == ColPlaylistPos && sortForwards))
+        index.sync(trackMap, syncAll);
+
+        // Unknown column or no sort (columnId==0): playlist order ascending
+        auto column = TrackMapIndex::SortPlaylist;
+        bool forwards = sortForwards;
+        switch (activeSortColumn)
         {
-            rows = trackMap.getAllSortedPtrs();
-            rowsGeneration = trackMap.getGeneration();
-            return;
+            case ColArtist: column = TrackMapIndex::SortArtist; break;
+            case ColTitle:  column = TrackMapIndex::SortTitle;  break;
+            case ColOffset: column = TrackMapIndex::SortOffset; break;
+            case ColPlaylistPos: break;
+            default: forwards = true; break;
         }
 
-        // Custom column sort: snapshot all entries then sort
-        rows.clear();
-        rows.reserve(trackMap.size());
-        for (auto& [k, entry] : trackMap.getEntries())
-            rows.push_back(&entry);
-
-        auto cmpStr = [this](const juce::String& a, const juce::String& b) {
-            int c = a.compareIgnoreCase(b);
-            return sortForwards ? (c < 0) : (c > 0);
-        };
-
-        std::sort(rows.begin(), rows.end(),
-            [&](const TrackMapEntry* a, const TrackMapEntry* b) {
-                switch (activeSortColumn)
-                {
-                    case ColPlaylistPos:
-                    {
-                        // Tracks without a playlist position (sortOrder==0) always
-                        // come LAST, regardless of sort direction. This keeps the
-                        // "# == --" group at the bottom where the user expects it.
-                        bool aHas = (a->sortOrder > 0);
-                        bool bHas = (b->sortOrder > 0);
-                        if (aHas != bHas) return aHas;  // the one with an order wins
-                        if (aHas)  // both have sort orders
-                            return sortForwards ? (a->sortOrder < b->sortOrder)
-                                                : (a->sortOrder > b->sortOrder);
-                        // Neither has a sort order -- tiebreak by artist/title
-                        if (a->artist.compareIgnoreCase(b->artist) != 0)
-                            return a->artist.compareIgnoreCase(b->artist) < 0;
-                        return a->title.compareIgnoreCase(b->title) < 0;
-                    }
-                    case ColArtist:
-                        if (a->artist.compareIgnoreCase(b->artist) != 0)
-                            return cmpStr(a->artist, b->artist);
-                        return cmpStr(a->title, b->title);  // tiebreak by title
-                    case ColTitle:
-                        return cmpStr(a->title, b->title);
-                    case ColOffset:
-                        return cmpStr(a->timecodeOffset, b->timecodeOffset);
-                    default:
-                        return false;
-                }
-            });
+        index.getRows(rows, column, forwards, filterText);
         rowsGeneration = trackMap.getGeneration();
     }
 
     void notifyChanged()
     {
-        rebuildRows();
+        rebuildRows(true);
         table.updateContent();
         table.repaint();
         updateStatusText();
@@ -623,18 +587,15 @@ private:
     void updateStatusText()
     {
         juce::String s = "Tracks: " + juce::String(trackMap.size());
+        if (filterText.isNotEmpty())
+            s += " (" + juce::String((int)rows.size()) + " shown)";
         if (!activeTrackKey.empty())
         {
             // Find the entry to show artist - title
-            for (auto& [k, entry] : trackMap.getEntries())
-            {
-                if (k == activeTrackKey)
-                {
-                    s += " | Active: " + entry.artist + " - " + entry.title + " (MAPPED)";
-                    break;
-                }
-            }
-            if (!s.contains("MAPPED"))
+            auto it = trackMap.getEntries().find(activeTrackKey);
+            if (it != trackMap.getEntries().end())
+                s += " | Active: " + it->second.artist + " - " + it->second.title + " (MAPPED)";
+            else
                 s += " | Active track (UNMAPPED)";
         }
         lblStatus.setText(s, juce::dontSendNotification);
@@ -767,7 +728,7 @@ private:
     {
         if (rowIndex < 0 || rowIndex >= (int)rows.size()) return;
         jassert(rowsGeneration == trackMap.getGeneration());  // stale pointers!
-        const auto& entry = *rows[(size_t)rowIndex];
+        const auto& entry = *rows[(size_t)rowIndex]->entry;
         editingRow = rowIndex;
 
         edFormArtist.setText(entry.artist, false);
@@ -886,15 +847,15 @@ private:
         int preservedSortOrder = 0;
         if (editingRow >= 0 && editingRow < (int)rows.size())
         {
-            preservedCuePoints = rows[(size_t)editingRow]->cuePoints;
-            preservedDurationSec = rows[(size_t)editingRow]->durationSec;
-            preservedSortOrder = rows[(size_t)editingRow]->sortOrder;
+            preservedCuePoints = rows[(size_t)editingRow]->entry->cuePoints;
+            preservedDurationSec = rows[(size_t)editingRow]->entry->durationSec;
+            preservedSortOrder = rows[(size_t)editingRow]->entry->sortOrder;
         }
 
         // If editing an existing row whose artist/title changed, remove the old entry
         if (editingRow >= 0 && editingRow < (int)rows.size())
         {
-            auto& oldEntry = *rows[(size_t)editingRow];
+            auto& oldEntry = *rows[(size_t)editingRow]->entry;
             if (TrackMapEntry::makeKey(formArtist, formTitle, oldEntry.durationSec) != oldEntry.key())
                 trackMap.remove(oldEntry.artist, oldEntry.title, oldEntry.durationSec);
         }
@@ -1005,7 +966,7 @@ private:
         // Select the saved row
         for (int i = 0; i < (int)rows.size(); ++i)
         {
-            if (rows[(size_t)i]->key() == savedKey)
+            if (rows[(size_t)i]->key == savedKey)
             {
                 table.selectRow(i);
                 break;
@@ -1075,12 +1036,15 @@ private:
         // If entry already exists, open it for editing
         if (trackMap.contains(learnArtist, learnTitle, learnedDurationSec))
         {
+            // The learned track must be visible to select it
+            edSearch.clear();
+            filterText.clear();
             rebuildRows();
             table.updateContent();
             auto targetKey = TrackMapEntry::makeKey(learnArtist, learnTitle, learnedDurationSec);
             for (int i = 0; i < (int)rows.size(); ++i)
             {
-                if (rows[(size_t)i]->key() == targetKey)
+                if (rows[(size_t)i]->key == targetKey)
                 {
                     table.selectRow(i);
                     openFormForRow(i);
@@ -1106,7 +1070,7 @@ private:
         if (selected < 0 || selected >= (int)rows.size()) return;
         jassert(rowsGeneration == trackMap.getGeneration());
 
-        const auto& entry = *rows[(size_t)selected];
+        const auto& entry = *rows[(size_t)selected]->entry;
         juce::String deleteArtist = entry.artist;
         juce::String deleteTitle  = entry.title;
         int deleteDur = entry.durationSec;
@@ -1170,19 +1134,8 @@ private:
 
             if (file.getFileExtension().equalsIgnoreCase(".xml"))
             {
-                // rekordbox XML — check for playlists
-                auto playlists = TrackMap::listRekordboxPlaylists(file);
-
-                if (playlists.isEmpty())
-                {
-                    // No playlists found — import entire collection
-                    importRekordboxEntries(TrackMap::parseRekordboxXml(file));
-                }
-                else
-                {
-                    // Show playlist picker
-                    showPlaylistPicker(file, playlists);
-                }
+                // rekordbox XML -- read once in the background, then pick
+                startRekordboxImport(file);
             }
             else
             {
@@ -1220,7 +1173,95 @@ private:
         showImportPreview(std::move(entries), false);
     }
 
-    void showPlaylistPicker(const juce::File& xmlFile, const juce::StringArray& playlists)
+    //--------------------------------------------------------------------------
+    // rekordbox import -- the XML (often 100k+ tracks) is streamed once on a
+    // worker thread behind a progress window; COLLECTION and every playlist
+    // come out of that single pass, so the picker never re-reads the file.
+    //--------------------------------------------------------------------------
+    struct RekordboxImport
+    {
+        RekordboxLibrary library;
+        std::vector<TrackMapEntry> allSorted;   // whole collection, artist/title order
+    };
+
+    class RekordboxImportJob : public juce::ThreadWithProgressWindow
+    {
+    public:
+        using Completion = std::function<void(std::shared_ptr<RekordboxImport>)>;
+
+        RekordboxImportJob(const juce::File& xmlFile, juce::Component* centreAround, Completion done)
+            : juce::ThreadWithProgressWindow("Reading rekordbox XML...", true, true, 10000,
+                                             "Cancel", centreAround),
+              file(xmlFile), onDone(std::move(done))
+        {
+            setStatusMessage(file.getFileName());
+        }
+
+        void run() override
+        {
+            auto import = std::make_shared<RekordboxImport>();
+            import->library = RekordboxXmlReader::read(file, [this](float p)
+            {
+                setProgress(p * 0.9);
+                return !threadShouldExit();
+            });
+            if (!import->library.ok || threadShouldExit()) return;
+
+            setProgress(0.95);
+            import->allSorted = TrackMap::entriesFromRekordbox(import->library, -1);
+            std::sort(import->allSorted.begin(), import->allSorted.end(),
+                [](const TrackMapEntry& a, const TrackMapEntry& b) {
+                    int cmp = a.artist.compareIgnoreCase(b.artist);
+                    return cmp != 0 ? cmp < 0 : a.title.compareIgnoreCase(b.title) < 0;
+                });
+            result = std::move(import);
+        }
+
+        void threadComplete(bool userPressedCancel) override
+        {
+            if (!userPressedCancel && onDone)
+                onDone(result);   // nullptr when the file could not be read
+        }
+
+    private:
+        juce::File file;
+        Completion onDone;
+        std::shared_ptr<RekordboxImport> result;
+    };
+
+    void startRekordboxImport(const juce::File& file)
+    {
+        if (rekordboxJob != nullptr) return;   // one import at a time
+
+        juce::Component::SafePointer<TrackMapEditor> safeThis(this);
+        rekordboxJob = std::make_unique<RekordboxImportJob>(file, this,
+            [safeThis](std::shared_ptr<RekordboxImport> import)
+        {
+            if (!safeThis) return;
+
+            // Still inside the job's callback: delete it afterwards
+            juce::MessageManager::callAsync([safeThis]
+            {
+                if (safeThis) safeThis->rekordboxJob.reset();
+            });
+
+            if (import == nullptr)
+            {
+                juce::AlertWindow::showMessageBoxAsync(
+                    juce::MessageBoxIconType::WarningIcon, "Import from rekordbox XML",
+                    "Could not read the file as a rekordbox XML export (DJ_PLAYLISTS).");
+                return;
+            }
+
+            if (import->library.playlists.empty())
+                safeThis->importRekordboxEntries(import->allSorted);   // no playlists: whole collection
+            else
+                safeThis->showPlaylistPicker(std::move(import));
+        });
+        rekordboxJob->launchThread();
+    }
+
+    void showPlaylistPicker(std::shared_ptr<RekordboxImport> import)
     {
         auto alert = std::make_shared<juce::AlertWindow>(
             "Import from rekordbox XML",
@@ -1228,16 +1269,15 @@ private:
             "or select which tracks to import.",
             juce::MessageBoxIconType::QuestionIcon, this);
 
-        alert->addComboBox("playlist", playlists);
+        alert->addComboBox("playlist", import->library.getPlaylistNames());
         alert->addButton("Apply Playlist Order", 1);
         alert->addButton("Import Tracks", 2);
         alert->addButton("Cancel", 0);
 
-        auto fileCopy = xmlFile;
         juce::Component::SafePointer<TrackMapEditor> safeThis(this);
 
         alert->enterModalState(true, juce::ModalCallbackFunction::create(
-            [safeThis, fileCopy, alert](int result)
+            [safeThis, import, alert](int result)
         {
             if (!safeThis || result == 0) return;
 
@@ -1246,9 +1286,9 @@ private:
                 // Apply playlist order: reorder existing + add missing, keep cues/triggers
                 auto* combo = alert->getComboBoxComponent("playlist");
                 if (!combo) return;
-                juce::String selected = combo->getText();
 
-                auto entries = TrackMap::parseRekordboxXml(fileCopy, selected);
+                auto entries = TrackMap::entriesFromRekordbox(import->library,
+                                                              combo->getSelectedItemIndex());
                 if (!entries.empty())
                 {
                     int before = (int)safeThis->trackMap.size();
@@ -1278,16 +1318,7 @@ private:
             else
             {
                 // Import entire collection as new entries (sorted alphabetically)
-                auto entries = TrackMap::parseRekordboxXml(fileCopy);
-                if (!entries.empty())
-                {
-                    std::sort(entries.begin(), entries.end(),
-                        [](const TrackMapEntry& a, const TrackMapEntry& b) {
-                            int cmp = a.artist.compareIgnoreCase(b.artist);
-                            return cmp != 0 ? cmp < 0 : a.title.compareIgnoreCase(b.title) < 0;
-                        });
-                    safeThis->showImportPreview(std::move(entries), false);
-                }
+                safeThis->importRekordboxEntries(import->allSorted);
             }
         }));
     }
@@ -1307,10 +1338,9 @@ private:
             // Mark duplicates and default-select only NEW tracks
             for (size_t i = 0; i < items.size(); ++i)
             {
-                bool dup = existingMap.contains(items[i].artist, items[i].title,
-                                                items[i].durationSec)
-                        || existingMap.findIgnoringDuration(items[i].artist,
-                                                           items[i].title) != nullptr;
+                auto key = TrackKey::make(items[i].artist, items[i].title, items[i].durationSec);
+                bool dup = existingMap.contains(key)
+                        || existingMap.findIgnoringDuration(key) != nullptr;
                 isDuplicate.push_back(dup);
                 selected.push_back(!dup);  // new = selected, existing = deselected
             }
@@ -1518,8 +1548,8 @@ private:
                 // cues, triggers, offsets, notes. If the user explicitly
                 // selected a duplicate to import, we interpret that as
                 // "make sure it's in the map" rather than "reset it".
-                if (trackMap.contains(e.artist, e.title, e.durationSec)
-                    || trackMap.findIgnoringDuration(e.artist, e.title) != nullptr)
+                auto key = TrackKey::make(e.artist, e.title, e.durationSec);
+                if (trackMap.contains(key) || std::as_const(trackMap).findIgnoringDuration(key) != nullptr)
                     continue;
 
                 trackMap.addOrUpdate(e);
@@ -1610,6 +1640,7 @@ private:
 
     // Async file chooser (must stay alive until callback)
     std::unique_ptr<juce::FileChooser> fileChooser;
+    std::unique_ptr<RekordboxImportJob> rekordboxJob;
 
     // Async delete confirmation (must stay alive until callback fires)
     juce::ScopedMessageBox deleteConfirmBox;
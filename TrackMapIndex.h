@@ -0,0 +1,432 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// TrackMapIndex -- Display index over the TrackMap for TrackMapEditor.
+//
+// A rekordbox collection import can put 50-100k entries in the TrackMap.
+// Re-sorting every entry with compareIgnoreCase() and formatting cell text
+// on each repaint made the editor sluggish at that size.  The index keeps,
+// per entry, a Row with pre-lowered sort keys and ready-to-draw cell text,
+// and maintains:
+//
+//   sorted views : one ascending vector of Row* per sortable column, built
+//                  on first use and then kept sorted by binary-search
+//                  insert/erase as entries are added, changed or removed.
+//                  Descending order is the same vector read backwards.
+//   prefix index : rows bucketed by the first one and two characters of
+//                  every artist/title word.  A filter query only verifies
+//                  the rows of its rarest bucket, then picks matches out of
+//                  the sorted view in order.
+//
+// sync() diffs the index against the TrackMap: nothing when the generation
+// is unchanged, otherwise one pointer lookup and a field compare per entry
+// (strings compare by shared buffer first).  Large changes (an import)
+// drop the views and prefix index, which are rebuilt on next use.
+//
+// Owned by MainComponent so it outlives the editor window: reopening the
+// editor costs a sync, not a rebuild.  Message thread only.
+
+#pragma once
+#include <JuceHeader.h>
+#include "AppSettings.h"
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cctype>
+
+class TrackMapIndex
+{
+public:
+    enum SortColumn { SortPlaylist = 0, SortArtist, SortTitle, SortOffset, kNumSortColumns };
+
+    struct Row
+    {
+        const TrackMapEntry* entry = nullptr;   // valid while the TrackMap generation is unchanged
+        std::string key;                        // TrackMapEntry::key()
+
+        // Snapshot of the displayed fields (change detection + drawing)
+        juce::String artist, title, offset, notes;
+        int durationSec = 0, sortOrder = 0, bpmMultiplier = 0, cueCount = 0;
+        bool midi = false, osc = false, dmx = false;
+
+        // Pre-formatted cell text
+        juce::String posText, bpmText, trigText, cuesText;
+
+        // Sort / search keys (lower-cased, trimmed)
+        std::string artistSort, titleSort, offsetSort, searchText;
+        std::vector<uint16_t> prefixKeys;       // buckets this row is in
+
+    private:
+        friend class TrackMapIndex;
+        uint32_t seenPass = 0;
+        uint32_t filterPass = 0;
+        bool     filterHit = false;
+    };
+
+    TrackMapIndex() = default;
+
+    //==========================================================================
+    /// Brings the index up to date with `map`.  Returns immediately when the
+    /// generation hasn't changed, unless `force` (entries edited in place,
+    /// e.g. cue points, don't bump the generation).
+    void sync(const TrackMap& map, bool force = false)
+    {
+        if (!force && synced && map.getGeneration() == syncedGeneration)
+            return;
+        synced = true;
+        syncedGeneration = map.getGeneration();
+
+        const uint32_t pass = ++syncPass;
+        std::vector<Row*> added, changed;
+
+        for (auto& [k, entry] : map.getEntries())
+        {
+            auto [it, inserted] = rows.try_emplace(&entry);
+            Row& r = it->second;
+            r.seenPass = pass;
+            if (inserted)
+            {
+                r.entry = &entry;
+                added.push_back(&r);
+            }
+            else if (!isCurrent(r, entry))
+            {
+                changed.push_back(&r);
+            }
+        }
+
+        std::vector<const TrackMapEntry*> gone;
+        for (auto& [p, r] : rows)
+            if (r.seenPass != pass)
+                gone.push_back(p);
+
+        // Many changes: re-sorting once beats thousands of vector inserts
+        const size_t churn = added.size() + changed.size() + gone.size();
+        if (churn > 64 && churn > rows.size() / 8)
+            dropIndexes();
+
+        for (auto* p : gone)
+        {
+            auto it = rows.find(p);
+            unindex(it->second);
+            rows.erase(it);
+        }
+        for (auto* r : changed)
+        {
+            unindex(*r);
+            fill(*r);
+            index(*r);
+        }
+        for (auto* r : added)
+        {
+            fill(*r);
+            index(*r);
+        }
+    }
+
+    /// Rows in display order for `column` / `forwards`, limited to rows where
+    /// every word of `query` is the start of a word in artist or title.
+    /// Playlist order keeps unordered tracks last in both directions.
+    void getRows(std::vector<const Row*>& out, SortColumn column, bool forwards,
+                 const juce::String& query)
+    {
+        out.clear();
+        auto& view = getView(column);
+
+        auto tokens = juce::StringArray::fromTokens(query.toLowerCase(), " \t", "");
+        tokens.removeEmptyStrings();
+
+        bool filtering = !tokens.isEmpty();
+        uint32_t pass = 0;
+        if (filtering)
+        {
+            pass = markMatches(tokens);
+            out.reserve(64);
+        }
+        else
+        {
+            out.reserve(view.size());
+        }
+
+        auto emit = [&](const Row* r)
+        {
+            if (!filtering || (r->filterPass == pass && r->filterHit))
+                out.push_back(r);
+        };
+
+        if (forwards)
+        {
+            for (auto* r : view) emit(r);
+        }
+        else if (column == SortPlaylist)
+        {
+            auto split = std::partition_point(view.begin(), view.end(),
+                                              [](const Row* r) { return r->sortOrder > 0; });
+            for (auto it = split; it != view.begin();) emit(*--it);
+            for (auto it = split; it != view.end(); ++it) emit(*it);
+        }
+        else
+        {
+            for (auto it = view.rbegin(); it != view.rend(); ++it) emit(*it);
+        }
+    }
+
+    size_t size() const { return rows.size(); }
+
+private:
+    //==========================================================================
+    static bool sameText(const juce::String& a, const juce::String& b)
+    {
+        return a.getCharPointer() == b.getCharPointer() || a == b;
+    }
+
+    static std::string lowered(const juce::String& s)
+    {
+        return s.toLowerCase().trim().toStdString();
+    }
+
+    static bool isCurrent(const Row& r, const TrackMapEntry& e)
+    {
+        return r.durationSec == e.durationSec && r.sortOrder == e.sortOrder
+            && r.bpmMultiplier == e.bpmMultiplier && r.cueCount == (int)e.cuePoints.size()
+            && r.midi == e.hasMidiTrigger() && r.osc == e.hasOscTrigger()
+            && r.dmx == e.hasArtnetTrigger()
+            && sameText(r.artist, e.artist) && sameText(r.title, e.title)
+            && sameText(r.offset, e.timecodeOffset) && sameText(r.notes, e.notes);
+    }
+
+    static void fill(Row& r)
+    {
+        const auto& e = *r.entry;
+        r.key           = e.key();
+        r.artist        = e.artist;
+        r.title         = e.title;
+        r.offset        = e.timecodeOffset;
+        r.notes         = e.notes;
+        r.durationSec   = e.durationSec;
+        r.sortOrder     = e.sortOrder;
+        r.bpmMultiplier = e.bpmMultiplier;
+        r.cueCount      = (int)e.cuePoints.size();
+        r.midi          = e.hasMidiTrigger();
+        r.osc           = e.hasOscTrigger();
+        r.dmx           = e.hasArtnetTrigger();
+
+        r.posText = r.sortOrder > 0 ? juce::String(r.sortOrder) : juce::String("--");
+        switch (r.bpmMultiplier)
+        {
+            case  1: r.bpmText = "x2"; break;
+            case  2: r.bpmText = "x4"; break;
+            case -1: r.bpmText = "/2"; break;
+            case -2: r.bpmText = "/4"; break;
+            default: r.bpmText = "--"; break;
+        }
+        r.trigText = juce::String(r.midi ? "M" : "") + (r.osc ? "O" : "") + (r.dmx ? "D" : "");
+        r.cuesText = r.cueCount > 0 ? juce::String(r.cueCount) : juce::String("+");
+
+        r.artistSort = lowered(r.artist);
+        r.titleSort  = lowered(r.title);
+        r.offsetSort = lowered(r.offset);
+        r.searchText = r.artistSort + " " + r.titleSort;
+
+        // First one and two characters of every word
+        r.prefixKeys.clear();
+        const auto& t = r.searchText;
+        for (size_t i = 0; i < t.size(); ++i)
+        {
+            if (!isWordChar(t[i]) || (i > 0 && isWordChar(t[i - 1])))
+                continue;
+            r.prefixKeys.push_back(prefixKey(t[i], 0));
+            if (i + 1 < t.size() && isWordChar(t[i + 1]))
+                r.prefixKeys.push_back(prefixKey(t[i], t[i + 1]));
+        }
+        std::sort(r.prefixKeys.begin(), r.prefixKeys.end());
+        r.prefixKeys.erase(std::unique(r.prefixKeys.begin(), r.prefixKeys.end()), r.prefixKeys.end());
+    }
+
+    //==========================================================================
+    // Sorted views -- strict total order (key breaks ties), so every row has
+    // exactly one position and erase can find it by binary search
+    static bool less(SortColumn column, const Row* a, const Row* b)
+    {
+        switch (column)
+        {
+            case SortPlaylist:
+            {
+                const bool aHas = a->sortOrder > 0, bHas = b->sortOrder > 0;
+                if (aHas != bHas) return aHas;
+                if (aHas && a->sortOrder != b->sortOrder) return a->sortOrder < b->sortOrder;
+                if (int c = a->artistSort.compare(b->artistSort)) return c < 0;
+                if (int c = a->titleSort.compare(b->titleSort))   return c < 0;
+                break;
+            }
+            case SortArtist:
+                if (int c = a->artistSort.compare(b->artistSort)) return c < 0;
+                if (int c = a->titleSort.compare(b->titleSort))   return c < 0;
+                break;
+            case SortTitle:
+                if (int c = a->titleSort.compare(b->titleSort))   return c < 0;
+                break;
+            case SortOffset:
+                if (int c = a->offsetSort.compare(b->offsetSort)) return c < 0;
+                break;
+            case kNumSortColumns:
+                break;
+        }
+        return a->key < b->key;
+    }
+
+    std::vector<Row*>& getView(SortColumn column)
+    {
+        auto& view = views[column];
+        if (!viewBuilt[column])
+        {
+            view.clear();
+            view.reserve(rows.size());
+            for (auto& [p, r] : rows)
+                view.push_back(&r);
+            std::sort(view.begin(), view.end(),
+                      [column](const Row* a, const Row* b) { return less(column, a, b); });
+            viewBuilt[column] = true;
+        }
+        return view;
+    }
+
+    void index(Row& r)
+    {
+        for (int c = 0; c < kNumSortColumns; ++c)
+        {
+            if (!viewBuilt[c]) continue;
+            auto column = (SortColumn)c;
+            auto& view = views[c];
+            view.insert(std::upper_bound(view.begin(), view.end(), &r,
+                                         [column](const Row* a, const Row* b) { return less(column, a, b); }),
+                        &r);
+        }
+
+        if (bucketsBuilt)
+            for (auto k : r.prefixKeys)
+                buckets[k].push_back(&r);
+    }
+
+    void unindex(Row& r)
+    {
+        for (int c = 0; c < kNumSortColumns; ++c)
+        {
+            if (!viewBuilt[c]) continue;
+            auto column = (SortColumn)c;
+            auto& view = views[c];
+            auto it = std::lower_bound(view.begin(), view.end(), &r,
+                                       [column](const Row* a, const Row* b) { return less(column, a, b); });
+            if (it != view.end() && *it == &r)
+                view.erase(it);
+            else
+                viewBuilt[c] = false;   // shouldn't happen; rebuild rather than keep a stale pointer
+        }
+
+        if (bucketsBuilt)
+        {
+            for (auto k : r.prefixKeys)
+            {
+                auto b = buckets.find(k);
+                if (b == buckets.end()) continue;
+                auto& v = b->second;
+                auto it = std::find(v.begin(), v.end(), &r);
+                if (it != v.end()) { *it = v.back(); v.pop_back(); }
+            }
+        }
+    }
+
+    void dropIndexes()
+    {
+        for (int c = 0; c < kNumSortColumns; ++c)
+        {
+            viewBuilt[c] = false;
+            views[c].clear();
+        }
+        bucketsBuilt = false;
+        buckets.clear();
+    }
+
+    //==========================================================================
+    // Prefix filter
+    static bool isWordChar(char c)
+    {
+        auto u = (unsigned char)c;
+        return u >= 0x80 || std::isalnum(u);   // UTF-8 continuation bytes stay in the word
+    }
+
+    static uint16_t prefixKey(char c0, char c1)
+    {
+        return (uint16_t)(((unsigned char)c0 << 8) | (unsigned char)c1);
+    }
+
+    /// `token` starts a word somewhere in `text`
+    static bool hasWordPrefix(const std::string& text, const std::string& token)
+    {
+        for (size_t pos = text.find(token); pos != std::string::npos; pos = text.find(token, pos + 1))
+            if (pos == 0 || !isWordChar(text[pos - 1]))
+                return true;
+        return false;
+    }
+
+    /// Marks rows matching every token with the returned pass number.
+    uint32_t markMatches(const juce::StringArray& tokens)
+    {
+        if (!bucketsBuilt)
+        {
+            buckets.clear();
+            for (auto& [p, r] : rows)
+                for (auto k : r.prefixKeys)
+                    buckets[k].push_back(&r);
+            bucketsBuilt = true;
+        }
+
+        std::vector<std::string> words;
+        const std::vector<Row*>* candidates = nullptr;
+        for (auto& t : tokens)
+        {
+            words.push_back(t.toStdString());
+            const auto& w = words.back();
+            // Tokens starting with punctuation aren't indexed; verify them only
+            if (!isWordChar(w[0])) continue;
+
+            auto b = buckets.find(prefixKey(w[0], w.size() > 1 ? w[1] : 0));
+            if (b == buckets.end()) { candidates = &emptyBucket; break; }
+            if (candidates == nullptr || b->second.size() < candidates->size())
+                candidates = &b->second;
+        }
+
+        const uint32_t pass = ++filterPass;
+        auto check = [&](Row* r)
+        {
+            if (r->filterPass == pass) return;
+            r->filterPass = pass;
+            r->filterHit = true;
+            for (auto& w : words)
+                if (!hasWordPrefix(r->searchText, w)) { r->filterHit = false; break; }
+        };
+
+        if (candidates != nullptr)
+            for (auto* r : *candidates) check(r);
+        else
+            for (auto& [p, r] : rows) check(&r);
+        return pass;
+    }
+
+    //==========================================================================
+    std::unordered_map<const TrackMapEntry*, Row> rows;
+    bool     synced = false;
+    uint64_t syncedGeneration = 0;
+    uint32_t syncPass = 0, filterPass = 0;
+
+    std::vector<Row*> views[kNumSortColumns];
+    bool viewBuilt[kNumSortColumns] {};
+
+    std::unordered_map<uint16_t, std::vector<Row*>> buckets;
+    bool bucketsBuilt = false;
+    const std::vector<Row*> emptyBucket;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TrackMapIndex)
+};
@@ -0,0 +1,318 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// TrackMapJournal -- Append-only change log behind trackmap.json.
+//
+// Rewriting the whole Track Map on every cue or offset tweak costs
+// megabytes of JSON per edit on a large library.  Instead, each save
+// appends one record per changed entry to a journal, and the full
+// snapshot (trackmap.json) is only rewritten -- on a background thread --
+// once the journal has grown past kCompactBytes.
+//
+// Files, next to the snapshot:
+//
+//   trackmap.json       snapshot; "journal": N = first journal not in it
+//   trackmap.N.journal  one record per line: <fnv1a64 hex> <JSON>\n
+//
+// Records are opaque juce::vars to this class (TrackMap defines them).
+//
+// Crash safety:
+//   - Records are appended and flushed to disk (fsync) before save returns.
+//     A torn or corrupt tail fails its checksum and is cut off on the next
+//     load; every record before it is kept.
+//   - Compaction first switches appends to journal N+1, then writes the
+//     snapshot (tagged N+1) to a temporary file and renames it into place,
+//     then deletes journals below N+1.  A crash at any step leaves either
+//     the old snapshot + journals N, N+1 or the new snapshot + journal N+1
+//     (stale lower journals are ignored and deleted on load).
+//
+// Message thread only, apart from the compaction worker, which touches
+// only the snapshot and journals below the current one.
+
+#pragma once
+#include <JuceHeader.h>
+#include <functional>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+class TrackMapJournal : private juce::Thread
+{
+public:
+    static constexpr juce::int64 kCompactBytes = 1024 * 1024;
+
+    explicit TrackMapJournal(const juce::File& snapshotFile)
+        : juce::Thread("TrackMap Compaction"), snapshot(snapshotFile) {}
+
+    ~TrackMapJournal() override
+    {
+        waitForThreadToExit(-1);   // never abandon a half-written snapshot
+    }
+
+    //==========================================================================
+    // Loading
+    //==========================================================================
+
+    /// Parsed snapshot (void when missing or unreadable).
+    juce::var readSnapshot()
+    {
+        waitForThreadToExit(-1);
+        if (!snapshot.existsAsFile()) return {};
+        return juce::JSON::parse(snapshot.loadFileAsString());
+    }
+
+    /// Blocks until a running compaction has finished writing.
+    void waitForCompaction()
+    {
+        waitForThreadToExit(-1);
+    }
+
+    /// Calls `apply` for every valid record not yet in the snapshot, in
+    /// order; cuts off corrupt tails and deletes stale journals.  Returns
+    /// the number of records replayed.
+    int replay(const std::function<void(const juce::var&)>& apply)
+    {
+        waitForThreadToExit(-1);
+        writer.reset();
+
+        const int snapshotSeq = readSnapshotSeq();
+        currentSeq = snapshotSeq;
+        int replayed = 0;
+
+        for (auto& [seq, file] : findJournals())
+        {
+            if (seq < snapshotSeq) { file.deleteFile(); continue; }
+            currentSeq = juce::jmax(currentSeq, seq);
+            replayed += replayFile(file, apply);
+        }
+        opened = true;
+        return replayed;
+    }
+
+    //==========================================================================
+    // Writing
+    //==========================================================================
+
+    /// Appends records and flushes them to disk.  False on I/O failure.
+    bool append(const juce::Array<juce::var>& records)
+    {
+        if (records.isEmpty()) return true;
+        if (!ensureWriter()) return false;
+
+        juce::MemoryOutputStream block;
+        for (auto& r : records)
+        {
+            const auto json = juce::JSON::toString(r, true);
+            block << toHex(checksum(json.toRawUTF8(), json.getNumBytesAsUTF8())) << ' ' << json << '\n';
+        }
+
+        if (!writer->write(block.getData(), block.getDataSize())) return false;
+        writer->flush();
+        return writer->getStatus().wasOk();
+    }
+
+    /// True once the current journal is big enough to fold into the snapshot
+    /// (and no compaction is running).
+    bool shouldCompact() const
+    {
+        return writer != nullptr && writer->getPosition() >= kCompactBytes && !isThreadRunning();
+    }
+
+    /// Starts appending to a new journal and writes the snapshot returned
+    /// by `build` (called on the worker -- it must own its data) in the
+    /// background.  `written`, if set, runs on the worker once the new
+    /// snapshot is in place (e.g. to write a load cache next to it).
+    void compact(std::function<juce::var()> build,
+                 std::function<void(const juce::File&)> written = nullptr)
+    {
+        if (isThreadRunning() || !ensureWriter()) return;
+
+        writer.reset();
+        ++currentSeq;
+        pendingSeq = currentSeq;
+        pendingBuild = std::move(build);
+        pendingWritten = std::move(written);
+        startThread();
+    }
+
+    /// Synchronously replaces the snapshot and discards every journal
+    /// (configuration restore).  The next append starts a fresh journal.
+    bool replaceSnapshot(const juce::var& snapshotVar)
+    {
+        waitForThreadToExit(-1);
+        writer.reset();
+        for (auto& [seq, file] : findJournals())
+            file.deleteFile();
+
+        currentSeq = 0;
+        opened = true;
+        return writeSnapshot(snapshotVar, 0);
+    }
+
+private:
+    //==========================================================================
+    // Compaction worker
+    //==========================================================================
+    void run() override
+    {
+        auto build = std::move(pendingBuild);
+        auto written = std::move(pendingWritten);
+        pendingBuild = nullptr;
+        pendingWritten = nullptr;
+        const int seq = pendingSeq;
+
+        if (!writeSnapshot(build(), seq)) return;   // journals kept: nothing lost
+        if (written) written(snapshot);
+
+        for (auto& [s, file] : findJournals())
+            if (s < seq) file.deleteFile();
+    }
+
+    bool writeSnapshot(juce::var snapshotVar, int seq) const
+    {
+        if (auto* obj = snapshotVar.getDynamicObject())
+            obj->setProperty("journal", seq);
+
+        juce::TemporaryFile temp(snapshot);
+        {
+            juce::FileOutputStream out(temp.getFile());
+            if (!out.openedOk()) return false;
+            out << juce::JSON::toString(snapshotVar);
+            out.flush();   // fsync before the rename makes it visible
+            if (!out.getStatus().wasOk()) return false;
+        }
+        return temp.overwriteTargetFileWithTemporary();
+    }
+
+    //==========================================================================
+    // Files
+    //==========================================================================
+    juce::File journalFile(int seq) const
+    {
+        return snapshot.getSiblingFile(snapshot.getFileNameWithoutExtension()
+                                       + "." + juce::String(seq) + ".journal");
+    }
+
+    /// Existing journals, lowest sequence first.
+    std::vector<std::pair<int, juce::File>> findJournals() const
+    {
+        std::vector<std::pair<int, juce::File>> result;
+        const auto prefix = snapshot.getFileNameWithoutExtension() + ".";
+        for (auto& f : snapshot.getParentDirectory().findChildFiles(
+                 juce::File::findFiles, false, prefix + "*.journal"))
+        {
+            auto middle = f.getFileNameWithoutExtension().fromFirstOccurrenceOf(prefix, false, false);
+            if (middle.isNotEmpty() && middle.containsOnly("0123456789"))
+                result.emplace_back(middle.getIntValue(), f);
+        }
+        std::sort(result.begin(), result.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+        return result;
+    }
+
+    int readSnapshotSeq() const
+    {
+        if (!snapshot.existsAsFile()) return 0;
+
+        // Only the header is needed: "journal" is written after "tracks",
+        // so check the end of the file first and fall back to a full parse.
+        juce::FileInputStream in(snapshot);
+        if (in.openedOk())
+        {
+            const juce::int64 tail = juce::jmin((juce::int64)256, in.getTotalLength());
+            in.setPosition(in.getTotalLength() - tail);
+            auto text = in.readString();
+            const int at = text.lastIndexOf("\"journal\"");
+            if (at >= 0)
+                return text.substring(at).fromFirstOccurrenceOf(":", false, false)
+                           .trimStart().getIntValue();
+        }
+        auto parsed = juce::JSON::parse(snapshot.loadFileAsString());
+        return (int)parsed.getProperty("journal", 0);
+    }
+
+    int replayFile(const juce::File& file, const std::function<void(const juce::var&)>& apply)
+    {
+        juce::MemoryBlock data;
+        if (!file.loadFileAsData(data)) return 0;
+
+        const auto* bytes = static_cast<const char*>(data.getData());
+        const size_t size = data.getSize();
+        size_t pos = 0, validEnd = 0;
+        int count = 0;
+
+        while (pos < size)
+        {
+            const void* nl = std::memchr(bytes + pos, '\n', size - pos);
+            if (nl == nullptr) break;   // unterminated last line: torn write
+            const size_t end = (size_t)(static_cast<const char*>(nl) - bytes);
+
+            // "<16 hex> <json>"
+            if (end - pos < 18 || bytes[pos + 16] != ' ') break;
+            const char* json = bytes + pos + 17;
+            const size_t jsonLen = end - pos - 17;
+            if (juce::String(bytes + pos, 16) != toHex(checksum(json, jsonLen))) break;
+
+            auto record = juce::JSON::parse(juce::String::fromUTF8(json, (int)jsonLen));
+            if (record.isVoid()) break;
+            if (apply) apply(record);
+            ++count;
+            pos = validEnd = end + 1;
+        }
+
+        if (validEnd < size)
+        {
+            DBG("TrackMapJournal: dropping " << (int)(size - validEnd)
+                << " corrupt bytes at the end of " << file.getFileName());
+            juce::FileOutputStream out(file);
+            if (out.openedOk())
+            {
+                out.setPosition((juce::int64)validEnd);
+                out.truncate();
+                out.flush();
+            }
+        }
+        return count;
+    }
+
+    bool ensureWriter()
+    {
+        if (!opened) replay(nullptr);   // find the sequence, cut torn tails
+        if (writer != nullptr) return true;
+
+        auto file = journalFile(currentSeq);
+        writer = std::make_unique<juce::FileOutputStream>(file);   // appends
+        if (!writer->openedOk())
+        {
+            writer.reset();
+            return false;
+        }
+        return true;
+    }
+
+    static uint64_t checksum(const char* data, size_t len)
+    {
+        uint64_t h = 1469598103934665603ull;
+        for (size_t i = 0; i < len; ++i)
+            h = (h ^ (unsigned char)data[i]) * 1099511628211ull;
+        return h;
+    }
+
+    static juce::String toHex(uint64_t v)
+    {
+        return juce::String::toHexString((juce::int64)v).paddedLeft('0', 16);
+    }
+
+    juce::File snapshot;
+    std::unique_ptr<juce::FileOutputStream> writer;
+    int  currentSeq = 0;
+    bool opened = false;
+
+    // Handed to the worker by compact()
+    int pendingSeq = 0;
+    std::function<juce::var()> pendingBuild;
+    std::function<void(const juce::File&)> pendingWritten;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TrackMapJournal)
+};
@@ -0,0 +1,276 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// TrackMatchIndex -- Trigram similarity index over TrackMap artist+title.
+//
+// TrackMap lookups are exact on the lower-cased, trimmed "artist|title".
+// The same track is often tagged differently by rekordbox, Engine DJ and
+// XML imports: "feat." credits in the artist or the title, "&" vs "and",
+// punctuation, accents, "(Original Mix)".  This index finds such variants:
+//
+//   normalise : lower-case, fold Latin accents to ASCII, "&" -> "and",
+//               drop "feat./ft./featuring ..." credits and "(original
+//               mix)", punctuation and brackets -> single spaces.
+//   grams     : trigrams of " artist " and " title " (field-tagged, so an
+//               artist gram never matches a title gram).
+//   score     : Dice coefficient of the two gram sets, 0..1.
+//
+// query() only scores tracks that share one of the rarest grams of the
+// query: a track reaching minScore must contain at least
+// |Q| - minOverlap + 1 of them (prefix filtering), so common grams like
+// " th" are never scanned.  Sub-millisecond on 100k tracks for the
+// thresholds used for automatic binding.
+//
+// Identities are TrackKey::text ("artist|title" as makeKey() builds it);
+// TrackMap maps results back to entries.  Removal leaves a tombstone;
+// tombstones are compacted away once they make up a quarter of the index.
+//
+// Message thread only (query() uses scratch state).
+
+#pragma once
+#include <JuceHeader.h>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cmath>
+
+class TrackMatchIndex
+{
+public:
+    struct Match
+    {
+        std::string identity;   // TrackKey::text of the matched track
+        float score = 0.0f;     // Dice similarity, 1 = same normalised text
+    };
+
+    /// Adds a track (no-op if the identity is already indexed).
+    void add(const std::string& identity, const juce::String& artist, const juce::String& title)
+    {
+        if (byIdentity.count(identity) != 0) return;
+
+        Doc d;
+        d.identity = identity;
+        d.grams = gramsOf(artist, title);
+        const auto id = (uint32_t)docs.size();
+        for (auto g : d.grams)
+            postings[g].push_back(id);
+        byIdentity.emplace(identity, id);
+        docs.push_back(std::move(d));
+    }
+
+    void remove(const std::string& identity)
+    {
+        auto it = byIdentity.find(identity);
+        if (it == byIdentity.end()) return;
+        docs[it->second].alive = false;
+        byIdentity.erase(it);
+
+        if (++deadCount > 1024 && deadCount * 4 > docs.size())
+            compact();
+    }
+
+    size_t size() const { return byIdentity.size(); }
+
+    /// Up to maxResults tracks scoring at least minScore, best first.
+    std::vector<Match> query(const juce::String& artist, const juce::String& title,
+                             size_t maxResults, float minScore) const
+    {
+        std::vector<Match> result;
+        const auto q = gramsOf(artist, title);
+        if (q.empty() || maxResults == 0) return result;
+
+        minScore = juce::jlimit(0.01f, 1.0f, minScore);
+        const size_t minOverlap = juce::jlimit((size_t)1, q.size(),
+            (size_t)std::ceil(minScore * (float)q.size() / (2.0f - minScore) - 1.0e-4f));
+
+        // Rarest grams first; absent grams cost nothing to probe
+        std::vector<std::pair<size_t, uint32_t>> bySize;
+        bySize.reserve(q.size());
+        for (auto g : q)
+        {
+            auto p = postings.find(g);
+            bySize.emplace_back(p != postings.end() ? p->second.size() : 0, g);
+        }
+        std::sort(bySize.begin(), bySize.end());
+
+        if (seen.size() < docs.size()) seen.resize(docs.size(), 0);
+        if (++stamp == 0) { std::fill(seen.begin(), seen.end(), 0); stamp = 1; }
+
+        const size_t probes = q.size() - minOverlap + 1;
+        for (size_t i = 0; i < probes; ++i)
+        {
+            auto p = postings.find(bySize[i].second);
+            if (p == postings.end()) continue;
+            for (auto id : p->second)
+            {
+                if (seen[id] == stamp) continue;
+                seen[id] = stamp;
+
+                const auto& d = docs[id];
+                if (!d.alive) continue;
+                const float score = dice(q, d.grams);
+                if (score >= minScore)
+                    result.push_back({ d.identity, score });
+            }
+        }
+
+        std::sort(result.begin(), result.end(), [](const Match& a, const Match& b)
+        {
+            return a.score != b.score ? a.score > b.score : a.identity < b.identity;
+        });
+        if (result.size() > maxResults) result.resize(maxResults);
+        return result;
+    }
+
+    //==========================================================================
+    // Normalisation
+    //==========================================================================
+
+    /// Comparison form of an artist or title (see header comment).
+    static std::string normalise(const juce::String& text)
+    {
+        // Lower-case, fold accents, keep brackets as tokens, everything
+        // else that isn't a letter or digit becomes a word break
+        juce::String folded;
+        folded.preallocateBytes(text.getNumBytesAsUTF8() + 16);
+        for (auto p = text.getCharPointer(); !p.isEmpty();)
+        {
+            const auto c = juce::CharacterFunctions::toLowerCase(p.getAndAdvance());
+            if (c == '(' || c == '[' || c == '{')      folded << " ( ";
+            else if (c == ')' || c == ']' || c == '}') folded << " ) ";
+            else if (c == '&')                         folded << " and ";
+            else if (juce::CharacterFunctions::isLetterOrDigit(c)) appendFolded(folded, c);
+            else                                       folded << ' ';
+        }
+
+        auto tokens = juce::StringArray::fromTokens(folded, " ", "");
+        tokens.removeEmptyStrings();
+
+        // Drop credits and "(original mix)"; brackets only delimit them
+        juce::String out;
+        int depth = 0, skipDepth = -1;
+        for (int i = 0; i < tokens.size(); ++i)
+        {
+            const auto& t = tokens[i];
+            if (t == "(")
+            {
+                if (skipDepth == depth) skipDepth = -1;   // top-level credit ends at a bracket
+                if (skipDepth < 0 && tokens[i + 1] == "original")
+                {
+                    if (tokens[i + 2] == ")")                          { i += 2; continue; }
+                    if (tokens[i + 2] == "mix" && tokens[i + 3] == ")") { i += 3; continue; }
+                }
+                ++depth;
+                continue;
+            }
+            if (t == ")")
+            {
+                if (skipDepth == depth) skipDepth = -1;
+                depth = juce::jmax(0, depth - 1);
+                continue;
+            }
+            if (skipDepth >= 0) continue;
+            if (t == "feat" || t == "ft" || t == "featuring")
+            {
+                skipDepth = depth;
+                continue;
+            }
+            if (out.isNotEmpty()) out << ' ';
+            out << t;
+        }
+        return out.toStdString();
+    }
+
+private:
+    struct Doc
+    {
+        std::string identity;
+        std::vector<uint32_t> grams;   // sorted, unique
+        bool alive = true;
+    };
+
+    static std::vector<uint32_t> gramsOf(const juce::String& artist, const juce::String& title)
+    {
+        std::vector<uint32_t> grams;
+        addGrams(grams, normalise(artist), 1);
+        addGrams(grams, normalise(title), 2);
+        std::sort(grams.begin(), grams.end());
+        grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+        return grams;
+    }
+
+    /// Byte trigrams of " text ", tagged with the field in the top byte
+    static void addGrams(std::vector<uint32_t>& grams, const std::string& text, uint32_t field)
+    {
+        if (text.empty()) return;
+        const std::string padded = " " + text + " ";
+        for (size_t i = 0; i + 3 <= padded.size(); ++i)
+            grams.push_back((field << 24)
+                            | ((uint32_t)(unsigned char)padded[i]     << 16)
+                            | ((uint32_t)(unsigned char)padded[i + 1] << 8)
+                            |  (uint32_t)(unsigned char)padded[i + 2]);
+    }
+
+    static float dice(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b)
+    {
+        size_t common = 0;
+        for (size_t i = 0, j = 0; i < a.size() && j < b.size();)
+        {
+            if (a[i] < b[j]) ++i;
+            else if (b[j] < a[i]) ++j;
+            else { ++common; ++i; ++j; }
+        }
+        return 2.0f * (float)common / (float)(a.size() + b.size());
+    }
+
+    /// Appends c with Latin-1 / Latin Extended-A accents folded to ASCII
+    static void appendFolded(juce::String& out, juce::juce_wchar c)
+    {
+        // 0xE0-0xFF (lower-case Latin-1); '?' entries are multi-letter
+        static const char* latin1 = "aaaaaa?ceeeeiiiidnooooo ouuuuyty";
+        // 0x100-0x17F, upper/lower pairs
+        static const char* latinExtA =
+            "aaaaaaccccccccddddeeeeeeeeeegggggggghhhhiiiiiiiiiiiijjkkklllllllll"
+            "lnnnnnnnnnoooooo??rrrrrrssssssssttttttuuuuuuuuuuuuwwyyyzzzzzzs";
+
+        if (c == 0xDF)                 { out << "ss"; return; }
+        if (c == 0xE6)                 { out << "ae"; return; }
+        if (c == 0x152 || c == 0x153)  { out << "oe"; return; }
+        if (c >= 0xE0 && c <= 0xFF)    { out += (juce::juce_wchar)latin1[c - 0xE0]; return; }
+        if (c >= 0x100 && c <= 0x17F)  { out += (juce::juce_wchar)latinExtA[c - 0x100]; return; }
+        out += c;
+    }
+
+    void compact()
+    {
+        std::vector<Doc> live;
+        live.reserve(byIdentity.size());
+        for (auto& d : docs)
+            if (d.alive) live.push_back(std::move(d));
+
+        docs = std::move(live);
+        postings.clear();
+        byIdentity.clear();
+        for (uint32_t id = 0; id < (uint32_t)docs.size(); ++id)
+        {
+            for (auto g : docs[id].grams)
+                postings[g].push_back(id);
+            byIdentity.emplace(docs[id].identity, id);
+        }
+        deadCount = 0;
+        seen.clear();
+    }
+
+    std::vector<Doc> docs;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> postings;
+    std::unordered_map<std::string, uint32_t> byIdentity;
+    size_t deadCount = 0;
+
+    // query() scratch: docs already scored in this query
+    mutable std::vector<uint32_t> seen;
+    mutable uint32_t stamp = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TrackMatchIndex)
+};
@@ -6,6 +6,7 @@
 #include <JuceHeader.h>
 #include <atomic>
 #include "OscSender.h"
+#include "MidiOutputScheduler.h"
 #include "AppSettings.h"
 
 //==============================================================================
@@ -19,6 +20,8 @@
 //==============================================================================
 class TriggerOutput
 {
+    using MidiClass = MidiOutputScheduler::MessageClass;
+
 public:
     TriggerOutput() = default;
     ~TriggerOutput() { stopMidi(); }
@@ -54,7 +57,7 @@ public:
         if (deviceIndex < 0 || deviceIndex >= (int)midiDevices.size())
             return false;
 
-        midiOutput = juce::MidiOutput::openDevice(midiDevices[deviceIndex].identifier);
+        midiOutput = MidiOutputScheduler::openDevice(midiDevices[deviceIndex].identifier);
         if (midiOutput)
         {
             currentMidiDeviceName = midiDevices[deviceIndex].name;
@@ -84,13 +87,14 @@ public:
 
     //--------------------------------------------------------------------------
     // Shared MIDI output -- allows TriggerOutput to piggyback on MtcOutput's
-    // open device handle when both target the same MIDI port.
-    // juce::MidiOutput::sendMessageNow() is thread-safe (internal CriticalSection).
+    // open device handle when both target the same MIDI port.  All traffic
+    // goes through that port's MidiOutputScheduler, so clock and quarter
+    // frames keep priority over trigger notes and forwarded CC.
     //--------------------------------------------------------------------------
 
-    /// Set an external MidiOutput to use instead of (or alongside) our own.
+    /// Set an external scheduler to use instead of (or alongside) our own.
     /// Pass nullptr to clear and fall back to own device.
-    void setSharedMidiOutput(juce::MidiOutput* shared)
+    void setSharedMidiOutput(MidiOutputScheduler* shared)
     {
         sharedMidiOut = shared;
         // If sharing and clock is running, redirect it to the shared output
@@ -162,11 +166,10 @@ public:
     /// global enable flags.
     ///
     /// NOTE: This method is called from TimecodeEngine::tick() which runs on the
-    /// JUCE message thread (60Hz timer callback).  sendMessageNow() is synchronous
-    /// and may briefly block (~microseconds on healthy drivers).  For Note On +
-    /// Note Off back-to-back, two synchronous calls are made.  This is acceptable
-    /// for show control trigger use cases but could cause a UI stutter if a MIDI
-    /// driver is exceptionally slow.
+    /// JUCE message thread (60Hz timer callback).  MIDI goes through the port's
+    /// MidiOutputScheduler: sent immediately when the wire is idle, otherwise
+    /// queued behind MTC quarter frames and clock and drained by the
+    /// scheduler thread, so a busy port never blocks the caller.
     void fire(const TrackMapEntry& entry)
     {
         if (midiEnabled)
@@ -191,14 +194,14 @@ public:
                 {
                     int note = juce::jlimit(0, 127, cue.midiNoteNum);
                     int vel  = juce::jlimit(0, 127, cue.midiNoteVel);
-                    midi->sendMessageNow(juce::MidiMessage::noteOn(ch, note, (uint8_t)vel));
-                    midi->sendMessageNow(juce::MidiMessage::noteOff(ch, note));
+                    midi->send(juce::MidiMessage::noteOn(ch, note, (uint8_t)vel), MidiClass::Note);
+                    midi->send(juce::MidiMessage::noteOff(ch, note), MidiClass::Note);
                 }
                 if (cue.midiCCNum >= 0)
                 {
                     int cc  = juce::jlimit(0, 127, cue.midiCCNum);
                     int val = juce::jlimit(0, 127, cue.midiCCVal);
-                    midi->sendMessageNow(juce::MidiMessage::controllerEvent(ch, cc, val));
+                    midi->send(juce::MidiMessage::controllerEvent(ch, cc, val), MidiClass::Note);
                 }
             }
         }
@@ -217,7 +220,8 @@ public:
 
     /// Send a MIDI CC message. Channel is 1-based (1-16).
     /// Only sends if MIDI output is open (ignores midiEnabled flag --
-    /// CC forward has its own enable).
+    /// CC forward has its own enable).  Sent as continuous Control data:
+    /// lowest priority, and coalesced per controller when the port is busy.
     void sendCC(int channel, int cc, int value)
     {
         auto* midi = getActiveMidi();
@@ -226,7 +230,7 @@ public:
             juce::jlimit(1, 16, channel),
             juce::jlimit(0, 127, cc),
             juce::jlimit(0, 127, value));
-        midi->sendMessageNow(msg);
+        midi->send(msg, MidiClass::Control);
     }
 
     /// Send a MIDI Note On message for continuous fader control.
@@ -242,7 +246,7 @@ public:
             juce::jlimit(1, 16, channel),
             juce::jlimit(0, 127, note),
             (uint8_t)juce::jlimit(0, 127, velocity));
-        midi->sendMessageNow(msg);
+        midi->send(msg, MidiClass::Control);
     }
 
     /// Send a raw OSC message with a single float value.
@@ -293,13 +297,13 @@ private:
         MidiClockTimer() = default;
         ~MidiClockTimer() override { stopTimer(); }
 
-        void start(double bpm, juce::MidiOutput* output)
+        void start(double bpm, MidiOutputScheduler* output)
         {
             midiOut.store(output, std::memory_order_relaxed);
             setBpm(bpm);
             accumulator = 0.0;
             // Send MIDI Start (0xFA)
-            if (output) output->sendMessageNow(juce::MidiMessage(0xFA));
+            if (output) output->send(juce::MidiMessage(0xFA), MidiClass::Clock);
             startTimer(1);
         }
 
@@ -308,7 +312,7 @@ private:
             stopTimer();
             // Send MIDI Stop (0xFC)
             auto* out = midiOut.load(std::memory_order_relaxed);
-            if (out) out->sendMessageNow(juce::MidiMessage(0xFC));
+            if (out) out->send(juce::MidiMessage(0xFC), MidiClass::Clock);
             midiOut.store(nullptr, std::memory_order_relaxed);
         }
 
@@ -318,10 +322,10 @@ private:
                 pulsesPerMs.store(bpm * 24.0 / 60000.0, std::memory_order_relaxed);
         }
 
-        /// Redirect clock output to a different MidiOutput (e.g. when switching
+        /// Redirect clock output to a different scheduler (e.g. when switching
         /// from own device to shared MtcOutput device).  Now truly thread-safe
         /// via atomic store -- timer thread reads via atomic load.
-        void updateOutput(juce::MidiOutput* newOut) { midiOut.store(newOut, std::memory_order_relaxed); }
+        void updateOutput(MidiOutputScheduler* newOut) { midiOut.store(newOut, std::memory_order_relaxed); }
 
         void hiResTimerCallback() override
         {
@@ -332,13 +336,13 @@ private:
             accumulator += ppms;
             while (accumulator >= 1.0)
             {
-                out->sendMessageNow(juce::MidiMessage((uint8_t)0xF8));
+                out->send(juce::MidiMessage((uint8_t)0xF8), MidiClass::Clock);
                 accumulator -= 1.0;
             }
         }
 
     private:
-        std::atomic<juce::MidiOutput*> midiOut { nullptr };
+        std::atomic<MidiOutputScheduler*> midiOut { nullptr };
         std::atomic<double> pulsesPerMs { 0.048 };  // default 120 BPM
         double accumulator = 0.0;
     };
@@ -360,8 +364,8 @@ private:
         {
             int note = juce::jlimit(0, 127, entry.midiNoteNum);
             int vel  = juce::jlimit(0, 127, entry.midiNoteVel);
-            midi->sendMessageNow(juce::MidiMessage::noteOn(ch, note, (uint8_t)vel));
-            midi->sendMessageNow(juce::MidiMessage::noteOff(ch, note));
+            midi->send(juce::MidiMessage::noteOn(ch, note, (uint8_t)vel), MidiClass::Note);
+            midi->send(juce::MidiMessage::noteOff(ch, note), MidiClass::Note);
         }
 
         // Control Change
@@ -369,7 +373,7 @@ private:
         {
             int cc  = juce::jlimit(0, 127, entry.midiCCNum);
             int val = juce::jlimit(0, 127, entry.midiCCVal);
-            midi->sendMessageNow(juce::MidiMessage::controllerEvent(ch, cc, val));
+            midi->send(juce::MidiMessage::controllerEvent(ch, cc, val), MidiClass::Note);
         }
     }
 
@@ -396,14 +400,14 @@ private:
     // Members
     //--------------------------------------------------------------------------
     // MIDI
-    std::unique_ptr<juce::MidiOutput> midiOutput;     // own device (when not sharing)
-    juce::MidiOutput* sharedMidiOut = nullptr;         // borrowed from MtcOutput (not owned)
+    std::unique_ptr<MidiOutputScheduler> midiOutput;  // own device (when not sharing)
+    MidiOutputScheduler* sharedMidiOut = nullptr;      // borrowed from MtcOutput (not owned)
     juce::Array<juce::MidiDeviceInfo> midiDevices;
     juce::String currentMidiDeviceName;
     bool midiEnabled = false;
 
-    /// Returns the active MidiOutput: shared if set, else own.
-    juce::MidiOutput* getActiveMidi() const
+    /// Returns the active MIDI port scheduler: shared if set, else own.
+    MidiOutputScheduler* getActiveMidi() const
     {
         return sharedMidiOut ? sharedMidiOut : midiOutput.get();
     }
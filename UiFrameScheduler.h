@@ -0,0 +1,238 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// UiFrameScheduler -- One frame clock for every UI window.
+//
+// The main window and the PDL / SLQ views used to run their own timers and
+// repaint at a fixed rate whether they were minimised, covered or showing
+// nothing new.  Windows now register as clients here and get uiFrame()
+// calls at a rate chosen per window, per frame:
+//
+//   hidden / minimised / covered by another STC window  ->  kHiddenHz
+//   STC not the foreground app                          ->  kBackgroundHz
+//   nothing animated for kIdleAfterMs                   ->  kIdleHz
+//   otherwise                                           ->  the client's max
+//
+// uiFrame() returns true while the window has something live (a running
+// source, a moving meter); the first live frame restores the full rate.
+// Hidden windows keep a slow frame so their data polling (metadata
+// requests, retries) continues and they open up to date.
+//
+// Paint budget: clients bracket their paint with beginPaint() (in paint())
+// and endPaint() (in paintOverChildren()), which covers the whole window's
+// children.  Painting may use kPaintBudget of the message thread, split
+// between the windows being drawn; a window whose measured paint cost
+// exceeds its share is framed less often until it fits.
+//
+// Engine work is NOT scheduled here.  MainComponent ticks the engines from
+// its own fixed 60Hz timer, so timecode output never waits on the UI and
+// a slow paint only lowers the UI frame rate.
+//
+// Shared via juce::SharedResourcePointer.  Message thread only.
+
+#pragma once
+#include <JuceHeader.h>
+#include <vector>
+#include <algorithm>
+
+class UiFrameScheduler : private juce::Timer
+{
+public:
+    static constexpr int    kHiddenHz     = 4;
+    static constexpr int    kBackgroundHz = 30;
+    static constexpr int    kIdleHz       = 15;
+    static constexpr double kIdleAfterMs  = 1000.0;
+    static constexpr double kPaintBudget  = 0.5;     // fraction of the message thread
+
+    //==========================================================================
+    class Client
+    {
+    public:
+        virtual ~Client() = default;
+
+        /// One UI frame.  `elapsedMs` is the time since this client's
+        /// previous frame (animation and retry timing must use it, the
+        /// rate varies).  Return true while something is live.
+        virtual bool uiFrame(double elapsedMs) = 0;
+
+        /// Component whose window decides visibility and occlusion.
+        virtual juce::Component& getFrameComponent() = 0;
+    };
+
+    UiFrameScheduler() { startTimerHz(60); }
+    ~UiFrameScheduler() override { stopTimer(); }
+
+    //==========================================================================
+    void addClient(Client* c, int maxHz)
+    {
+        if (find(c) != nullptr) return;
+        Entry e;
+        e.client = c;
+        e.maxHz = juce::jlimit(1, 60, maxHz);
+        e.lastFrameMs = e.lastLiveMs = now();
+        entries.push_back(e);
+    }
+
+    void removeClient(Client* c)
+    {
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                     [c](const Entry& e) { return e.client == c; }),
+                      entries.end());
+    }
+
+    /// Next frame for this client as soon as possible (user interaction,
+    /// data that must show now).  Also leaves the idle rate.
+    void requestFrame(Client* c)
+    {
+        if (auto* e = find(c))
+        {
+            e->frameRequested = true;
+            e->lastLiveMs = now();
+        }
+    }
+
+    //==========================================================================
+    void beginPaint(Client* c)
+    {
+        if (auto* e = find(c))
+            e->paintStartMs = now();
+    }
+
+    void endPaint(Client* c)
+    {
+        auto* e = find(c);
+        if (e == nullptr || e->paintStartMs <= 0.0) return;
+        const double ms = now() - e->paintStartMs;
+        e->paintStartMs = 0.0;
+        e->paintCostMs += (ms - e->paintCostMs) * 0.2;
+        e->statPaintMs += ms;
+    }
+
+private:
+    struct Entry
+    {
+        Client* client = nullptr;
+        int     maxHz = 60;
+        double  lastFrameMs = 0.0;
+        double  lastLiveMs = 0.0;
+        double  paintStartMs = 0.0;
+        double  paintCostMs = 0.0;     // smoothed cost of one full paint
+        bool    frameRequested = false;
+        bool    drawing = false;       // visible and uncovered last frame
+
+        // Debug stats (frames and paint time since the last report)
+        int     statFrames = 0;
+        double  statPaintMs = 0.0;
+    };
+
+    static double now() { return juce::Time::getMillisecondCounterHiRes(); }
+
+    Entry* find(Client* c)
+    {
+        for (auto& e : entries)
+            if (e.client == c) return &e;
+        return nullptr;
+    }
+
+    //==========================================================================
+    void timerCallback() override
+    {
+        const double t = now();
+        const bool foreground = juce::Process::isForegroundProcess();
+
+        int numDrawing = 0;
+        for (auto& e : entries)
+        {
+            e.drawing = isDrawn(e.client->getFrameComponent());
+            if (e.drawing) ++numDrawing;
+        }
+        const double paintShare = kPaintBudget / (double)juce::jmax(1, numDrawing);
+
+        // Clients may remove themselves (or others) inside uiFrame()
+        auto snapshot = entries;
+        for (auto& s : snapshot)
+        {
+            auto* e = find(s.client);
+            if (e == nullptr) continue;
+
+            int hz = e->maxHz;
+            if (!e->drawing)                            hz = kHiddenHz;
+            else if (!foreground)                       hz = juce::jmin(hz, kBackgroundHz);
+            else if (t - e->lastLiveMs > kIdleAfterMs)  hz = juce::jmin(hz, kIdleHz);
+
+            double intervalMs = 1000.0 / hz;
+            if (e->drawing)
+                intervalMs = juce::jmax(intervalMs, e->paintCostMs / paintShare);
+
+            // Half a timer period of slack so a 60Hz client isn't skipped
+            // by jitter against the ~16ms timer
+            const double elapsed = t - e->lastFrameMs;
+            if (!e->frameRequested && elapsed < intervalMs - 8.0)
+                continue;
+
+            e->frameRequested = false;
+            e->lastFrameMs = t;
+            ++e->statFrames;
+            Client* client = e->client;
+            const bool live = client->uiFrame(elapsed);
+
+            if (live)
+                if (auto* after = find(client))
+                    after->lastLiveMs = t;
+        }
+
+       #if JUCE_DEBUG
+        reportStats(t);
+       #endif
+    }
+
+    /// On screen, not minimised, and not fully covered by another of our
+    /// own windows.  The desktop list is in z-order (front last); other
+    /// applications' windows aren't visible to us, which is what the
+    /// background rate is for.
+    static bool isDrawn(juce::Component& c)
+    {
+        if (!c.isShowing()) return false;
+
+        auto* top = c.getTopLevelComponent();
+        auto& desktop = juce::Desktop::getInstance();
+        const auto area = top->getScreenBounds();
+
+        bool above = false;
+        for (int i = 0; i < desktop.getNumComponents(); ++i)
+        {
+            auto* other = desktop.getComponent(i);
+            if (other == top) { above = true; continue; }
+            if (!above || !other->isShowing() || other->isTransformed()) continue;
+            if (other->isOpaque() && other->getScreenBounds().contains(area))
+                return false;
+        }
+        return true;
+    }
+
+   #if JUCE_DEBUG
+    void reportStats(double t)
+    {
+        if (t - lastReportMs < 10000.0) return;
+        const double span = (t - lastReportMs) / 1000.0;
+        lastReportMs = t;
+        for (auto& e : entries)
+        {
+            auto* window = e.client->getFrameComponent().getTopLevelComponent();
+            DBG("UiFrame " + window->getName().quoted()
+                + ": " + juce::String(e.statFrames / span, 1) + " fps, paint "
+                + juce::String(e.statPaintMs / span / 10.0, 1) + "% of message thread"
+                + (e.drawing ? "" : " (hidden)"));
+            e.statFrames = 0;
+            e.statPaintMs = 0.0;
+        }
+    }
+
+    double lastReportMs = 0.0;
+   #endif
+
+    std::vector<Entry> entries;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UiFrameScheduler)
+};
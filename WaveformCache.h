@@ -339,6 +339,16 @@ public:
         return getAnlzFile(trackKey).existsAsFile();
     }
 
+    /// Existing cache files (waveform, artwork, ANLZ) for a track key.
+    static juce::Array<juce::File> getFilesForTrack(const std::string& trackKey)
+    {
+        juce::Array<juce::File> files;
+        for (auto f : { getCacheFile(trackKey), getArtworkFile(trackKey), getAnlzFile(trackKey) })
+            if (f.existsAsFile())
+                files.add(f);
+        return files;
+    }
+
     /// Get the cache directory.
     static juce::File getCacheDir()
     {
@@ -9,22 +9,36 @@
 // overlay, and song structure phrase bars.
 //
 // Data sources:
-//   - Detail waveform: TrackMetadata::detailData (150 entries/sec)
+//   - Detail waveform: TrackMetadata::detailData (150 entries/sec), summarised
+//                      into a WaveformPyramid so zoomed-out columns stay cheap
 //   - Beat grid: TrackMetadata::beatGrid (PQTZ)
 //   - Song structure: TrackMetadata::songStructure (PSSI)
 //   - Cue points: RekordboxCue list (hot cues, memory points, loops with colors)
 //                 or CuePoint list from TrackMapEntry (fallback)
 //   - Active loop: ProDJLinkInput::getLoopStartMs/getLoopEndMs
 //
+// Rendering: the static layers (waveform, beats, phrases, loop, cues) live
+// in a ring of fixed-width tiles keyed by (data, zoom, tile index).  Tiles
+// are rendered on the RenderWorker from an immutable TileSource snapshot and
+// handed back with a generation number (stale ones are dropped); tiles
+// entering from the right are queued ahead of the playhead.  paint() only
+// composites the ready tiles at a sub-pixel offset.
+//
 // Thread model: all setters called from message thread (tick loop).
 
 #pragma once
 #include <JuceHeader.h>
 #include "DbServerClient.h"
 #include "AppSettings.h"
+#include "WaveformPyramid.h"
+#include "RenderWorker.h"
 #include <vector>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <cmath>
 #include <algorithm>
+#include <limits>
 
 class WaveformDetailDisplay : public juce::Component
 {
@@ -36,32 +50,32 @@ public:
     //==========================================================================
 
     /// Set detail waveform data from TrackMetadata.
+    /// The mean/peak pyramid (and with it the global peak) is built on the
+    /// RenderWorker; the waveform appears once it arrives, beat grid / cues /
+    /// phrases draw immediately.
     void setDetailData(const std::vector<uint8_t>& data, int entryCount,
                        int bytesPerEntry, uint32_t trackDurationMs)
     {
-        detailData = data;
         detailEntryCount = entryCount;
         detailBytesPerEntry = bytesPerEntry;
         durationMs = trackDurationMs;
         hasData = (entryCount > 0 && bytesPerEntry > 0
                    && (int)data.size() >= entryCount * bytesPerEntry);
 
-        // Compute global peak once for stable normalization (avoids "breathing"
-        // effect from recalculating peak per visible window every frame).
+        pyramid = nullptr;
         globalPeak = 1;
+        const uint32_t gen = ++pyramidGeneration;
         if (hasData)
         {
-            const uint8_t* d = data.data();
-            int totalBytes = (int)data.size();
-            for (int e = 0; e < entryCount; ++e)
-            {
-                int off = e * bytesPerEntry;
-                if (off + bytesPerEntry > totalBytes) break;
-                for (int b = 0; b < bytesPerEntry && b < 3; ++b)
-                    globalPeak = std::max(globalPeak, d[off + b]);
-            }
+            juce::Component::SafePointer<WaveformDetailDisplay> safe(this);
+            WaveformPyramidBuilder::buildAsync(*renderWorker, data, entryCount, bytesPerEntry,
+                [safe, gen](std::shared_ptr<const WaveformPyramid> p)
+                {
+                    if (safe != nullptr && safe->pyramidGeneration == gen)
+                        safe->setPyramid(std::move(p));
+                });
         }
-        invalidateStaticCache();
+        invalidateTiles();
         repaint();
     }
 
@@ -70,7 +84,7 @@ public:
     {
         if (grid.size() == beatGrid.size() && !beatGrid.empty()) return;
         beatGrid = grid;
-        invalidateStaticCache();
+        refreshTiles();
         repaint();
     }
 
@@ -81,7 +95,7 @@ public:
         if (phrases.size() == songStructure.size() && !songStructure.empty()) return;
         songStructure = phrases;
         phraseMood = mood;
-        invalidateStaticCache();
+        refreshTiles();
         repaint();
     }
 
@@ -90,15 +104,20 @@ public:
     {
         if (cues.size() == rekordboxCues.size() && !rekordboxCues.empty()) return;
         rekordboxCues = cues;
-        invalidateStaticCache();
+        refreshTiles();
         repaint();
     }
 
     /// Set cue points from TrackMapEntry (fallback if no rekordbox cues).
     void setCuePoints(const std::vector<CuePoint>& cues)
     {
+        // Fed on every metadata poll -- only re-render tiles on a real change
+        if (std::equal(cues.begin(), cues.end(), trackMapCues.begin(), trackMapCues.end(),
+                       [](const CuePoint& a, const CuePoint& b)
+                       { return a.positionMs == b.positionMs && a.name == b.name; }))
+            return;
         trackMapCues = cues;
-        invalidateStaticCache();
+        refreshTiles();
         repaint();
     }
 
@@ -109,7 +128,7 @@ public:
         {
             loopStartMs = startMs;
             loopEndMs = endMs;
-            invalidateStaticCache();
+            refreshTiles();
         }
     }
 
@@ -194,7 +213,7 @@ public:
     void setScale(int s)
     {
         scale = juce::jlimit(1, 32, s);
-        invalidateStaticCache();
+        invalidateTiles();
         repaint();
     }
     int getScale() const { return scale; }
@@ -202,7 +221,8 @@ public:
     /// Clear all data (track change).
     void clear()
     {
-        detailData.clear();
+        pyramid = nullptr;
+        ++pyramidGeneration;
         hasData = false;
         detailEntryCount = 0;
         detailBytesPerEntry = 0;
@@ -221,11 +241,20 @@ public:
         playheadSpeed = 0.0;
         durationMs = 0;
         diagLogged = false;
-        invalidateStaticCache();
+        invalidateTiles();
         repaint();
     }
 
     bool hasDetailData() const { return hasData; }
+
+    /// True once after the pyramid for new data arrived.  We're painted
+    /// manually by the PDL View, so our repaint() doesn't reach it.
+    bool takePendingRepaint()
+    {
+        const bool r = pendingRepaint;
+        pendingRepaint = false;
+        return r;
+    }
     int getDetailBytesPerEntry() const { return detailBytesPerEntry; }
 
     /// Returns true if the smooth position is still converging (deceleration/blend).
@@ -263,16 +292,9 @@ public:
         float waveBot = h - inset - 2.0f;
         float waveH = waveBot - waveTop;
 
-        float waveMidY = waveTop + waveH * 0.5f;
-        float halfH = waveH * 0.5f;
-
-        // Calculate visible range in entries (use float for sub-pixel precision)
+        // Visible range in entries (double for sub-pixel precision)
         double centerEntryF = smoothPlayheadMs * TrackMetadata::kDetailEntriesPerSecond / 1000.0;
-        int centerEntry = (int)centerEntryF;
-        float subPixelOffset = (float)(centerEntryF - centerEntry) / (float)scale;  // fractional pixel
-        int halfVisible = (int)(drawW * 0.5f) * scale;
-        int startEntry = centerEntry - halfVisible;
-        int endEntry   = centerEntry + halfVisible;
+        double viewStartF = centerEntryF - (double)((int)(drawW * 0.5f) * scale);
 
 #if JUCE_DEBUG
         if (!diagLogged && hasData)
@@ -289,19 +311,13 @@ public:
                 + " w=" + juce::String((int)w) + " h=" + juce::String((int)h)
                 + " scale=" + juce::String(scale));
         }
+        const double paintStartMs = juce::Time::getMillisecondCounterHiRes();
 #endif
 
-        // --- Cached bitmap rendering ---
-        // The static elements (waveform, beats, cues, phrases) are rendered
-        // to an offscreen image 3x wider than visible. On each frame we just
-        // blit the cached image at the correct scroll offset.
-        // Re-render only when the playhead scrolls beyond the cached range,
-        // or when data/zoom changes (invalidateStaticCache).
-        // HiDPI: render at physical pixel size to avoid blurry scaling.
-
-        // Detect HiDPI scale for sharp cache rendering.
-        // WaveformDetailDisplay is painted manually (not in JUCE component tree),
-        // so use the global display scale as best estimate.
+        // --- Tiled bitmap rendering ---
+        // HiDPI: tiles are rendered at physical pixel size to avoid blurry
+        // scaling.  WaveformDetailDisplay is painted manually (not in JUCE
+        // component tree), so use the global display scale as best estimate.
         float dpiScale = 1.0f;
         {
             auto& displays = juce::Desktop::getInstance().getDisplays();
@@ -309,61 +325,42 @@ public:
                 dpiScale = juce::jmax(dpiScale, (float)d.scale);
         }
 
-        int logicalCacheW = (int)drawW * 3;
-        int logicalCacheH = (int)h;
-        int physCacheW = (int)(logicalCacheW * dpiScale);
-        int physCacheH = (int)(logicalCacheH * dpiScale);
-        int cacheHalfVisible = (int)(logicalCacheW * 0.5f) * scale;
-        int cacheCenterEntry = centerEntry;
-
-        // Check if we need to re-render the cache
-        bool needsRender = !staticCache.isValid()
-            || staticCache.getWidth() != physCacheW
-            || staticCache.getHeight() != physCacheH
-            || startEntry < cacheStartEntry
-            || endEntry > cacheEndEntry;
-
-        if (needsRender)
+        if (tileScale != scale || tileHeight != (int)h || tileDpi != dpiScale)
         {
-            cacheCenterEntry = centerEntry;
-            cacheStartEntry = cacheCenterEntry - cacheHalfVisible;
-            cacheEndEntry   = cacheCenterEntry + cacheHalfVisible;
-
-            staticCache = juce::Image(juce::Image::ARGB, physCacheW, physCacheH, true);
-            juce::Graphics cg(staticCache);
-            cg.addTransform(juce::AffineTransform::scale(dpiScale));
-
-            // Render all static elements at cache coordinates (logical pixels)
-            float cacheDrawW = (float)logicalCacheW;
-
-            // Phrase bar
-            paintPhraseBar(cg, 0.0f, inset, cacheDrawW, 10.0f, cacheStartEntry, cacheEndEntry);
-
-            // Waveform bars
-            paintWaveform(cg, 0.0f, cacheDrawW, waveMidY, halfH, cacheStartEntry);
-
-            // Beat grid ticks
-            paintBeatTicks(cg, 0.0f, waveTop, cacheDrawW, waveH, cacheStartEntry, cacheEndEntry);
-
-            // Loop overlay
-            paintLoop(cg, 0.0f, waveTop, cacheDrawW, waveH, cacheStartEntry, cacheEndEntry);
-
-            // Cue markers
-            paintCueMarkers(cg, 0.0f, waveTop, cacheDrawW, waveH, cacheStartEntry, cacheEndEntry);
+            invalidateTiles();   // geometry changed: old images don't fit
+            tileScale = scale;
+            tileHeight = (int)h;
+            tileDpi = dpiScale;
         }
 
-        // Blit the cached image at the correct scroll offset (sub-pixel precision).
-        // Use clip + drawImageAt with fractional x to avoid integer pixel snapping.
-        float cachePixelOffset = (float)(startEntry - cacheStartEntry) / (float)scale + subPixelOffset;
+        const double tileSpan = (double)(kTileWidth * scale);   // entries per tile
+        const int firstTile = (int)std::floor(viewStartF / tileSpan);
+        const int lastTile  = juce::jmin(firstTile + kNumTiles - 1,   // ring bound (> 6000 px wide)
+                                         (int)std::floor((viewStartF + (double)drawW * scale) / tileSpan));
+
+        // Rendering happens on the RenderWorker: queue the visible tiles,
+        // then the ones about to scroll in (ahead of the playhead, one
+        // behind for reverse / scrub) -- never further than the ring holds.
+        for (int t = firstTile; t <= lastTile; ++t)
+            requestTile(t, h, dpiScale);
+        for (int t : { lastTile + 1, lastTile + 2, firstTile - 1 })
+            if (juce::jmax(t, lastTile) - juce::jmin(t, firstTile) < kNumTiles)
+                requestTile(t, h, dpiScale);
+
+        // Composite whatever tiles are ready at the sub-pixel scroll offset.
+        // The 1/dpiScale factor converts physical-pixel tiles to logical coords.
         {
             juce::Graphics::ScopedSaveState sss(g);
-            g.reduceClipRegion((int)inset, 0, (int)drawW, logicalCacheH);
-            // Draw the full cache image shifted left by the fractional offset.
-            // The 1/dpiScale factor converts physical-pixel image to logical coords.
-            float destX = inset - cachePixelOffset;
+            g.reduceClipRegion((int)inset, 0, (int)drawW, (int)h);
             float destScale = 1.0f / dpiScale;
-            g.drawImageTransformed(staticCache,
-                juce::AffineTransform::scale(destScale).translated(destX, 0.0f));
+            for (int t = firstTile; t <= lastTile; ++t)
+            {
+                auto& tile = slotFor(t);
+                if (tile.index != t || !tile.image.isValid()) continue;
+                float destX = inset + (float)(((double)t * tileSpan - viewStartF) / (double)scale);
+                g.drawImageTransformed(tile.image,
+                    juce::AffineTransform::scale(destScale).translated(destX, 0.0f));
+            }
         }
 
         // --- Dynamic overlays (drawn every frame, cheap) ---
@@ -398,6 +395,10 @@ public:
         };
         paintZoomBtn(plusX, btnY, "+");
         paintZoomBtn(minusX, btnY, "-");
+
+#if JUCE_DEBUG
+        notePaintTime(juce::Time::getMillisecondCounterHiRes() - paintStartMs);
+#endif
     }
 
     /// Hit-test a click in local coordinates. Returns +1 for zoom in, -1 for zoom out, 0 for miss.
@@ -411,474 +412,639 @@ public:
 
 private:
     //==========================================================================
-    // Waveform rendering
+    // Tiles
     //==========================================================================
+    static constexpr int kTileWidth  = 256;   // logical px per tile
+    static constexpr int kNumTiles   = 24;    // ring slots (6144 px)
+    static constexpr int kTileMargin = 96;    // px of neighbour content drawn into each tile
+
+    struct Tile
+    {
+        int index = std::numeric_limits<int>::min();
+        juce::Image image;
+        uint32_t generation = 0;   // tileGeneration the image was rendered for
+        uint32_t requested  = 0;   // tileGeneration last queued on the worker
+    };
 
-    void paintWaveform(juce::Graphics& g, float x0,
-                       float drawW, float waveMidY, float halfH,
-                       int startEntry)
+    //==========================================================================
+    // Tile source -- immutable snapshot of everything a tile shows, so tiles
+    // can be rendered on the RenderWorker while the setters keep running on
+    // the message thread.  Rebuilt (cheap: a few small vectors) whenever a
+    // setter changes what the tiles show.
+    //==========================================================================
+    struct TileSource
     {
-        if (detailData.empty()) return;
+        std::shared_ptr<const WaveformPyramid> pyramid;
+        int detailBytesPerEntry = 0;
+        uint8_t globalPeak = 1;
+        uint32_t durationMs = 0;
+        int scale = 4;
+        float imageHeight = 0.0f;
+        float dpiScale = 1.0f;
+
+        std::vector<TrackMetadata::BeatEntry> beatGrid;
+        std::vector<TrackMetadata::PhraseEntry> songStructure;
+        uint16_t phraseMood = 0;
+        std::vector<TrackMetadata::RekordboxCue> rekordboxCues;
+        std::vector<CuePoint> trackMapCues;
+        uint32_t loopStartMs = 0;
+        uint32_t loopEndMs = 0;
+
+        /// Render the static layers of one tile (any thread).  Cue labels,
+        /// markers and phrase text can straddle tile edges, so overlays are
+        /// drawn over the tile plus a margin either side and clipped by the
+        /// image.
+        juce::Image renderTile(int index) const
+        {
+            auto image = RenderWorker::createImage((int)std::ceil((float)kTileWidth * dpiScale),
+                                                   (int)std::ceil(imageHeight * dpiScale));
+            juce::Graphics cg(image);
+            cg.addTransform(juce::AffineTransform::scale(dpiScale));
 
-        const uint8_t* data = detailData.data();
-        int totalBytes = (int)detailData.size();
-        int bpe = detailBytesPerEntry;
+            float inset = 2.0f;
+            float waveTop = inset + 12.0f;
+            float waveH = (imageHeight - inset - 2.0f) - waveTop;
+            float waveMidY = waveTop + waveH * 0.5f;
+            float halfH = waveH * 0.5f;
+
+            const int tileStart = index * kTileWidth * scale;
+            const int marginStart = tileStart - kTileMargin * scale;
+            const int marginEnd = tileStart + (kTileWidth + kTileMargin) * scale;
+            const float mx0 = -(float)kTileMargin;
+            const float mW = (float)(kTileWidth + kTileMargin * 2);
+
+            paintPhraseBar(cg, mx0, inset, mW, 10.0f, marginStart, marginEnd);
+            paintWaveform(cg, 0.0f, (float)kTileWidth, waveMidY, halfH, tileStart);
+            paintBeatTicks(cg, mx0, waveTop, mW, waveH, marginStart, marginEnd);
+            paintLoop(cg, mx0, waveTop, mW, waveH, marginStart, marginEnd);
+            paintCueMarkers(cg, mx0, waveTop, mW, waveH, marginStart, marginEnd);
+            return image;
+        }
 
-        // Use pre-computed global peak for stable normalization
-        float hScale = halfH / (float)globalPeak;
+        //======================================================================
+        // Waveform rendering
+        //======================================================================
 
-        // Draw one column per pixel
-        for (int px = 0; px < (int)drawW; ++px)
+        void paintWaveform(juce::Graphics& g, float x0,
+                           float drawW, float waveMidY, float halfH,
+                           int startEntry) const
         {
-            int eStart = startEntry + px * scale;
-            int eEnd   = eStart + scale - 1;
+            if (pyramid == nullptr) return;
 
-            // Average entries in this pixel
-            float sums[3] = {};
-            int count = 0;
-            for (int e = eStart; e <= eEnd; ++e)
-            {
-                if (e < 0 || e >= detailEntryCount) continue;
-                int off = e * bpe;
-                if (off + bpe > totalBytes) break;
-                for (int b = 0; b < bpe && b < 3; ++b)
-                    sums[b] += data[off + b];
-                count++;
-            }
-            if (count == 0) continue;
+            int bpe = detailBytesPerEntry;
 
-            float amplitude = sums[0] / (float)count;
-            if (bpe == 3)
-            {
-                // PWV7: mid + high + low
-                float mid  = sums[0] / (float)count;
-                float high = sums[1] / (float)count;
-                float low  = sums[2] / (float)count;
-                amplitude = mid;  // primary amplitude
-                if (amplitude < 0.5f) continue;
-
-                float barH = amplitude * hScale;
-                float xp = x0 + (float)px;
-
-                // Color from frequency distribution
-                float total = low + mid + high + 0.001f;
-                float highRatio = high / total;
-                float r = highRatio;
-                float gn = 0.45f + highRatio * 0.55f;
-                float blu = 1.0f;
-
-                g.setColour(juce::Colour::fromFloatRGBA(r, gn, blu, 0.9f));
-                g.fillRect(xp, waveMidY - barH, 1.0f, barH * 2.0f);
-            }
-            else
+            // Use pre-computed global peak for stable normalization
+            float hScale = halfH / (float)globalPeak;
+
+            // Draw one column per pixel; the pyramid keeps each column to a
+            // handful of bins whatever the zoom
+            WaveformPyramid::Column col;
+            for (int px = 0; px < (int)drawW; ++px)
             {
-                // PWV5: 2 bytes -- height + color
-                float height = sums[0] / (float)count;
-                if (height < 0.5f) continue;
-                float barH = height * hScale;
-                float xp = x0 + (float)px;
-
-                // Blue with brightness from second byte
-                float bright = (bpe >= 2) ? sums[1] / ((float)count * 255.0f) : 0.5f;
-                g.setColour(juce::Colour::fromFloatRGBA(bright * 0.5f, bright * 0.7f, 1.0f, 0.9f));
-                g.fillRect(xp, waveMidY - barH, 1.0f, barH * 2.0f);
+                int eStart = startEntry + px * scale;
+                if (!pyramid->sample(eStart, eStart + scale, col)) continue;
+
+                if (bpe == 3)
+                {
+                    // PWV7: mid + high + low
+                    float mid  = col.avg[0];
+                    float high = col.avg[1];
+                    float low  = col.avg[2];
+                    float amplitude = mid;  // primary amplitude
+                    if (amplitude < 0.5f) continue;
+
+                    float barH = amplitude * hScale;
+                    float xp = x0 + (float)px;
+
+                    // Color from frequency distribution
+                    float total = low + mid + high + 0.001f;
+                    float highRatio = high / total;
+                    float r = highRatio;
+                    float gn = 0.45f + highRatio * 0.55f;
+                    float blu = 1.0f;
+
+                    g.setColour(juce::Colour::fromFloatRGBA(r, gn, blu, 0.9f));
+                    g.fillRect(xp, waveMidY - barH, 1.0f, barH * 2.0f);
+                }
+                else
+                {
+                    // PWV5: 2 bytes -- height + color
+                    float height = col.avg[0];
+                    if (height < 0.5f) continue;
+                    float barH = height * hScale;
+                    float xp = x0 + (float)px;
+
+                    // Blue with brightness from second byte
+                    float bright = (bpe >= 2) ? col.avg[1] / 255.0f : 0.5f;
+                    g.setColour(juce::Colour::fromFloatRGBA(bright * 0.5f, bright * 0.7f, 1.0f, 0.9f));
+                    g.fillRect(xp, waveMidY - barH, 1.0f, barH * 2.0f);
+                }
             }
         }
-    }
-
-    //==========================================================================
-    // Beat grid ticks
-    //==========================================================================
 
-    void paintBeatTicks(juce::Graphics& g, float x0, float waveTop,
-                        float drawW, float waveH,
-                        int startEntry, int endEntry)
-    {
-        if (beatGrid.empty()) return;
+        //======================================================================
+        // Beat grid ticks
+        //======================================================================
 
-        // Binary search: find first beat with entry >= startEntry
-        uint32_t startMs = (uint32_t)((uint64_t)juce::jmax(0, startEntry) * 1000 / TrackMetadata::kDetailEntriesPerSecond);
-        uint32_t endMs   = (uint32_t)((uint64_t)juce::jmax(0, endEntry) * 1000 / TrackMetadata::kDetailEntriesPerSecond);
-        int lo = 0, hi = (int)beatGrid.size() - 1, firstBeat = (int)beatGrid.size();
-        while (lo <= hi)
+        void paintBeatTicks(juce::Graphics& g, float x0, float waveTop,
+                            float drawW, float waveH,
+                            int startEntry, int endEntry) const
         {
-            int mid = (lo + hi) / 2;
-            if (beatGrid[(size_t)mid].timeMs < startMs)
-                lo = mid + 1;
-            else
-                { firstBeat = mid; hi = mid - 1; }
-        }
+            if (beatGrid.empty()) return;
+
+            // Binary search: find first beat with entry >= startEntry
+            uint32_t startMs = (uint32_t)((uint64_t)juce::jmax(0, startEntry) * 1000 / TrackMetadata::kDetailEntriesPerSecond);
+            uint32_t endMs   = (uint32_t)((uint64_t)juce::jmax(0, endEntry) * 1000 / TrackMetadata::kDetailEntriesPerSecond);
+            int lo = 0, hi = (int)beatGrid.size() - 1, firstBeat = (int)beatGrid.size();
+            while (lo <= hi)
+            {
+                int mid = (lo + hi) / 2;
+                if (beatGrid[(size_t)mid].timeMs < startMs)
+                    lo = mid + 1;
+                else
+                    { firstBeat = mid; hi = mid - 1; }
+            }
 
-        float waveBot = waveTop + waveH;
+            float waveBot = waveTop + waveH;
 
-        for (int bi = firstBeat; bi < (int)beatGrid.size(); ++bi)
-        {
-            auto& beat = beatGrid[(size_t)bi];
-            if (beat.timeMs > endMs) break;
+            for (int bi = firstBeat; bi < (int)beatGrid.size(); ++bi)
+            {
+                auto& beat = beatGrid[(size_t)bi];
+                if (beat.timeMs > endMs) break;
 
-            int entry = msToEntry(beat.timeMs);
-            float xp = x0 + entryToPixel(entry, startEntry);
-            if (xp < x0 || xp > x0 + drawW) continue;
+                int entry = msToEntry(beat.timeMs);
+                float xp = x0 + entryToPixel(entry, startEntry);
+                if (xp < x0 || xp > x0 + drawW) continue;
 
-            // CDJ-3000 style beat ticks:
-            // beatNumber is position within bar: 1=downbeat, 2,3,4=other beats
-            bool isDownbeat = (beat.beatNumber == 1);
+                // CDJ-3000 style beat ticks:
+                // beatNumber is position within bar: 1=downbeat, 2,3,4=other beats
+                bool isDownbeat = (beat.beatNumber == 1);
 
-            if (isDownbeat)
-            {
-                // Downbeat: red line like CDJ-3000
-                g.setColour(juce::Colour(0x40FF0000));
-                g.fillRect(xp, waveTop, 1.0f, waveH);  // subtle full-height guide
-                g.setColour(juce::Colour(0xCCFF2020));
-                g.fillRect(xp, waveTop, 1.0f, 5.0f);         // top tick
-                g.fillRect(xp, waveBot - 5.0f, 1.0f, 5.0f);  // bottom tick
-            }
-            else
-            {
-                // Other beats: short subtle ticks from top and bottom only
-                g.setColour(juce::Colour(0x30FFFFFF));
-                g.fillRect(xp, waveTop, 1.0f, 3.0f);         // top tick
-                g.fillRect(xp, waveBot - 3.0f, 1.0f, 3.0f);  // bottom tick
+                if (isDownbeat)
+                {
+                    // Downbeat: red line like CDJ-3000
+                    g.setColour(juce::Colour(0x40FF0000));
+                    g.fillRect(xp, waveTop, 1.0f, waveH);  // subtle full-height guide
+                    g.setColour(juce::Colour(0xCCFF2020));
+                    g.fillRect(xp, waveTop, 1.0f, 5.0f);         // top tick
+                    g.fillRect(xp, waveBot - 5.0f, 1.0f, 5.0f);  // bottom tick
+                }
+                else
+                {
+                    // Other beats: short subtle ticks from top and bottom only
+                    g.setColour(juce::Colour(0x30FFFFFF));
+                    g.fillRect(xp, waveTop, 1.0f, 3.0f);         // top tick
+                    g.fillRect(xp, waveBot - 3.0f, 1.0f, 3.0f);  // bottom tick
+                }
             }
         }
-    }
 
-    //==========================================================================
-    // Song structure phrase bar (top strip)
-    //==========================================================================
+        //======================================================================
+        // Song structure phrase bar (top strip)
+        //======================================================================
 
-    void paintPhraseBar(juce::Graphics& g, float x0, float y0,
-                        float /*drawW*/, float barH,
-                        int startEntry, int endEntry)
-    {
-        if (songStructure.empty() || beatGrid.empty()) return;
+        void paintPhraseBar(juce::Graphics& g, float x0, float y0,
+                            float /*drawW*/, float barH,
+                            int startEntry, int endEntry) const
+        {
+            if (songStructure.empty() || beatGrid.empty()) return;
 
-        g.setFont(juce::Font(juce::FontOptions(barH - 1.0f, juce::Font::bold)));
+            g.setFont(juce::Font(juce::FontOptions(barH - 1.0f, juce::Font::bold)));
 
-        for (size_t pi = 0; pi < songStructure.size(); pi++)
-        {
-            auto& phrase = songStructure[pi];
-            uint32_t startMs = beatToMs(phrase.beatNumber);
-            uint32_t endMs   = (phrase.beatCount > 0)
-                ? beatToMs(phrase.beatNumber + phrase.beatCount)
-                : durationMs;
+            for (size_t pi = 0; pi < songStructure.size(); pi++)
+            {
+                auto& phrase = songStructure[pi];
+                uint32_t startMs = beatToMs(phrase.beatNumber);
+                uint32_t endMs   = (phrase.beatCount > 0)
+                    ? beatToMs(phrase.beatNumber + phrase.beatCount)
+                    : durationMs;
 
-            int eStart = msToEntry(startMs);
-            int eEnd   = msToEntry(endMs);
+                int eStart = msToEntry(startMs);
+                int eEnd   = msToEntry(endMs);
 
-            if (eEnd < startEntry || eStart > endEntry) continue;
+                if (eEnd < startEntry || eStart > endEntry) continue;
 
-            float px0 = x0 + entryToPixel(juce::jmax(eStart, startEntry), startEntry);
-            float px1 = x0 + entryToPixel(juce::jmin(eEnd, endEntry), startEntry);
-            if (px1 <= px0) continue;
+                float px0 = x0 + entryToPixel(juce::jmax(eStart, startEntry), startEntry);
+                float px1 = x0 + entryToPixel(juce::jmin(eEnd, endEntry), startEntry);
+                if (px1 <= px0) continue;
 
-            auto col = phraseColor(phrase.kind, phraseMood);
+                auto col = phraseColor(phrase.kind, phraseMood);
 
-            // Filled bar
-            g.setColour(col);
-            g.fillRect(px0, y0, px1 - px0, barH);
+                // Filled bar
+                g.setColour(col);
+                g.fillRect(px0, y0, px1 - px0, barH);
 
-            // Phrase label text (centered in visible portion)
-            juce::String label = phraseName(phrase.kind, phraseMood);
-            float textW = px1 - px0;
-            if (textW > 18.0f && label.isNotEmpty())
-            {
-                g.setColour(juce::Colours::white.withAlpha(0.9f));
-                g.drawText(label, (int)(px0 + 2.0f), (int)y0,
-                           (int)(textW - 4.0f), (int)barH,
-                           juce::Justification::centredLeft, false);
-            }
+                // Phrase label text, anchored at the phrase start so it lines
+                // up across tiles (clipped away once the start scrolls off)
+                juce::String label = phraseName(phrase.kind, phraseMood);
+                float labelX = x0 + entryToPixel(eStart, startEntry);
+                float textW = px1 - labelX;
+                if (textW > 18.0f && label.isNotEmpty())
+                {
+                    g.setColour(juce::Colours::white.withAlpha(0.9f));
+                    g.drawText(label, (int)(labelX + 2.0f), (int)y0,
+                               (int)(textW - 4.0f), (int)barH,
+                               juce::Justification::centredLeft, false);
+                }
 
-            // Left edge separator (thin dark line between phrases)
-            if (pi > 0 && px0 > x0 + 1.0f)
-            {
-                g.setColour(juce::Colour(0x80000000));
-                g.fillRect(px0, y0, 1.0f, barH);
+                // Left edge separator (thin dark line between phrases)
+                if (pi > 0 && px0 > x0 + 1.0f)
+                {
+                    g.setColour(juce::Colour(0x80000000));
+                    g.fillRect(px0, y0, 1.0f, barH);
+                }
             }
         }
-    }
 
-    /// Map phrase kind to display name based on mood.
-    static juce::String phraseName(uint16_t kind, uint16_t mood)
-    {
-        if (mood == 1) // High
+        /// Map phrase kind to display name based on mood.
+        static juce::String phraseName(uint16_t kind, uint16_t mood)
         {
-            switch (kind)
+            if (mood == 1) // High
             {
-                case 1: return "Intro";
-                case 2: return "Up";
-                case 3: return "Down";
-                case 5: return "Chorus";
-                case 6: return "Outro";
-                default: return {};
+                switch (kind)
+                {
+                    case 1: return "Intro";
+                    case 2: return "Up";
+                    case 3: return "Down";
+                    case 5: return "Chorus";
+                    case 6: return "Outro";
+                    default: return {};
+                }
             }
-        }
-        else if (mood == 3) // Low
-        {
-            switch (kind)
+            else if (mood == 3) // Low
             {
-                case 1:  return "Intro";
-                case 2: case 3: case 4: return "Verse 1";
-                case 5: case 6: case 7: return "Verse 2";
-                case 8:  return "Bridge";
-                case 9:  return "Chorus";
-                case 10: return "Outro";
-                default: return {};
+                switch (kind)
+                {
+                    case 1:  return "Intro";
+                    case 2: case 3: case 4: return "Verse 1";
+                    case 5: case 6: case 7: return "Verse 2";
+                    case 8:  return "Bridge";
+                    case 9:  return "Chorus";
+                    case 10: return "Outro";
+                    default: return {};
+                }
             }
-        }
-        else // Mid (default)
-        {
-            switch (kind)
+            else // Mid (default)
             {
-                case 1:  return "Intro";
-                case 2:  return "Verse 1";
-                case 3:  return "Verse 2";
-                case 4:  return "Verse 3";
-                case 5:  return "Verse 4";
-                case 6:  return "Verse 5";
-                case 7:  return "Verse 6";
-                case 8:  return "Bridge";
-                case 9:  return "Chorus";
-                case 10: return "Outro";
-                default: return {};
+                switch (kind)
+                {
+                    case 1:  return "Intro";
+                    case 2:  return "Verse 1";
+                    case 3:  return "Verse 2";
+                    case 4:  return "Verse 3";
+                    case 5:  return "Verse 4";
+                    case 6:  return "Verse 5";
+                    case 7:  return "Verse 6";
+                    case 8:  return "Bridge";
+                    case 9:  return "Chorus";
+                    case 10: return "Outro";
+                    default: return {};
+                }
             }
         }
-    }
 
-    /// Map phrase kind to a color (matching rekordbox conventions per mood).
-    static juce::Colour phraseColor(uint16_t kind, uint16_t mood)
-    {
-        if (mood == 1) // High
+        /// Map phrase kind to a color (matching rekordbox conventions per mood).
+        static juce::Colour phraseColor(uint16_t kind, uint16_t mood)
         {
-            switch (kind)
+            if (mood == 1) // High
             {
-                case 1: return juce::Colour(0xDD2C5FE0);  // Intro -- blue
-                case 2: return juce::Colour(0xDD32BE5A);  // Up -- green
-                case 3: return juce::Colour(0xDDCC8844);  // Down -- amber
-                case 5: return juce::Colour(0xDDE04080);  // Chorus -- magenta/pink
-                case 6: return juce::Colour(0xDD2C5FE0);  // Outro -- blue
-                default: return juce::Colour(0xAA555555);
+                switch (kind)
+                {
+                    case 1: return juce::Colour(0xDD2C5FE0);  // Intro -- blue
+                    case 2: return juce::Colour(0xDD32BE5A);  // Up -- green
+                    case 3: return juce::Colour(0xDDCC8844);  // Down -- amber
+                    case 5: return juce::Colour(0xDDE04080);  // Chorus -- magenta/pink
+                    case 6: return juce::Colour(0xDD2C5FE0);  // Outro -- blue
+                    default: return juce::Colour(0xAA555555);
+                }
             }
-        }
-        else if (mood == 3) // Low
-        {
-            switch (kind)
+            else if (mood == 3) // Low
             {
-                case 1:                 return juce::Colour(0xDD2C5FE0);  // Intro
-                case 2: case 3: case 4: return juce::Colour(0xDD32BE5A);  // Verse 1 (a/b/c)
-                case 5: case 6: case 7: return juce::Colour(0xDD30A8A0);  // Verse 2 (a/b/c)
-                case 8:                 return juce::Colour(0xDD8844CC);  // Bridge
-                case 9:                 return juce::Colour(0xDDE04080);  // Chorus
-                case 10:                return juce::Colour(0xDD2C5FE0);  // Outro
-                default: return juce::Colour(0xAA555555);
+                switch (kind)
+                {
+                    case 1:                 return juce::Colour(0xDD2C5FE0);  // Intro
+                    case 2: case 3: case 4: return juce::Colour(0xDD32BE5A);  // Verse 1 (a/b/c)
+                    case 5: case 6: case 7: return juce::Colour(0xDD30A8A0);  // Verse 2 (a/b/c)
+                    case 8:                 return juce::Colour(0xDD8844CC);  // Bridge
+                    case 9:                 return juce::Colour(0xDDE04080);  // Chorus
+                    case 10:                return juce::Colour(0xDD2C5FE0);  // Outro
+                    default: return juce::Colour(0xAA555555);
+                }
             }
-        }
-        else // Mid (default, mood==2)
-        {
-            switch (kind)
+            else // Mid (default, mood==2)
             {
-                case 1:  return juce::Colour(0xDD2C5FE0);  // Intro -- blue
-                case 2:  return juce::Colour(0xDD32BE5A);  // Verse 1 -- green
-                case 3:  return juce::Colour(0xDD30A8A0);  // Verse 2 -- teal
-                case 4:  return juce::Colour(0xDD50B848);  // Verse 3 -- lime-green
-                case 5:  return juce::Colour(0xDD28C0A0);  // Verse 4 -- sea
-                case 6:  return juce::Colour(0xDD40B870);  // Verse 5 -- emerald
-                case 7:  return juce::Colour(0xDD58B040);  // Verse 6 -- olive
-                case 8:  return juce::Colour(0xDD8844CC);  // Bridge -- purple
-                case 9:  return juce::Colour(0xDDE04080);  // Chorus -- magenta/pink
-                case 10: return juce::Colour(0xDD2C5FE0);  // Outro -- blue
-                default: return juce::Colour(0xAA555555);
+                switch (kind)
+                {
+                    case 1:  return juce::Colour(0xDD2C5FE0);  // Intro -- blue
+                    case 2:  return juce::Colour(0xDD32BE5A);  // Verse 1 -- green
+                    case 3:  return juce::Colour(0xDD30A8A0);  // Verse 2 -- teal
+                    case 4:  return juce::Colour(0xDD50B848);  // Verse 3 -- lime-green
+                    case 5:  return juce::Colour(0xDD28C0A0);  // Verse 4 -- sea
+                    case 6:  return juce::Colour(0xDD40B870);  // Verse 5 -- emerald
+                    case 7:  return juce::Colour(0xDD58B040);  // Verse 6 -- olive
+                    case 8:  return juce::Colour(0xDD8844CC);  // Bridge -- purple
+                    case 9:  return juce::Colour(0xDDE04080);  // Chorus -- magenta/pink
+                    case 10: return juce::Colour(0xDD2C5FE0);  // Outro -- blue
+                    default: return juce::Colour(0xAA555555);
+                }
             }
         }
-    }
 
-    //==========================================================================
-    // Loop overlay
-    //==========================================================================
+        //======================================================================
+        // Loop overlay
+        //======================================================================
 
-    void paintLoop(juce::Graphics& g, float x0, float waveTop,
-                   float /*drawW*/, float waveH,
-                   int startEntry, int endEntry)
-    {
-        if (loopStartMs == 0 || loopEndMs == 0) return;
+        void paintLoop(juce::Graphics& g, float x0, float waveTop,
+                       float /*drawW*/, float waveH,
+                       int startEntry, int endEntry) const
+        {
+            if (loopStartMs == 0 || loopEndMs == 0) return;
 
-        int eStart = msToEntry(loopStartMs);
-        int eEnd   = msToEntry(loopEndMs);
-        if (eEnd < startEntry || eStart > endEntry) return;
+            int eStart = msToEntry(loopStartMs);
+            int eEnd   = msToEntry(loopEndMs);
+            if (eEnd < startEntry || eStart > endEntry) return;
 
-        float px0 = x0 + entryToPixel(juce::jmax(eStart, startEntry), startEntry);
-        float px1 = x0 + entryToPixel(juce::jmin(eEnd, endEntry), startEntry);
-        if (px1 <= px0) return;
+            float px0 = x0 + entryToPixel(juce::jmax(eStart, startEntry), startEntry);
+            float px1 = x0 + entryToPixel(juce::jmin(eEnd, endEntry), startEntry);
+            if (px1 <= px0) return;
 
-        // Semi-transparent orange overlay
-        g.setColour(juce::Colour(0x25FF8800));
-        g.fillRect(px0, waveTop, px1 - px0, waveH);
+            // Semi-transparent orange overlay
+            g.setColour(juce::Colour(0x25FF8800));
+            g.fillRect(px0, waveTop, px1 - px0, waveH);
 
-        // Vertical bars at loop boundaries
-        g.setColour(juce::Colour(0xAAFF8800));
-        if (eStart >= startEntry && eStart <= endEntry)
-        {
-            float lx = x0 + entryToPixel(eStart, startEntry);
-            g.fillRect(lx, waveTop, 1.5f, waveH);
-        }
-        if (eEnd >= startEntry && eEnd <= endEntry)
-        {
-            float lx = x0 + entryToPixel(eEnd, startEntry);
-            g.fillRect(lx, waveTop, 1.5f, waveH);
+            // Vertical bars at loop boundaries
+            g.setColour(juce::Colour(0xAAFF8800));
+            if (eStart >= startEntry && eStart <= endEntry)
+            {
+                float lx = x0 + entryToPixel(eStart, startEntry);
+                g.fillRect(lx, waveTop, 1.5f, waveH);
+            }
+            if (eEnd >= startEntry && eEnd <= endEntry)
+            {
+                float lx = x0 + entryToPixel(eEnd, startEntry);
+                g.fillRect(lx, waveTop, 1.5f, waveH);
+            }
         }
-    }
-
-    //==========================================================================
-    // Cue point markers
-    //==========================================================================
 
-    void paintCueMarkers(juce::Graphics& g, float x0, float waveTop,
-                         float drawW, float waveH,
-                         int startEntry, int endEntry)
-    {
-        g.setFont(9.0f);
+        //======================================================================
+        // Cue point markers
+        //======================================================================
 
-        // Prefer rekordbox cues (have colors + types). Fall back to TrackMap.
-        if (!rekordboxCues.empty())
+        void paintCueMarkers(juce::Graphics& g, float x0, float waveTop,
+                             float drawW, float waveH,
+                             int startEntry, int endEntry) const
         {
-            for (auto& cue : rekordboxCues)
+            g.setFont(9.0f);
+
+            // Prefer rekordbox cues (have colors + types). Fall back to TrackMap.
+            if (!rekordboxCues.empty())
             {
-                int entry = msToEntry(cue.positionMs);
-                if (entry < startEntry || entry > endEntry) continue;
-                float xp = x0 + entryToPixel(entry, startEntry);
-                if (xp < x0 || xp > x0 + drawW) continue;
+                for (auto& cue : rekordboxCues)
+                {
+                    int entry = msToEntry(cue.positionMs);
+                    if (entry < startEntry || entry > endEntry) continue;
+                    float xp = x0 + entryToPixel(entry, startEntry);
+                    if (xp < x0 || xp > x0 + drawW) continue;
 
-                juce::Colour cueCol = cue.hasColor
-                    ? cue.getColour()
-                    : defaultCueColor(cue.type);
+                    juce::Colour cueCol = cue.hasColor
+                        ? cue.getColour()
+                        : defaultCueColor(cue.type);
 
-                // Loop body overlay
-                if (cue.type == TrackMetadata::RekordboxCue::Loop && cue.loopEndMs > 0)
-                {
-                    int endE = msToEntry(cue.loopEndMs);
-                    float xEnd = x0 + entryToPixel(juce::jmin(endE, endEntry), startEntry);
-                    if (xEnd > xp)
+                    // Loop body overlay
+                    if (cue.type == TrackMetadata::RekordboxCue::Loop && cue.loopEndMs > 0)
                     {
-                        g.setColour(cueCol.withAlpha(0.12f));
-                        g.fillRect(xp, waveTop, xEnd - xp, waveH);
+                        int endE = msToEntry(cue.loopEndMs);
+                        float xEnd = x0 + entryToPixel(juce::jmin(endE, endEntry), startEntry);
+                        if (xEnd > xp)
+                        {
+                            g.setColour(cueCol.withAlpha(0.12f));
+                            g.fillRect(xp, waveTop, xEnd - xp, waveH);
+                        }
                     }
-                }
 
-                // Vertical line
-                g.setColour(cueCol.withAlpha(0.6f));
-                g.fillRect(xp, waveTop, 1.5f, waveH);
+                    // Vertical line
+                    g.setColour(cueCol.withAlpha(0.6f));
+                    g.fillRect(xp, waveTop, 1.5f, waveH);
 
-                // Marker shape: triangle for hot cues, diamond for memory points
-                if (cue.type == TrackMetadata::RekordboxCue::HotCue)
-                {
-                    juce::Path tri;
-                    tri.addTriangle(xp - 4.0f, waveTop, xp + 4.0f, waveTop, xp, waveTop + 5.0f);
-                    g.setColour(cueCol);
-                    g.fillPath(tri);
-                }
-                else if (cue.type == TrackMetadata::RekordboxCue::MemoryPoint)
-                {
-                    juce::Path dia;
-                    dia.addTriangle(xp - 3.0f, waveTop + 3.0f, xp + 3.0f, waveTop + 3.0f, xp, waveTop);
-                    g.setColour(cueCol);
-                    g.fillPath(dia);
+                    // Marker shape: triangle for hot cues, diamond for memory points
+                    if (cue.type == TrackMetadata::RekordboxCue::HotCue)
+                    {
+                        juce::Path tri;
+                        tri.addTriangle(xp - 4.0f, waveTop, xp + 4.0f, waveTop, xp, waveTop + 5.0f);
+                        g.setColour(cueCol);
+                        g.fillPath(tri);
+                    }
+                    else if (cue.type == TrackMetadata::RekordboxCue::MemoryPoint)
+                    {
+                        juce::Path dia;
+                        dia.addTriangle(xp - 3.0f, waveTop + 3.0f, xp + 3.0f, waveTop + 3.0f, xp, waveTop);
+                        g.setColour(cueCol);
+                        g.fillPath(dia);
+                    }
+                    else // Loop
+                    {
+                        juce::Path tri;
+                        tri.addTriangle(xp - 4.0f, waveTop, xp + 4.0f, waveTop, xp, waveTop + 5.0f);
+                        g.setColour(cueCol);
+                        g.fillPath(tri);
+                    }
+
+                    // Label: hot cue letter + comment
+                    juce::String label;
+                    auto letter = cue.hotCueLetter();
+                    if (letter.isNotEmpty()) label = letter;
+                    if (cue.comment.isNotEmpty())
+                        label += label.isNotEmpty() ? " " + cue.comment : cue.comment;
+
+                    if (label.isNotEmpty())
+                    {
+                        g.setColour(cueCol);
+                        g.drawText(label, (int)(xp + 3.0f), (int)waveTop,
+                                   80, 12, juce::Justification::centredLeft, false);
+                    }
                 }
-                else // Loop
+            }
+            else if (!trackMapCues.empty())
+            {
+                // Fallback: TrackMap cue points (all green, no types)
+                for (auto& cue : trackMapCues)
                 {
+                    int entry = msToEntry(cue.positionMs);
+                    if (entry < startEntry || entry > endEntry) continue;
+                    float xp = x0 + entryToPixel(entry, startEntry);
+                    if (xp < x0 || xp > x0 + drawW) continue;
+
+                    juce::Colour cueCol(0xFF00DD44);
+                    g.setColour(cueCol.withAlpha(0.6f));
+                    g.fillRect(xp, waveTop, 1.5f, waveH);
+
                     juce::Path tri;
                     tri.addTriangle(xp - 4.0f, waveTop, xp + 4.0f, waveTop, xp, waveTop + 5.0f);
                     g.setColour(cueCol);
                     g.fillPath(tri);
-                }
-
-                // Label: hot cue letter + comment
-                juce::String label;
-                auto letter = cue.hotCueLetter();
-                if (letter.isNotEmpty()) label = letter;
-                if (cue.comment.isNotEmpty())
-                    label += label.isNotEmpty() ? " " + cue.comment : cue.comment;
 
-                if (label.isNotEmpty())
-                {
-                    g.setColour(cueCol);
-                    g.drawText(label, (int)(xp + 3.0f), (int)waveTop,
-                               80, 12, juce::Justification::centredLeft, false);
+                    if (cue.name.isNotEmpty())
+                    {
+                        g.setColour(cueCol);
+                        g.drawText(cue.name, (int)(xp + 3.0f), (int)waveTop,
+                                   60, 12, juce::Justification::centredLeft, false);
+                    }
                 }
             }
         }
-        else if (!trackMapCues.empty())
+
+        static juce::Colour defaultCueColor(TrackMetadata::RekordboxCue::Type type)
         {
-            // Fallback: TrackMap cue points (all green, no types)
-            for (auto& cue : trackMapCues)
+            switch (type)
             {
-                int entry = msToEntry(cue.positionMs);
-                if (entry < startEntry || entry > endEntry) continue;
-                float xp = x0 + entryToPixel(entry, startEntry);
-                if (xp < x0 || xp > x0 + drawW) continue;
+                case TrackMetadata::RekordboxCue::HotCue:      return juce::Colour(0xFF1ECC3C);  // green
+                case TrackMetadata::RekordboxCue::MemoryPoint:  return juce::Colour(0xFFCC2020);  // red
+                case TrackMetadata::RekordboxCue::Loop:         return juce::Colour(0xFFFF8800);  // orange
+                default:                                        return juce::Colour(0xFF1ECC3C);
+            }
+        }
 
-                juce::Colour cueCol(0xFF00DD44);
-                g.setColour(cueCol.withAlpha(0.6f));
-                g.fillRect(xp, waveTop, 1.5f, waveH);
+        //======================================================================
+        // Coordinate helpers
+        //======================================================================
 
-                juce::Path tri;
-                tri.addTriangle(xp - 4.0f, waveTop, xp + 4.0f, waveTop, xp, waveTop + 5.0f);
-                g.setColour(cueCol);
-                g.fillPath(tri);
+        int msToEntry(uint32_t ms) const
+        {
+            return (int)((uint64_t)ms * TrackMetadata::kDetailEntriesPerSecond / 1000);
+        }
 
-                if (cue.name.isNotEmpty())
-                {
-                    g.setColour(cueCol);
-                    g.drawText(cue.name, (int)(xp + 3.0f), (int)waveTop,
-                               60, 12, juce::Justification::centredLeft, false);
-                }
-            }
+        /// Convert entry index to pixel X offset from the left of the draw area.
+        float entryToPixel(int entry, int startEntry) const
+        {
+            return (float)(entry - startEntry) / (float)scale;
+        }
+
+        /// Find ms for a beat number using the beat grid.
+        uint32_t beatToMs(uint16_t beatNum) const
+        {
+            if (beatGrid.empty() || beatNum == 0) return 0;
+            // Beat grid entries are in chronological order.
+            // beatNum is the 1-based absolute beat index from PSSI phrases.
+            // beatGrid[i].beatNumber is the position within the bar (1-4), NOT absolute.
+            // So we simply index: absolute beat N = beatGrid[N-1].
+            int idx = (int)beatNum - 1;
+            if (idx < 0) idx = 0;
+            if (idx >= (int)beatGrid.size()) idx = (int)beatGrid.size() - 1;
+            return beatGrid[(size_t)idx].timeMs;
         }
+    };
+
+    Tile& slotFor(int index)
+    {
+        return tiles[(size_t)(((index % kNumTiles) + kNumTiles) % kNumTiles)];
     }
 
-    static juce::Colour defaultCueColor(TrackMetadata::RekordboxCue::Type type)
+    /// Queue a tile on the RenderWorker unless it's current or already queued.
+    /// A slot keeps its previous image until the new one lands, so a cue or
+    /// loop change never blanks the strip.
+    void requestTile(int index, float h, float dpiScale)
     {
-        switch (type)
+        auto& tile = slotFor(index);
+        if (tile.index != index)
         {
-            case TrackMetadata::RekordboxCue::HotCue:      return juce::Colour(0xFF1ECC3C);  // green
-            case TrackMetadata::RekordboxCue::MemoryPoint:  return juce::Colour(0xFFCC2020);  // red
-            case TrackMetadata::RekordboxCue::Loop:         return juce::Colour(0xFFFF8800);  // orange
-            default:                                        return juce::Colour(0xFF1ECC3C);
+            tile.index = index;
+            tile.image = {};
+            tile.generation = tile.requested = 0;
         }
+        if (tile.generation == tileGeneration || tile.requested == tileGeneration)
+            return;
+        tile.requested = tileGeneration;
+
+        if (tileSource == nullptr)
+            tileSource = makeTileSource(h, dpiScale);
+
+        auto src = tileSource;
+        auto live = liveTileGeneration;
+        const uint32_t gen = tileGeneration;
+        juce::Component::SafePointer<WaveformDetailDisplay> safe(this);
+        renderWorker->post<juce::Image>(
+            [src, live, gen, index]
+            {
+                // Skip work superseded while queued (track, zoom or cue change)
+                if (live->load(std::memory_order_relaxed) != gen) return juce::Image();
+                return src->renderTile(index);
+            },
+            [safe, gen, index](juce::Image img)
+            {
+                if (safe != nullptr)
+                    safe->tileRendered(gen, index, std::move(img));
+            });
     }
 
-    //==========================================================================
-    // Coordinate helpers
-    //==========================================================================
+    void tileRendered(uint32_t gen, int index, juce::Image img)
+    {
+        if (gen != tileGeneration || !img.isValid()) return;
+        auto& tile = slotFor(index);
+        if (tile.index != index) return;
+        tile.image = std::move(img);
+        tile.generation = gen;
+        pendingRepaint = true;
+        repaint();
+    }
 
-    int msToEntry(uint32_t ms) const
+    std::shared_ptr<const TileSource> makeTileSource(float h, float dpiScale) const
     {
-        return (int)((uint64_t)ms * TrackMetadata::kDetailEntriesPerSecond / 1000);
+        auto ts = std::make_shared<TileSource>();
+        ts->pyramid = pyramid;
+        ts->detailBytesPerEntry = detailBytesPerEntry;
+        ts->globalPeak = globalPeak;
+        ts->durationMs = durationMs;
+        ts->scale = scale;
+        ts->imageHeight = h;
+        ts->dpiScale = dpiScale;
+        ts->beatGrid = beatGrid;
+        ts->songStructure = songStructure;
+        ts->phraseMood = phraseMood;
+        ts->rekordboxCues = rekordboxCues;
+        ts->trackMapCues = trackMapCues;
+        ts->loopStartMs = loopStartMs;
+        ts->loopEndMs = loopEndMs;
+        return ts;
     }
 
-    /// Convert entry index to pixel X offset from the left of the draw area.
-    float entryToPixel(int entry, int startEntry) const
+#if JUCE_DEBUG
+    // Paint-time percentiles, logged once per kPaintStatFrames painted frames
+    static constexpr int kPaintStatFrames = 600;
+    std::vector<float> paintTimes;
+
+    void notePaintTime(double ms)
     {
-        return (float)(entry - startEntry) / (float)scale;
+        paintTimes.push_back((float)ms);
+        if ((int)paintTimes.size() < kPaintStatFrames) return;
+
+        std::sort(paintTimes.begin(), paintTimes.end());
+        auto pct = [this](double p) { return paintTimes[(size_t)(p * (double)(paintTimes.size() - 1))]; };
+        DBG("WaveformDetail paint ms: p50=" + juce::String(pct(0.50), 2)
+            + " p95=" + juce::String(pct(0.95), 2)
+            + " p99=" + juce::String(pct(0.99), 2)
+            + " max=" + juce::String(paintTimes.back(), 2));
+        paintTimes.clear();
     }
+#endif
 
-    /// Find ms for a beat number using the beat grid.
-    uint32_t beatToMs(uint16_t beatNum) const
+    void setPyramid(std::shared_ptr<const WaveformPyramid> p)
     {
-        if (beatGrid.empty() || beatNum == 0) return 0;
-        // Beat grid entries are in chronological order.
-        // beatNum is the 1-based absolute beat index from PSSI phrases.
-        // beatGrid[i].beatNumber is the position within the bar (1-4), NOT absolute.
-        // So we simply index: absolute beat N = beatGrid[N-1].
-        int idx = (int)beatNum - 1;
-        if (idx < 0) idx = 0;
-        if (idx >= (int)beatGrid.size()) idx = (int)beatGrid.size() - 1;
-        return beatGrid[(size_t)idx].timeMs;
+        pyramid = std::move(p);
+        pendingRepaint = true;
+        // Global peak for stable normalization (avoids "breathing" from
+        // recalculating the peak per visible window every frame)
+        globalPeak = pyramid != nullptr ? juce::jmax((uint8_t)1, pyramid->getPeakOfFirst(3)) : (uint8_t)1;
+        refreshTiles();
+        repaint();
     }
 
     //==========================================================================
     // Data
     //==========================================================================
-    std::vector<uint8_t> detailData;
+    std::shared_ptr<const WaveformPyramid> pyramid;   // null until built
+    uint32_t pyramidGeneration = 0;                   // drops results for a replaced track
+    bool pendingRepaint = false;
+    juce::SharedResourcePointer<RenderWorker> renderWorker;
     int detailEntryCount = 0;
     int detailBytesPerEntry = 0;
     uint32_t durationMs = 0;
@@ -906,16 +1072,35 @@ private:
     juce::Rectangle<float> zoomInBounds, zoomOutBounds;  // set during paint
     bool diagLogged = false;  // one-shot diagnostic flag
 
-    // Cached bitmap for static waveform elements (3x wider than visible)
-    juce::Image staticCache;
-    int cacheStartEntry = 0;
-    int cacheEndEntry = 0;
+    // Tile ring for the static layers; all tiles share scale/height/dpi
+    std::array<Tile, kNumTiles> tiles;
+    int tileScale = 0;
+    int tileHeight = 0;
+    float tileDpi = 0.0f;
+    uint32_t tileGeneration = 1;                     // bumped whenever tile content changes
+    std::shared_ptr<std::atomic<uint32_t>> liveTileGeneration
+        = std::make_shared<std::atomic<uint32_t>>(1); // read by queued jobs to skip stale work
+    std::shared_ptr<const TileSource> tileSource;    // null until the next request after a change
+
+    /// Tile content changed (cues, loop, beat grid, phrases, pyramid):
+    /// re-render, showing the previous images until the new ones land.
+    void refreshTiles()
+    {
+        ++tileGeneration;
+        liveTileGeneration->store(tileGeneration, std::memory_order_relaxed);
+        tileSource = nullptr;
+    }
 
-    void invalidateStaticCache()
+    /// Track, zoom or geometry changed: old images are wrong, drop them.
+    void invalidateTiles()
     {
-        staticCache = juce::Image();  // release the cached image
-        cacheStartEntry = 0;
-        cacheEndEntry = 0;
+        refreshTiles();
+        for (auto& t : tiles)
+        {
+            t.index = std::numeric_limits<int>::min();
+            t.image = juce::Image();   // release the tile
+            t.generation = t.requested = 0;
+        }
     }
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveformDetailDisplay)
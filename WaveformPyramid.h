@@ -0,0 +1,218 @@
+// Super Timecode Converter
+// Copyright (c) 2026 Fiverecords -- MIT License
+// https://github.com/fiverecords/SuperTimecodeConverter
+//
+// WaveformPyramid -- Multi-resolution mean/peak summary of a waveform.
+//
+// Every waveform renderer draws one column per pixel, and a column can
+// cover anything from one source entry (detail view, max zoom) to hundreds
+// (overview of a long track, detail view zoomed out).  Scanning the raw
+// entries makes draw cost grow with track length and zoom.  The pyramid
+// stores the source once per level, each level halving the resolution:
+//
+//   level 0 : source entries              (N bins)
+//   level k : 2^k source entries per bin  (ceil(N / 2^k) bins)
+//
+// Each bin holds, per byte channel of the source format, the mean (8.8
+// fixed point) and the peak.  sample() picks the level whose bins are
+// 1/4..1/2 of the column span, so a column touches at most ~4 bins whatever
+// the zoom -- paint cost is proportional to width.
+//
+// Channel layout is the source layout (1 byte = 1 channel):
+//   PWV6/PWV7/Denon overview : 3 = {mid, high, low}
+//   PWV5                     : 2 = {height, colour}
+//   PWV4 (NXS2 colour)       : 6 = {d0, d1, d2, R, G, B}
+//
+// Immutable once built; shared as std::shared_ptr<const WaveformPyramid>.
+// Built on the RenderWorker thread (WaveformPyramidBuilder::buildAsync), the
+// result delivered on the message thread.
+
+#pragma once
+#include <JuceHeader.h>
+#include "RenderWorker.h"
+#include <vector>
+#include <memory>
+#include <functional>
+#include <algorithm>
+
+class WaveformPyramid
+{
+public:
+    static constexpr int kMaxChannels = 6;
+
+    /// Mean + peak of a column, per channel.
+    struct Column
+    {
+        float   avg[kMaxChannels] {};
+        uint8_t peak[kMaxChannels] {};
+    };
+
+    //==========================================================================
+    /// Build from raw interleaved entries (any thread).  Returns nullptr for
+    /// empty or inconsistent input.
+    static std::shared_ptr<const WaveformPyramid> build(const uint8_t* data, size_t dataSize,
+                                                        int entryCount, int bytesPerEntry)
+    {
+        if (data == nullptr || entryCount <= 0 || bytesPerEntry <= 0
+            || dataSize < (size_t)entryCount * (size_t)bytesPerEntry)
+            return nullptr;
+
+        auto p = std::shared_ptr<WaveformPyramid>(new WaveformPyramid());
+        const int ch = juce::jmin(bytesPerEntry, kMaxChannels);
+        p->channels = ch;
+        p->sourceEntries = entryCount;
+
+        // Level 0: the source itself
+        Level base;
+        base.count = entryCount;
+        base.avg.resize((size_t)entryCount * (size_t)ch);
+        base.peak.resize((size_t)entryCount * (size_t)ch);
+        for (int e = 0; e < entryCount; ++e)
+        {
+            const uint8_t* src = data + (size_t)e * (size_t)bytesPerEntry;
+            for (int c = 0; c < ch; ++c)
+            {
+                base.avg [(size_t)e * (size_t)ch + (size_t)c] = (uint16_t)(src[c] << 8);
+                base.peak[(size_t)e * (size_t)ch + (size_t)c] = src[c];
+            }
+        }
+        p->levels.push_back(std::move(base));
+
+        // Halve until one bin remains
+        while (p->levels.back().count > 1)
+        {
+            const Level& prev = p->levels.back();
+            Level next;
+            next.count = (prev.count + 1) / 2;
+            next.avg.resize((size_t)next.count * (size_t)ch);
+            next.peak.resize((size_t)next.count * (size_t)ch);
+            for (int b = 0; b < next.count; ++b)
+            {
+                const int i0 = b * 2;
+                const int i1 = juce::jmin(i0 + 1, prev.count - 1);
+                for (int c = 0; c < ch; ++c)
+                {
+                    const size_t a = (size_t)i0 * (size_t)ch + (size_t)c;
+                    const size_t z = (size_t)i1 * (size_t)ch + (size_t)c;
+                    const size_t o = (size_t)b  * (size_t)ch + (size_t)c;
+                    next.avg[o]  = (uint16_t)(((uint32_t)prev.avg[a] + prev.avg[z] + 1) >> 1);
+                    next.peak[o] = std::max(prev.peak[a], prev.peak[z]);
+                }
+            }
+            p->levels.push_back(std::move(next));
+        }
+
+        return p;
+    }
+
+    //==========================================================================
+    int getChannels()      const { return channels; }
+    int getSourceEntries() const { return sourceEntries; }
+    int getNumLevels()     const { return (int)levels.size(); }
+
+    /// Peak of one channel over the whole track.
+    uint8_t getPeak(int channel) const
+    {
+        if (channel < 0 || channel >= channels) return 0;
+        return levels.back().peak[(size_t)channel];
+    }
+
+    /// Largest peak among the first n channels (e.g. 3 for band heights).
+    uint8_t getPeakOfFirst(int n) const
+    {
+        uint8_t p = 0;
+        for (int c = 0; c < juce::jmin(n, channels); ++c)
+            p = std::max(p, getPeak(c));
+        return p;
+    }
+
+    /// Level used for a column spanning `span` source entries: bins of at
+    /// most a quarter of the span (min level 0, max the top level).
+    int levelForSpan(int span) const
+    {
+        int k = 0;
+        while (k + 1 < (int)levels.size() && (4 << k) <= span)
+            ++k;
+        return k;
+    }
+
+    /// Mean and peak of source entries [first, end).  Range is clipped to
+    /// the track; returns false when nothing of it lies inside.
+    bool sample(int first, int end, Column& out) const
+    {
+        first = juce::jmax(0, first);
+        end   = juce::jmin(sourceEntries, end);
+        if (end <= first) return false;
+
+        const int k = levelForSpan(end - first);
+        const Level& L = levels[(size_t)k];
+        const int b0 = first >> k;
+        const int b1 = juce::jmin(L.count - 1, (end - 1) >> k);
+
+        uint32_t sums[kMaxChannels] {};
+        uint8_t  peaks[kMaxChannels] {};
+        for (int b = b0; b <= b1; ++b)
+        {
+            const size_t base = (size_t)b * (size_t)channels;
+            for (int c = 0; c < channels; ++c)
+            {
+                sums[c] += L.avg[base + (size_t)c];
+                peaks[c] = std::max(peaks[c], L.peak[base + (size_t)c]);
+            }
+        }
+
+        const float inv = 1.0f / (256.0f * (float)(b1 - b0 + 1));
+        for (int c = 0; c < channels; ++c)
+        {
+            out.avg[c]  = (float)sums[c] * inv;
+            out.peak[c] = peaks[c];
+        }
+        for (int c = channels; c < kMaxChannels; ++c)
+        {
+            out.avg[c]  = 0.0f;
+            out.peak[c] = 0;
+        }
+        return true;
+    }
+
+private:
+    WaveformPyramid() = default;
+
+    struct Level
+    {
+        int count = 0;
+        std::vector<uint16_t> avg;    // count x channels, 8.8 fixed point
+        std::vector<uint8_t>  peak;   // count x channels
+    };
+
+    int channels = 0;
+    int sourceEntries = 0;
+    std::vector<Level> levels;
+
+    JUCE_LEAK_DETECTOR(WaveformPyramid)
+};
+
+//==============================================================================
+// WaveformPyramidBuilder -- builds pyramids on the shared RenderWorker thread.
+//
+// Callers tag requests with their own generation number and drop results
+// that arrive for an older generation (track changed meanwhile).
+//==============================================================================
+struct WaveformPyramidBuilder
+{
+    using Callback = std::function<void(std::shared_ptr<const WaveformPyramid>)>;
+
+    /// `data` is copied (moved if an rvalue); `onDone` runs on the message
+    /// thread.
+    static void buildAsync(RenderWorker& worker, std::vector<uint8_t> data,
+                           int entryCount, int bytesPerEntry, Callback onDone)
+    {
+        auto shared = std::make_shared<const std::vector<uint8_t>>(std::move(data));
+        worker.post<std::shared_ptr<const WaveformPyramid>>(
+            [shared, entryCount, bytesPerEntry]
+            {
+                return WaveformPyramid::build(shared->data(), shared->size(), entryCount, bytesPerEntry);
+            },
+            std::move(onDone));
+    }
+};